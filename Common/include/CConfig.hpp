@@ -422,6 +422,11 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  array<unsigned short,2> NK_PrecLagIntParam{{1, 0}}; /*!< \brief Integer parameters to lag the NK preconditioner. */
+  su2double NK_PrecLagRateFactor = 0.0; /*!< \brief Rebuild the NK preconditioner if the linear convergence rate degrades by this factor. */
+  bool NK_FrozenProducts;      /*!< \brief Matrix-free NK products with frozen gradients, limiters, and sensors. */
+  bool CoupledTurbSolve;       /*!< \brief Solve the mean flow and turbulence linear systems as a single coupled system. */
+  bool TurbPositivityUpdate;   /*!< \brief Positivity preserving update of k and omega (two-equation models). */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -610,11 +615,23 @@ private:
   su2double Linear_Solver_Error;   /*!< \brief Min error of the linear solver for the implicit formulation. */
   su2double Deform_Linear_Solver_Error;          /*!< \brief Min error of the linear solver for the implicit formulation. */
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
+  unsigned long Linear_Solver_Smoother_Async_Sweeps; /*!< \brief Local sweeps of the asynchronous smoother (0 disables it). */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned short Linear_Solver_Recycle_Size;     /*!< \brief Dimension of the subspace recycled between solves by GCRO-DR. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  unsigned short Linear_Solver_Refinement_Iter;  /*!< \brief Max. number of mixed precision iterative refinement steps. */
+  bool Linear_Solver_SELL_Format;                /*!< \brief Use the SELL-C-sigma format in sparse matrix-vector products. */
+  BLOCK_COMPRESSION Linear_Solver_Prec_Compression; /*!< \brief Storage format of the off-diagonal blocks of ILU and LU_SGS. */
+  bool Linear_Solver_Classical_GS;               /*!< \brief Use classical Gram-Schmidt (with re-orthogonalization) in the Krylov solvers. */
+  bool Linelet_Off_Body;                         /*!< \brief Build linelets in anisotropic regions away from walls. */
+  bool Linelet_Across_Ranks;                     /*!< \brief Allow linelets to continue across MPI partitions. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Levels;                 /*!< \brief Use level scheduling (one global factorization) for the ILU preconditioner. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Max. number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Number of smoothing sweeps per level of the AMG preconditioner. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -1171,6 +1188,7 @@ private:
   unsigned long         pastix_fact_freq;  /*!< \brief (Re-)Factorization frequency for PaStiX */
   unsigned short        pastix_verb_lvl;  /*!< \brief Verbosity level for PaStiX */
   unsigned short        pastix_fill_lvl;  /*!< \brief Fill level for PaStiX ILU */
+  unsigned long         sparse_direct_fact_freq; /*!< \brief (Re-)Factorization frequency for the built-in sparse direct solver */
 
   string caseName;                 /*!< \brief Name of the current case */
 
@@ -4113,18 +4131,80 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get whether the ILU preconditioner uses level scheduling instead of partitioning for threads.
+   */
+  bool GetLinear_Solver_ILU_Levels(void) const { return Linear_Solver_ILU_Levels; }
+
+  /*!
+   * \brief Get the maximum number of levels (including the fine level) of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre- and post-smoothing sweeps of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Get the strength of connection threshold used to form the AMG aggregates.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get the dimension of the subspace recycled between linear solves by GCRO-DR.
+   */
+  unsigned short GetLinear_Solver_Recycle_Size(void) const { return Linear_Solver_Recycle_Size; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
    */
   su2double GetLinear_Solver_Smoother_Relaxation(void) const { return Linear_Solver_Smoother_Relaxation; }
 
+  /*!
+   * \brief Get the number of local sweeps of the asynchronous smoother.
+   * \return Sweeps each thread performs between synchronizations, 0 if the smoother is synchronous.
+   */
+  unsigned long GetLinear_Solver_Smoother_Async_Sweeps(void) const { return Linear_Solver_Smoother_Async_Sweeps; }
+
+  /*!
+   * \brief Get the max number of outer iterative refinement steps of the (mixed precision) linear solver.
+   * \return Number of refinement steps, 0 if refinement is disabled.
+   */
+  unsigned short GetLinear_Solver_Refinement_Iter(void) const { return Linear_Solver_Refinement_Iter; }
+
+  /*!
+   * \brief Get whether sparse matrix-vector products use a SELL-C-sigma copy of the matrix.
+   */
+  bool GetLinear_Solver_SELL_Format(void) const { return Linear_Solver_SELL_Format; }
+
+  /*!
+   * \brief Get the (compressed) storage format of the off-diagonal blocks of the ILU and LU_SGS preconditioners.
+   */
+  BLOCK_COMPRESSION GetLinear_Solver_Prec_Compression(void) const { return Linear_Solver_Prec_Compression; }
+
+  /*!
+   * \brief Get whether the Arnoldi process of the Krylov solvers uses classical Gram-Schmidt.
+   */
+  bool GetLinear_Solver_Classical_GS(void) const { return Linear_Solver_Classical_GS; }
+
+  /*!
+   * \brief Get whether linelets are also built in anisotropic regions away from walls (e.g. wakes).
+   */
+  bool GetLinelet_Off_Body(void) const { return Linelet_Off_Body; }
+
+  /*!
+   * \brief Get whether linelets can continue across MPI partitions.
+   */
+  bool GetLinelet_Across_Ranks(void) const { return Linelet_Across_Ranks; }
+
   /*!
    * \brief Get the relaxation factor for solution updates of adjoint solvers.
    */
@@ -4161,6 +4241,31 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get Newton-Krylov preconditioner lagging parameters {max reuse iterations, max linear iterations}.
+   */
+  array<unsigned short,2> GetNewtonKrylovPrecLagParam(void) const { return NK_PrecLagIntParam; }
+
+  /*!
+   * \brief Get the factor of convergence rate degradation that triggers a rebuild of the Newton-Krylov preconditioner.
+   */
+  su2double GetNewtonKrylovPrecLagRateFactor(void) const { return NK_PrecLagRateFactor; }
+
+  /*!
+   * \brief Get whether the matrix-free products of the NK method use a lightweight residual evaluation.
+   */
+  bool GetNewtonKrylovFrozenProducts(void) const { return NK_FrozenProducts; }
+
+  /*!
+   * \brief Get whether the mean flow and turbulence implicit systems are solved as one coupled system.
+   */
+  bool GetCoupledTurbSolve(void) const { return CoupledTurbSolve; }
+
+  /*!
+   * \brief Get whether the updates of k and omega are mapped to keep them positive (instead of clipping them).
+   */
+  bool GetTurbPositivityUpdate(void) const { return TurbPositivityUpdate; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -9562,6 +9667,12 @@ public:
    */
   unsigned short GetPastixFillLvl(void) const { return pastix_fill_lvl; }
 
+  /*!
+   * \brief Get the factorization frequency of the built-in sparse direct solver.
+   * \return Number of calls to 'Build' that trigger re-factorization (0 means only once).
+   */
+  unsigned long GetSparseDirect_FactFreq(void) const { return sparse_direct_fact_freq; }
+
   /*!
    * \brief Check if an option is present in the config file
    * \param[in] - Name of the option
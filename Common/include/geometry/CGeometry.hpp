@@ -206,6 +206,26 @@ class CGeometry {
     std::vector<unsigned long> colorOffsets;
 
     std::vector<uint8_t> lineletColor;  /*!< \brief Coloring transfered to points, for visualization. */
+
+    /*!< \brief Connection between the last point of a linelet and the first point of a linelet of another rank. */
+    struct CLink {
+      unsigned long linelet;  /*!< \brief Local linelet. */
+      unsigned long point;    /*!< \brief Local index of the (halo) point of the linelet of the other rank. */
+      int rank;               /*!< \brief The other rank. */
+      unsigned short stage;   /*!< \brief Stage of the first of the two linelets. */
+    };
+    enum : unsigned long {NO_LINK = std::numeric_limits<unsigned long>::max()};
+
+    /*!< \brief Linelets that continue on other ranks (nextLinks) and that continue linelets of other ranks
+     *          (prevLinks). Sorted by stage, rank, and global index of the first point of the second linelet,
+     *          which gives the same order on both sides of the connections between two ranks. */
+    std::vector<CLink> nextLinks, prevLinks;
+    std::vector<unsigned long> nextLinkIdx, prevLinkIdx; /*!< \brief Links of each linelet, or NO_LINK. */
+
+    /*!< \brief The stage of a linelet is the number of linelets of other ranks that precede it, the
+     *          tridiagonal systems are eliminated stage by stage. nStages is the same on all ranks. */
+    std::vector<unsigned short> lineletStage;
+    unsigned short nStages = 1;
   };
  protected:
   mutable CLineletInfo lineletInfo;
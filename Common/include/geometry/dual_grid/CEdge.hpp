@@ -43,7 +43,7 @@ private:
   using NodeArray = C2DContainer<Index, Index, StorageType::ColumnMajor, 64, DynamicSize, 2>;
   NodeArray Nodes;           /*!< \brief Vector to store the node indices of the edge. */
   su2activematrix Normal;    /*!< \brief Normal (area) of the edge. */
-  const Index nEdge, nEdgeSIMD;
+  const Index nEdge;
 
   friend class CPhysicalGeometry;
 
@@ -71,25 +71,16 @@ public:
   inline unsigned long GetNode(unsigned long iEdge, unsigned long iNode) const { return Nodes(iEdge,iNode); }
 
   /*!
-   * \brief SIMD version of GetNode, iNode returned for contiguous iEdges.
+   * \brief SIMD version of GetNode, contiguous iEdges are loaded directly,
+   *        otherwise (e.g. repeated indices in the tail of a color) they are gathered.
+   * \note No padding is required since only the requested edges are accessed.
    */
   template<class T, size_t N>
   FORCEINLINE simd::Array<T,N> GetNode(simd::Array<T,N> iEdge, unsigned long iNode) const {
-    return simd::Array<T,N>(&Nodes(iEdge[0],iNode));
-  }
-
-  /*!
-   * \brief Sets the tail of "Nodes" to repeat one of the last edges.
-   * \note This is needed when using the SIMD version of GetNode and
-   *       the number of edges is not a multiple of the simd width.
-   */
-  void SetPaddingNodes() {
-    for (auto iEdge = nEdge; iEdge < nEdgeSIMD; ++iEdge) {
-      /*--- Pad nodes by repeating the first edge in the last SIMD group. ---*/
-      const auto iEdge0 = nEdgeSIMD - simd::preferredLen<su2double>();
-      Nodes(iEdge, LEFT) = Nodes(iEdge0, LEFT);
-      Nodes(iEdge, RIGHT) = Nodes(iEdge0, RIGHT);
-    }
+    bool contiguous = true;
+    for (size_t k=1; k<N; ++k) contiguous &= (iEdge[k] == iEdge[0]+k);
+    if (contiguous) return simd::Array<T,N>(&Nodes(iEdge[0],iNode));
+    return simd::Array<T,N>(&Nodes(0,iNode), iEdge);
   }
 
   /*!
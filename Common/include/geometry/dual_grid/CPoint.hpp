@@ -101,6 +101,9 @@ private:
   su2activevector SharpEdge_Distance;     /*!< \brief Distance to a sharp edge. */
   su2activevector Curvature;              /*!< \brief Value of the surface curvature (SU2_GEO). */
   su2activevector MaxLength;              /*!< \brief The maximum cell-center to cell-center length. */
+  su2activematrix MaxDelta;               /*!< \brief Per direction maximum distance to the neighbors (hybrid RANS/LES). */
+  su2activematrix NeighborDelta;          /*!< \brief Per direction distances to the neighbors, ordered as "Point" (hybrid RANS/LES). */
+  su2activevector MinLength;              /*!< \brief The minimum distance to the neighbors, wall normal step of IDDES (hybrid RANS/LES). */
   su2activevector RoughnessHeight;          /*!< \brief Roughness of the nearest wall. */
 
   su2matrix<int> AD_InputIndex;           /*!< \brief Indices of Coord variables in the adjoint vector. */
@@ -464,6 +467,11 @@ public:
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the distance to the nearest wall of all points.
+   */
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -478,6 +486,11 @@ public:
    */
   inline su2double GetRoughnessHeight(unsigned long iPoint) const { return RoughnessHeight(iPoint); }
 
+  /*!
+   * \brief Get the roughness of the nearest wall of all points.
+   */
+  inline const su2activevector& GetRoughnessHeight() const { return RoughnessHeight; }
+
   /*!
    * \brief Set the value of the distance to a sharp edge.
    * \param[in] iPoint - Index of the point.
@@ -521,6 +534,44 @@ public:
    */
   inline su2double GetMaxLength(unsigned long iPoint) const { return MaxLength(iPoint); }
 
+  /*!
+   * \brief Allocate the per direction distances to the neighbors (if needed), after the points are set.
+   */
+  void AllocateNeighborDelta();
+
+  /*!
+   * \brief Compute the per direction (absolute) distances of a point to its neighbors, their maximum, and the
+   *        minimum distance to the neighbors.
+   * \note These only depend on the coordinates and are used by the length scales of hybrid RANS/LES models,
+   *       they are updated with the max length (see CGeometry::SetMaxLength).
+   * \param[in] iPoint - Index of the point.
+   */
+  void SetNeighborDelta(unsigned long iPoint);
+
+  /*!
+   * \brief Get the per direction maximum distance of a point to its neighbors.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to nDim values.
+   */
+  inline const su2double* GetMaxDelta(unsigned long iPoint) const { return MaxDelta[iPoint]; }
+
+  /*!
+   * \brief Get the minimum distance of a point to its neighbors.
+   * \param[in] iPoint - Index of the point.
+   * \return The minimum distance to the neighbors (at most the max length).
+   */
+  inline su2double GetMinLength(unsigned long iPoint) const { return MinLength(iPoint); }
+
+  /*!
+   * \brief Get the per direction distance of a point to one of its neighbors.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] iNeigh - Index of the neighbor, in the order of GetPoint(iPoint, iNeigh).
+   * \return Pointer to nDim values.
+   */
+  inline const su2double* GetNeighborDelta(unsigned long iPoint, unsigned long iNeigh) const {
+    return NeighborDelta[Point.outerPtr()[iPoint] + iNeigh];
+  }
+
   /*!
    * \brief Get area or volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -529,6 +580,11 @@ public:
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
 
+  /*!
+   * \brief Get the volumes of all control volumes.
+   */
+  inline const su2activevector& GetVolume() const { return Volume; }
+
   /*!
    * \brief Set the volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -0,0 +1,141 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Aggregation-based algebraic multigrid hierarchy for block-sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSysVector.hpp"
+#include <vector>
+
+class CConfig;
+template<class T> class CSysMatrix;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Algebraic multigrid (AMG) hierarchy built directly from the blocks of a CSysMatrix.
+ * \note The coarse spaces are defined by plain (piecewise constant) aggregation of strongly
+ *       connected points, the coarse operators are Galerkin products, and the smoother is a
+ *       block Gauss-Seidel method. Each thread aggregates and smooths within its partition of
+ *       the matrix rows, and each rank within its domain, i.e. the method is additive across
+ *       ranks (the same as the ILU and LU_SGS preconditioners).
+ *       The aggregates and the sparse patterns of the coarse levels are computed on the first
+ *       build and kept, subsequent builds only recompute the values of the coarse operators.
+ */
+template<class ScalarType>
+class CAlgebraicMultigrid {
+private:
+  enum : unsigned long { NOT_SET = ~0ul };  /*!< \brief Marker for unaggregated points. */
+  enum { MIN_COARSE_POINTS = 32 };          /*!< \brief Coarsening stops below this number of points per thread. */
+  enum { OMP_MAX_SIZE = 512 };              /*!< \brief Max. chunk size for the parallel loops over points. */
+  static constexpr passivedouble MAX_COARSENING_RATIO = 0.9; /*!< \brief Coarsening stops when nCoarse > ratio*nFine. */
+
+  /*!
+   * \brief Matrix, transfer operators, and working memory of one level of the hierarchy.
+   * \note The fine level refers to the data of the CSysMatrix, the others own their data.
+   */
+  struct CLevel {
+    unsigned long nPoint = 0;                 /*!< \brief Number of rows (and columns) of the level. */
+    const unsigned long* row_ptr = nullptr;   /*!< \brief Pointers to the first element in each row. */
+    const unsigned long* col_ind = nullptr;   /*!< \brief Column index of each non zero block. */
+    const unsigned long* dia_ptr = nullptr;   /*!< \brief Pointers to the diagonal block of each row. */
+    const ScalarType* matrix = nullptr;       /*!< \brief Values of the non zero blocks. */
+
+    std::vector<unsigned long> rowPtr, colInd, diaPtr; /*!< \brief Storage of the sparse pattern (coarse levels). */
+    std::vector<ScalarType> values;           /*!< \brief Storage of the matrix values (coarse levels). */
+    std::vector<ScalarType> invDiag;          /*!< \brief Inverse of the diagonal blocks (for the smoother). */
+    std::vector<unsigned long> partitions;    /*!< \brief Thread partitions of the rows. */
+
+    std::vector<unsigned long> aggregate;     /*!< \brief Point of the next level that each point belongs to. */
+    std::vector<unsigned long> aggPtr;        /*!< \brief Where the points of each aggregate start in aggPoints. */
+    std::vector<unsigned long> aggPoints;     /*!< \brief Points of this level grouped by aggregate. */
+    std::vector<unsigned long> galerkinMap;   /*!< \brief Non zero of the next level to which each non zero contributes. */
+
+    mutable std::vector<ScalarType> sol;      /*!< \brief Solution (correction) vector (coarse levels). */
+    mutable std::vector<ScalarType> rhs;      /*!< \brief Right hand side (coarse levels). */
+    mutable std::vector<ScalarType> res;      /*!< \brief Residual vector. */
+
+    unsigned long nParts() const { return partitions.size()-1; }
+  };
+
+  std::vector<CLevel> levels;     /*!< \brief The hierarchy, the first level is the input matrix. */
+  unsigned short nLevels = 0;     /*!< \brief Number of levels actually in use. */
+  unsigned short nSweeps = 1;     /*!< \brief Number of pre- and post-smoothing sweeps. */
+  passivedouble strength = 0.08;  /*!< \brief Strength of connection threshold (fine level). */
+  bool coarsen = false;           /*!< \brief Shared flag used to stop the coarsening. */
+
+  /*!
+   * \brief Create the next level by aggregation of "iLevel".
+   * \return True if the coarse level was created.
+   */
+  bool Coarsen(const CSysMatrix<ScalarType>& mat, unsigned short iLevel);
+
+  /*!
+   * \brief Compute the values of the coarse operator of "iLevel" (which must be > 0).
+   */
+  void ComputeGalerkinProduct(const CSysMatrix<ScalarType>& mat, unsigned short iLevel);
+
+  /*!
+   * \brief Block Gauss-Seidel sweep starting from a zero solution, within each thread partition.
+   * \param[in] forward - Direction of the sweep.
+   * \param[in] rhs - Right hand side.
+   * \param[out] sol - Solution after the sweep.
+   */
+  void Smooth(const CSysMatrix<ScalarType>& mat, unsigned short iLevel, bool forward,
+              const ScalarType* rhs, ScalarType* sol) const;
+
+  /*!
+   * \brief Compute res = rhs - A*sol on "iLevel".
+   */
+  void Residual(const CSysMatrix<ScalarType>& mat, unsigned short iLevel,
+                const ScalarType* rhs, const ScalarType* sol, ScalarType* res) const;
+
+  /*!
+   * \brief Recursive V-cycle, the solution is assumed to be zero on entry.
+   */
+  void Cycle(const CSysMatrix<ScalarType>& mat, unsigned short iLevel, const ScalarType* rhs, ScalarType* sol) const;
+
+public:
+  /*!
+   * \brief Build the hierarchy (aggregation on the first call) and the coarse operators.
+   * \note Must be called by all threads.
+   * \param[in] mat - The fine level matrix.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(const CSysMatrix<ScalarType>& mat, const CConfig* config);
+
+  /*!
+   * \brief Apply one V-cycle to "vec" (zero initial guess), storing the result in "prod".
+   * \note Halos of "prod" are not updated.
+   */
+  void Apply(const CSysMatrix<ScalarType>& mat, const CSysVector<ScalarType>& vec,
+             CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Number of levels in the hierarchy, including the fine level.
+   */
+  inline unsigned short GetNumLevels() const { return nLevels; }
+};
@@ -0,0 +1,175 @@
+/*!
+ * \file CCompressedBlocks.hpp
+ * \brief Storage of the small dense blocks of a block-sparse matrix in 16 bit floating point formats.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../option_structure.hpp"
+#include "../basic_types/datatype_structure.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <vector>
+
+/*!
+ * \class CCompressedBlocks
+ * \ingroup SpLinSys
+ * \brief Stores the blocks of a block-sparse matrix (or of its factors) in a 16 bit floating point
+ *        format, FLOAT16 (IEEE half) or BFLOAT16, with one scaling factor per block.
+ * \note The entries of a block are divided by the largest magnitude in the block, so they are in [-1, 1].
+ *       This keeps FLOAT16 (small exponent range) away from overflow and makes the accuracy of the largest
+ *       entries independent of the magnitude of the block. The blocks are decompressed on the fly in the
+ *       products, conversions are done in software (round to nearest even) for portability.
+ */
+template<class ScalarType>
+class CCompressedBlocks {
+private:
+  BLOCK_COMPRESSION format = BLOCK_COMPRESSION::NONE;  /*!< \brief Storage format. */
+  unsigned long nVar = 0, nEqn = 0;                     /*!< \brief Block dimensions. */
+  std::vector<uint16_t> values;                         /*!< \brief Scaled entries of the blocks. */
+  std::vector<float> scales;                            /*!< \brief Scaling factor of each block. */
+
+  static constexpr float TWO_POW_112 = 5.192296858534828e+33f;   /*!< \brief Exponent bias difference of float and half. */
+  static constexpr float TWO_POW_M112 = 1.925929944387236e-34f;
+
+  static FORCEINLINE uint32_t bitsOf(float x) { uint32_t u; memcpy(&u, &x, sizeof(float)); return u; }
+  static FORCEINLINE float floatOf(uint32_t u) { float x; memcpy(&x, &u, sizeof(float)); return x; }
+
+  /*--- BFLOAT16 is the upper half of a float. ---*/
+  static FORCEINLINE uint16_t encodeBFloat16(float x) {
+    uint32_t u = bitsOf(x);
+    u += 0x7fffu + ((u >> 16) & 1u);
+    return static_cast<uint16_t>(u >> 16);
+  }
+  static FORCEINLINE float decodeBFloat16(uint16_t h) { return floatOf(uint32_t(h) << 16); }
+
+  /*--- For FLOAT16 the exponent is re-biased with a multiplication, which also takes care of subnormals.
+   *    Overflow is not handled, which is fine since the scaled values are in [-1, 1]. ---*/
+  static FORCEINLINE uint16_t encodeFloat16(float x) {
+    const uint32_t sign = (bitsOf(x) >> 16) & 0x8000u;
+    uint32_t u = bitsOf(std::fabs(x) * TWO_POW_M112);
+    u += 0x0fffu + ((u >> 13) & 1u);
+    return static_cast<uint16_t>(sign | (u >> 13));
+  }
+  static FORCEINLINE float decodeFloat16(uint16_t h) {
+    return floatOf((uint32_t(h & 0x8000u) << 16) | (uint32_t(h & 0x7fffu) << 13)) * TWO_POW_112;
+  }
+
+  template<bool Half>
+  static FORCEINLINE float decode(uint16_t h) { return Half ? decodeFloat16(h) : decodeBFloat16(h); }
+
+  /*!
+   * \brief prod (+/-)= block * vec, with the block decompressed on the fly.
+   */
+  template<bool Half, bool Sub>
+  FORCEINLINE void MatVecImpl(unsigned long iBlock, const ScalarType* vec, ScalarType* prod) const {
+    const uint16_t* val = &values[iBlock*nVar*nEqn];
+    const ScalarType scale = Sub ? -scales[iBlock] : scales[iBlock];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      ScalarType sum = 0.0;
+      for (auto jVar = 0ul; jVar < nEqn; ++jVar)
+        sum += decode<Half>(val[iVar*nEqn+jVar]) * vec[jVar];
+      prod[iVar] += scale * sum;
+    }
+  }
+
+public:
+  /*!
+   * \brief Allocate storage for a number of blocks.
+   * \note Only the master thread should call this (same as CSysMatrix::Initialize).
+   * \param[in] type - Storage format, with NONE nothing is allocated.
+   * \param[in] nBlocks - Number of blocks.
+   * \param[in] nvar - Number of rows of the blocks.
+   * \param[in] neqn - Number of columns of the blocks.
+   */
+  void Initialize(BLOCK_COMPRESSION type, unsigned long nBlocks, unsigned long nvar, unsigned long neqn) {
+    format = type;
+    if (format == BLOCK_COMPRESSION::NONE) return;
+    nVar = nvar;
+    nEqn = neqn;
+    values.resize(nBlocks*nVar*nEqn);
+    scales.resize(nBlocks);
+  }
+
+  /*!
+   * \brief Whether the blocks are stored (i.e. the format is not NONE).
+   */
+  inline bool IsActive() const { return format != BLOCK_COMPRESSION::NONE; }
+
+  /*!
+   * \brief Compress and store a block.
+   * \param[in] iBlock - Index of the block.
+   * \param[in] block - Values of the block (row major).
+   */
+  void Compress(unsigned long iBlock, const ScalarType* block) {
+    const auto blkSz = nVar*nEqn;
+    float maxVal = 0.0f;
+    for (auto k = 0ul; k < blkSz; ++k)
+      maxVal = std::max(maxVal, static_cast<float>(std::fabs(SU2_TYPE::GetValue(block[k]))));
+
+    scales[iBlock] = maxVal;
+    const float invScale = (maxVal > 0.0f) ? 1.0f / maxVal : 0.0f;
+    uint16_t* val = &values[iBlock*blkSz];
+
+    for (auto k = 0ul; k < blkSz; ++k) {
+      const float x = static_cast<float>(SU2_TYPE::GetValue(block[k])) * invScale;
+      val[k] = (format == BLOCK_COMPRESSION::FLOAT16) ? encodeFloat16(x) : encodeBFloat16(x);
+    }
+  }
+
+  /*!
+   * \brief Decompress a block.
+   * \param[in] iBlock - Index of the block.
+   * \param[out] block - Values of the block (row major).
+   */
+  FORCEINLINE void Decompress(unsigned long iBlock, ScalarType* block) const {
+    const auto blkSz = nVar*nEqn;
+    const uint16_t* val = &values[iBlock*blkSz];
+    const float scale = scales[iBlock];
+    if (format == BLOCK_COMPRESSION::FLOAT16) {
+      for (auto k = 0ul; k < blkSz; ++k) block[k] = scale * decodeFloat16(val[k]);
+    } else {
+      for (auto k = 0ul; k < blkSz; ++k) block[k] = scale * decodeBFloat16(val[k]);
+    }
+  }
+
+  /*!
+   * \brief prod += block * vec.
+   */
+  FORCEINLINE void MatVecAdd(unsigned long iBlock, const ScalarType* vec, ScalarType* prod) const {
+    if (format == BLOCK_COMPRESSION::FLOAT16) MatVecImpl<true, false>(iBlock, vec, prod);
+    else MatVecImpl<false, false>(iBlock, vec, prod);
+  }
+
+  /*!
+   * \brief prod -= block * vec.
+   */
+  FORCEINLINE void MatVecSub(unsigned long iBlock, const ScalarType* vec, ScalarType* prod) const {
+    if (format == BLOCK_COMPRESSION::FLOAT16) MatVecImpl<true, true>(iBlock, vec, prod);
+    else MatVecImpl<false, true>(iBlock, vec, prod);
+  }
+};
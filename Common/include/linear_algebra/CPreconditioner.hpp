@@ -179,6 +179,57 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses CSysMatrix class.
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  const CConfig *config;                 /*!< \brief Pointer to problem configuration. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, const CConfig *config_ref) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner(config);
+  }
+};
+
+
 /*!
  * \class CLU_SGSPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
@@ -221,6 +272,13 @@ public:
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
     sparse_matrix.ComputeLU_SGSPreconditioner(u, v, geometry, config);
   }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildLU_SGSPreconditioner();
+  }
 };
 
 
@@ -329,6 +387,60 @@ public:
 };
 
 
+
+/*!
+ * \class CSparseDirectPreconditioner
+ * \brief Specialization of preconditioner that uses the built-in sparse direct solver to factorize a CSysMatrix.
+ */
+template<class ScalarType>
+class CSparseDirectPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to the matrix. */
+  CGeometry* geometry;                   /*!< \brief Geometry associated with the problem. */
+  const CConfig *config;                 /*!< \brief Configuration of the problem. */
+  unsigned short kind_fact;              /*!< \brief The type of factorization desired. */
+
+public:
+  /*!
+   * \brief Constructor of the class
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Associated geometry.
+   * \param[in] config_ref - Problem configuration.
+   * \param[in] kind_factorization - Type of factorization required.
+   */
+  inline CSparseDirectPreconditioner(CSysMatrix<ScalarType> & matrix_ref, CGeometry *geometry_ref,
+                                     const CConfig *config_ref, unsigned short kind_factorization) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+    kind_fact = kind_factorization;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CSparseDirectPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeSparseDirectPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildSparseDirectPreconditioner(config, kind_fact);
+  }
+};
+
 template<class ScalarType>
 CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOLVER_PREC kind,
                                                                  CSysMatrix<ScalarType>& jacobian,
@@ -340,7 +452,7 @@ CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOL
     case JACOBI:
       prec = new CJacobiPreconditioner<ScalarType>(jacobian, geometry, config);
       break;
-    case LINELET:
+    case LINELET: case LINELET_ILU:
       prec = new CLineletPreconditioner<ScalarType>(jacobian, geometry, config);
       break;
     case LU_SGS:
@@ -349,9 +461,15 @@ CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(ENUM_LINEAR_SOL
     case ILU:
       prec = new CILUPreconditioner<ScalarType>(jacobian, geometry, config);
       break;
+    case AMG:
+      prec = new CAMGPreconditioner<ScalarType>(jacobian, geometry, config);
+      break;
     case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
       prec = new CPastixPreconditioner<ScalarType>(jacobian, geometry, config, kind);
       break;
+    case SPARSE_LU_P: case SPARSE_LDLT_P:
+      prec = new CSparseDirectPreconditioner<ScalarType>(jacobian, geometry, config, kind);
+      break;
   }
 
   return prec;
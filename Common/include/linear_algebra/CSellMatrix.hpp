@@ -0,0 +1,106 @@
+/*!
+ * \file CSellMatrix.hpp
+ * \brief Sliced ELLPACK (SELL-C-sigma) copy of a block-sparse matrix for SIMD matrix-vector products.
+ *        The implementation is in <i>CSellMatrix.cpp</i>.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSysVector.hpp"
+#include "../parallelization/vectorization.hpp"
+#include <vector>
+
+template<class T> class CSysMatrix;
+
+/*!
+ * \class CSellMatrix
+ * \ingroup SpLinSys
+ * \brief Sliced ELLPACK (SELL-C-sigma) copy of a CSysMatrix, used to vectorize the matrix-vector
+ *        product across rows, which is more efficient than the row-wise CSR product for small blocks.
+ * \note The rows are grouped in slices of C rows (the SIMD length of ScalarType). The k-th blocks of
+ *       the rows of a slice are stored together, interleaved coefficient by coefficient, and shorter
+ *       rows are padded with zero blocks. To reduce the padding, rows are sorted by length within
+ *       windows of sigma rows. The diagonal block is the first entry of every row, only the
+ *       off-diagonal part can require padding.
+ *       The rows are split in two groups (rows sent to other ranks, and inner rows), which are
+ *       sliced separately to allow overlapping the product with the halo exchange.
+ *       The layout is created once from the sparse pattern, the values are copied by UpdateValues.
+ */
+template<class ScalarType>
+class CSellMatrix {
+public:
+  enum : unsigned long { C = simd::preferredLen<ScalarType>() };  /*!< \brief Number of rows per slice. */
+
+private:
+  enum : unsigned long { SIGMA = 32*C };      /*!< \brief Size of the windows where rows are sorted by length. */
+  enum : unsigned long { PADDING = ~0ul };    /*!< \brief Marker for padding rows and entries. */
+  enum : unsigned long { MAXNVAR = 20 };      /*!< \brief Same limit as CSysMatrix. */
+  enum { OMP_MIN_SIZE = 8 };                  /*!< \brief Chunk size (in slices) of the parallel loops. */
+
+  unsigned long nVar = 0, nEqn = 0;           /*!< \brief Block dimensions. */
+  bool valid = false;                         /*!< \brief If the values are up to date with the matrix. */
+
+  unsigned long groupPtr[3] = {0, 0, 0};      /*!< \brief First slice of each group of rows. */
+  std::vector<unsigned long> slicePtr;        /*!< \brief First entry (column of blocks) of each slice. */
+  std::vector<unsigned long> sliceRows;       /*!< \brief Row of the matrix for each lane of each slice. */
+  std::vector<unsigned long> colIdx;          /*!< \brief Block column of each lane of each entry. */
+  std::vector<unsigned long> nzIdx;           /*!< \brief Non zero of the matrix for each lane of each entry. */
+  std::vector<ScalarType> values;             /*!< \brief Values of the blocks, interleaved by lane. */
+
+public:
+  /*!
+   * \brief Create the layout from the sparse pattern of the matrix, the values are not copied.
+   * \note Only the master thread should call this (same as CSysMatrix::Initialize).
+   *       The groups of rows are the send and inner rows of the matrix, if it does not exchange
+   *       halos all rows are in the first group.
+   * \param[in] mat - The matrix.
+   */
+  void Initialize(const CSysMatrix<ScalarType>& mat);
+
+  /*!
+   * \brief Copy the values of the matrix into the SELL layout, must be called by all threads.
+   * \note Does nothing if the values are still valid, i.e. the matrix was not modified since the last update.
+   */
+  void UpdateValues(const CSysMatrix<ScalarType>& mat);
+
+  /*!
+   * \brief Mark the values as out of date, e.g. when the matrix is being assembled again.
+   * \note Must be called by one thread.
+   */
+  inline void Invalidate() { valid = false; }
+
+  /*!
+   * \brief Whether the layout exists and the values are up to date.
+   */
+  inline bool IsValid() const { return valid; }
+
+  /*!
+   * \brief Compute the product of the rows of one group, prod = A * vec, must be called by all threads.
+   * \note Halos of "prod" are not updated.
+   * \param[in] vec - Vector to multiply.
+   * \param[out] prod - Result of the product.
+   * \param[in] iGroup - Group of rows (0 or 1).
+   */
+  void Product(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, unsigned long iGroup) const;
+};
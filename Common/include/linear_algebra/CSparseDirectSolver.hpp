@@ -0,0 +1,115 @@
+/*!
+ * \file CSparseDirectSolver.hpp
+ * \brief Built-in sparse direct (LU and LDL^T) factorization of block-sparse matrices.
+ *        The implementation is in <i>CSparseDirectSolver.cpp</i>.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CSysVector.hpp"
+#include <vector>
+
+class CConfig;
+template<class T> class CSysMatrix;
+
+/*!
+ * \class CSparseDirectSolver
+ * \ingroup SpLinSys
+ * \brief Complete block LU (or LDL^T for symmetric matrices) factorization of the domain part of a CSysMatrix.
+ * \note The points are ordered by nested dissection (METIS_NodeND when available, otherwise recursive
+ *       bisection by level sets), the elimination tree and the pattern of the factors are computed once
+ *       (symbolic factorization) and kept while the sparse pattern of the matrix is the same. The blocks of
+ *       the matrix are the "supernodes" of the factorization, all operations are done with the dense block
+ *       kernels of CSysMatrix. The numerical factorization is only repeated every "factorization frequency"
+ *       builds, the old factors are used in between (e.g. across load steps of structural problems).
+ *       Halo columns are ignored, i.e. on more than one rank the method is additive (block Jacobi) and it
+ *       should be used as the preconditioner of a Krylov method, which is what the SPARSE_LU / SPARSE_LDLT
+ *       linear solvers do. Without pivoting (other than inside the blocks) the matrix should be (block)
+ *       diagonally dominant or positive definite, which is the case for the FEA and mesh deformation systems.
+ */
+template<class ScalarType>
+class CSparseDirectSolver {
+private:
+  enum : unsigned long { NOT_SET = ~0ul };   /*!< \brief Marker for unset indices. */
+  enum { ND_LEAF_SIZE = 64 };                /*!< \brief Subgraphs with fewer points are not dissected further. */
+
+  unsigned long nPoint = 0;             /*!< \brief Number of rows (domain points) of the factorized matrix. */
+  unsigned long nVar = 0;               /*!< \brief Size of the blocks. */
+  bool symmetric = false;               /*!< \brief LDL^T, only the upper factor is stored. */
+  bool factorized = false;              /*!< \brief The numerical factorization is available. */
+  unsigned long nBuilds = 0;            /*!< \brief Number of calls to Build, to decide when to re-factorize. */
+  const unsigned long* patternRef = nullptr; /*!< \brief Row pointer of the matrix, to detect changes of pattern. */
+
+  std::vector<unsigned long> perm;      /*!< \brief Permutation, new (factor) index to old (matrix) index. */
+  std::vector<unsigned long> iperm;     /*!< \brief Inverse permutation, old index to new index. */
+
+  std::vector<unsigned long> Lptr, Lcol;  /*!< \brief Pattern of the strictly lower factor (by rows, sorted columns). */
+  std::vector<unsigned long> Uptr, Ucol;  /*!< \brief Pattern of the strictly upper factor (by rows, sorted columns). */
+  std::vector<unsigned long> LtoU;        /*!< \brief Position in U of the transpose of each L entry (LDL^T). */
+  std::vector<ScalarType> Lval;           /*!< \brief Blocks of the (unit) lower factor, not used for LDL^T. */
+  std::vector<ScalarType> Uval;           /*!< \brief Blocks of the strictly upper factor. */
+  std::vector<ScalarType> invD;           /*!< \brief Inverse of the diagonal blocks (pivots) of the factors. */
+  mutable std::vector<ScalarType> work;   /*!< \brief Permuted right hand side / solution. */
+
+  /*!
+   * \brief Nested dissection ordering of the graph of the domain points.
+   */
+  void Order(const CSysMatrix<ScalarType>& mat);
+
+  /*!
+   * \brief Elimination tree and patterns of the factors (in the permuted numbering).
+   */
+  void SymbolicFactorization(const CSysMatrix<ScalarType>& mat);
+
+  /*!
+   * \brief Numerical factorization (up-looking, one row of the factors at a time).
+   */
+  void NumericFactorization(const CSysMatrix<ScalarType>& mat);
+
+public:
+  /*!
+   * \brief Factorize the matrix (ordering and symbolic factorization only on the first call or if the pattern changes).
+   * \note Must be called by all threads.
+   * \param[in] mat - The matrix.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] ldlt - Use the symmetric factorization.
+   */
+  void Build(const CSysMatrix<ScalarType>& mat, const CConfig* config, bool ldlt);
+
+  /*!
+   * \brief Solve the factorized system, prod = A^-1 * vec.
+   * \note Halos of "prod" are not updated.
+   */
+  void Solve(const CSysMatrix<ScalarType>& mat, const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Force a numerical factorization on the next build, e.g. when the matrix is transposed.
+   */
+  inline void Invalidate() { factorized = false; }
+
+  /*!
+   * \brief Number of non zero blocks of the factors (including the diagonal).
+   */
+  inline unsigned long GetNnzFactors() const { return Lcol.size() + Ucol.size() + nPoint; }
+};
@@ -31,6 +31,10 @@
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
+#include "CSparseDirectSolver.hpp"
+#include "CSellMatrix.hpp"
+#include "CCompressedBlocks.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -112,12 +116,16 @@ template<class ScalarType>
 class CSysMatrix {
 private:
   friend struct CSysMatrixComms;
+  friend class CAlgebraicMultigrid<ScalarType>;
+  friend class CSparseDirectSolver<ScalarType>;
+  friend class CSellMatrix<ScalarType>;
 
   const int rank;     /*!< \brief MPI Rank. */
   const int size;     /*!< \brief MPI Size. */
 
   enum : size_t { MAXNVAR = 20 };   /*!< \brief Maximum number of variables the matrix can handle. The static
                                                 size is needed for fast, per-thread, static memory allocation. */
+  enum : unsigned short { MAXFIXEDNVAR = 7 }; /*!< \brief Largest block size with compile-time specialized kernels. */
 
   enum { OMP_MAX_SIZE_L = 8192 };   /*!< \brief Max. chunk size used in light parallel for loops. */
   enum { OMP_MAX_SIZE_H = 512 };    /*!< \brief Max. chunk size used in heavy parallel for loops. */
@@ -131,6 +139,7 @@ private:
   unsigned long nPointDomain;       /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;               /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;               /*!< \brief Number of equations (and columns of the blocks). */
+  unsigned short fixedBlockSize;    /*!< \brief Block size of the row loops specialized for it, 0 if the generic ones are used. */
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -146,12 +155,26 @@ private:
   const unsigned long *col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  vector<unsigned long> ilu_lower_level_ptr;  /*!< \brief Start of each level of the ILU forward substitution (and factorization). */
+  vector<unsigned long> ilu_lower_levels;     /*!< \brief Rows in each level of the ILU forward substitution. */
+  vector<unsigned long> ilu_upper_level_ptr;  /*!< \brief Start of each level of the ILU backward substitution. */
+  vector<unsigned long> ilu_upper_levels;     /*!< \brief Rows in each level of the ILU backward substitution. */
+
   ScalarType *invM;                 /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
-  /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
-  mutable vector<vector<const ScalarType*> > LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletInvDiag;      /*!< \brief Inverse of the diagonal blocks of the tri-diag system (working memory). */
-  mutable vector<vector<ScalarType> > LineletVector;       /*!< \brief Solution and RHS of the tri-diag system (working memory). */
+  CCompressedBlocks<ScalarType> ILU_compressed;    /*!< \brief Off-diagonal blocks of the ILU factors in 16 bit format (replaces ILU_matrix). */
+  CCompressedBlocks<ScalarType> LU_SGS_compressed; /*!< \brief 16 bit copy of the off-diagonal blocks of the matrix for the LU_SGS sweeps. */
+  vector<ScalarType> ILU_row_work;  /*!< \brief Per thread storage for the row being factorized when the ILU factors are compressed. */
+  unsigned long ilu_row_work_size;  /*!< \brief Size of the work row of each thread. */
+
+  vector<unsigned long> send_rows;  /*!< \brief Rows of the domain that are sent to other ranks in the halo exchange. */
+  vector<unsigned long> inner_rows; /*!< \brief Rows of the domain that are only needed locally. */
+
+  /*--- The Linelet preconditioner stores the inverse of the modified diagonal blocks of the tri-diag systems in invM.
+   *    The buffers are used to exchange data between linelets that continue on other ranks (one block per link). ---*/
+  mutable vector<ScalarType> LineletNextBuf; /*!< \brief Data exchanged with the next linelets (working memory). */
+  mutable vector<ScalarType> LineletPrevBuf; /*!< \brief Data exchanged with the previous linelets (working memory). */
+  bool linelet_ilu = false;                  /*!< \brief ILU on the points that are not on linelets (LINELET_ILU). */
 
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
@@ -169,6 +192,12 @@ private:
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg_hierarchy; /*!< \brief Levels of the AMG preconditioner. */
+
+  CSparseDirectSolver<ScalarType> sparse_direct; /*!< \brief Built-in sparse direct factorization. */
+
+  CSellMatrix<ScalarType> sell_matrix;           /*!< \brief SELL-C-sigma copy of the matrix for matrix-vector products. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -201,6 +230,14 @@ private:
   template<class SrcType>
   FORCEINLINE static ScalarType PassiveAssign(const SrcType& val) { return SU2_TYPE::GetValue(val); }
 
+  /*!
+   * \brief Compile-time block size. The row loops of the products and of the preconditioner sweeps take the
+   *        block size as their first argument, they are instantiated for fixedBlockSize (the dense kernels
+   *        are then unrolled), or for the runtime size (unsigned long) when it is 0.
+   */
+  template<unsigned long N>
+  using FixedBlockSize = std::integral_constant<unsigned long, N>;
+
   /*!
    * \brief Calculates the matrix-vector product: product = matrix*vector
    * \param[in] matrix
@@ -225,6 +262,25 @@ private:
    */
   void MatrixVectorProductSub(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+  /*!
+   * \brief Matrix-vector products of the row loops, with the block size of the loop.
+   */
+  template<unsigned long N>
+  inline void MatrixVectorProduct(FixedBlockSize<N>, const ScalarType *matrix, const ScalarType *vector,
+                                  ScalarType *product) const;
+  inline void MatrixVectorProduct(unsigned long, const ScalarType *matrix, const ScalarType *vector,
+                                  ScalarType *product) const;
+  template<unsigned long N>
+  inline void MatrixVectorProductAdd(FixedBlockSize<N>, const ScalarType *matrix, const ScalarType *vector,
+                                     ScalarType *product) const;
+  inline void MatrixVectorProductAdd(unsigned long, const ScalarType *matrix, const ScalarType *vector,
+                                     ScalarType *product) const;
+  template<unsigned long N>
+  inline void MatrixVectorProductSub(FixedBlockSize<N>, const ScalarType *matrix, const ScalarType *vector,
+                                     ScalarType *product) const;
+  inline void MatrixVectorProductSub(unsigned long, const ScalarType *matrix, const ScalarType *vector,
+                                     ScalarType *product) const;
+
   /*!
    * \brief Calculates the matrix-matrix product
    */
@@ -270,13 +326,22 @@ private:
    */
   void MatrixInverse(ScalarType *matrix, ScalarType *inverse) const;
 
+  /*!
+   * \brief Gaussian elimination of the row loops, with the block size of the loop.
+   */
+  template<unsigned long N>
+  void Gauss_Elimination(FixedBlockSize<N>, ScalarType* matrix, ScalarType* vec) const;
+  void Gauss_Elimination(unsigned long, ScalarType* matrix, ScalarType* vec) const { Gauss_Elimination(matrix, vec); }
+
   /*!
    * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i,i) subblock and rhs.
+   * \param[in] n - Block size (see FixedBlockSize).
    * \param[in] block_i - Index of the (i,i) diagonal block.
    * \param[in] rhs - Right-hand-side of the linear system.
    * \return Solution of the linear system (overwritten on rhs).
    */
-  inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const;
+  template<class Size>
+  inline void Gauss_Elimination(Size n, unsigned long block_i, ScalarType* rhs) const;
 
   /*!
    * \brief Inverse diagonal block.
@@ -309,39 +374,129 @@ private:
 
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
+   * \param[in] n - Block size (see FixedBlockSize).
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
-  inline void UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
+  template<class Size>
+  inline void UpperProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_ub, ScalarType *prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the lower part of a sparse matrix by a vector.
+   * \param[in] n - Block size (see FixedBlockSize).
    * \param[in] vec - Vector to be multiplied by the lower part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
-  inline void LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
+  template<class Size>
+  inline void LowerProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_lb, ScalarType *prod) const;
 
   /*!
    * \brief Performs the product of i-th row of the diagonal part of a sparse matrix by a vector.
+   * \param[in] n - Block size (see FixedBlockSize).
    * \param[in] vec - Vector to be multiplied by the diagonal part of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
-  inline void DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<class Size>
+  inline void DiagonalProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
   /*!
    * \brief Performs the product of i-th row of a sparse matrix by a vector.
+   * \param[in] n - Block size (see FixedBlockSize).
    * \param[in] vec - Vector to be multiplied by the row of the sparse matrix A.
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return Result of the product (stored at *prod_row_vector).
    */
-  void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<class Size>
+  inline void RowProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+
+  /*!
+   * \brief Compute the level schedule of the ILU factorization and substitutions.
+   * \note Rows in the same level do not depend on each other and can be processed in parallel.
+   */
+  void SetILULevelSchedule();
+
+  /*!
+   * \brief Factorize the ILU matrix (of the entire domain) with level scheduling.
+   */
+  void BuildILUWithLevels();
+
+  /*!
+   * \brief Apply the ILU preconditioner (of the entire domain) with level scheduling, halos are not updated.
+   * \param[in] n - Block size (see FixedBlockSize).
+   */
+  template<class Size>
+  void ComputeILUWithLevels(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Apply the ILU preconditioner of the sub matrices of the threads, halos are not updated.
+   * \param[in] n - Block size (see FixedBlockSize).
+   */
+  template<class Size>
+  void ComputeILUPartitions(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  /*!
+   * \brief Row loop of the CSR matrix-vector product (see MatrixVectorProduct).
+   * \param[in] n - Block size (see FixedBlockSize).
+   */
+  template<class Size>
+  void RowProducts(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                   CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Forward and backward sweeps of the LU_SGS preconditioner (see ComputeLU_SGSPreconditioner).
+   * \param[in] n - Block size (see FixedBlockSize).
+   */
+  template<class Size>
+  void LU_SGSSweeps(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                    CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Factorize a row of the ILU matrix and store its off-diagonal blocks in compressed format.
+   * \note The row is gathered from the matrix and factorized in a full precision work row, the upper
+   *       parts of the rows it depends on are decompressed on the fly. Only columns in [begin, end[
+   *       are considered, the rows it depends on must have been factorized.
+   * \param[in] iPoint - Row to factorize.
+   * \param[in] begin - First row/column of the sub matrix being factorized.
+   * \param[in] end - Last row/column (exclusive) of the sub matrix.
+   * \param[in] row - Work memory for the blocks of the row.
+   */
+  void FactorizeCompressedILURow(unsigned long iPoint, unsigned long begin, unsigned long end, ScalarType* row);
+
+  /*!
+   * \brief prod -= block * vec, for a block of the ILU factors (compressed or not).
+   * \param[in] n - Block size (see FixedBlockSize).
+   * \param[in] index - Position of the block in the ILU sparse pattern.
+   */
+  template<class Size>
+  inline void ILUBlockProductSub(Size n, unsigned long index, const ScalarType *vec, ScalarType *prod) const;
+
+  /*!
+   * \brief prod += block * vec, for an off-diagonal block used in the LU_SGS sweeps (compressed or not).
+   * \param[in] n - Block size (see FixedBlockSize).
+   * \param[in] index - Position of the block in the sparse pattern.
+   */
+  template<class Size>
+  inline void LU_SGSBlockProductAdd(Size n, unsigned long index, const ScalarType *vec, ScalarType *prod) const;
+
+  /*!
+   * \brief Apply a row-wise operation to all rows of the domain and update the halos of the result.
+   * \note The rows that other ranks need are computed first, the remaining rows are computed while
+   *       the halo exchange is in progress. Must be called by all threads.
+   * \param[in] rowOp - Operation to apply to each row, e.g. a row product.
+   * \param[in,out] prod - Vector where "rowOp" writes its results, its halos are updated.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class RowOperation>
+  void RowLoopWithComms(const RowOperation& rowOp, CSysVector<ScalarType> & prod,
+                        CGeometry *geometry, const CConfig *config) const;
 
 public:
 
@@ -578,7 +733,7 @@ public:
 
   /*!
    * \brief SIMD version, does the update for multiple edges and points.
-   * \note Nothing is updated if the mask is 0.
+   * \note Nothing is updated if the mask is 0, the indices of those lanes are not accessed.
    */
   template<class MatTypeSIMD, size_t N, class I, class F = ScalarType>
   FORCEINLINE void UpdateBlocks(simd::Array<I,N> iEdge, simd::Array<I,N> iPoint, simd::Array<I,N> jPoint,
@@ -670,7 +825,7 @@ public:
 
   /*!
    * \brief SIMD version, does the update for multiple edges.
-   * \note Nothing is updated if the mask is 0.
+   * \note Nothing is updated if the mask is 0, the indices of those lanes are not accessed.
    */
   template<class MatTypeSIMD, size_t N, class I, class F = ScalarType>
   FORCEINLINE void SetBlocks(simd::Array<I,N> iEdge, const MatTypeSIMD& block_i,
@@ -747,6 +902,39 @@ public:
     AddBlock2Diag(block_i, val_block, -1.0);
   }
 
+  /*!
+   * \brief SIMD version of SubtractBlock2Diag, updates the diagonal blocks of multiple points.
+   * \note Nothing is updated if the mask is 0, the indices of those lanes are not accessed.
+   */
+  template<class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void SubtractBlock2Diag(simd::Array<I,N> iPoint, const MatTypeSIMD& block, simd::Array<F,N> mask = 1) {
+
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar*nEqn);
+
+    /*--- "Transpose" the blocks, scale, and possibly convert types. ---*/
+    ScalarType blk[N][blkSz];
+
+    for (size_t i=0; i<blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k=0; k<N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k=0; k<N; ++k) {
+      if (mask[k]==0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]]*blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i=0; i<blkSz; ++i) bii[i] -= blk[k][i];
+    }
+  }
+
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
    *        of the matrix-by-blocks structure.
@@ -830,6 +1018,26 @@ public:
    */
   void MatrixMatrixAddition(ScalarType alpha, const CSysMatrix& B);
 
+  /*!
+   * \brief Copy the values of the matrix to the SELL-C-sigma format used in matrix-vector products.
+   * \note Must be called by all threads once the matrix is assembled, does nothing if the format is not
+   *       enabled (LINEAR_SOLVER_SELL_FORMAT). Until then, and after SetValZero, the CSR product is used.
+   *       The values are only copied again after the matrix is rebuilt (SetValZero), transposed, or
+   *       modified by MatrixMatrixAddition, modifications of individual blocks after a solve (without
+   *       SetValZero) require a call to InvalidateSELLValues.
+   */
+  inline void UpdateSELLValues() { sell_matrix.UpdateValues(*this); }
+
+  /*!
+   * \brief Mark the SELL-C-sigma values as out of date, they are copied again by the next UpdateSELLValues.
+   */
+  inline void InvalidateSELLValues() {
+    SU2_OMP_MASTER
+    sell_matrix.Invalidate();
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
@@ -870,6 +1078,28 @@ public:
   void ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                 CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner.
+   * \note The aggregates are computed on the first call, subsequent calls only update the coarse operators.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig *config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Build the LU_SGS preconditioner, which only compresses the off-diagonal blocks if required.
+   */
+  void BuildLU_SGSPreconditioner();
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -879,7 +1109,24 @@ public:
                                    CGeometry *geometry, const CConfig *config) const;
 
   /*!
-   * \brief Build the Linelet preconditioner.
+   * \brief Asynchronous (chaotic) relaxation, each thread performs symmetric block Gauss-Seidel sweeps
+   *        on its rows, with relaxation omega, reading the latest values of x computed by other threads.
+   * \note There are no barriers between the local sweeps, which makes the result depend on the relative
+   *       progress of the threads, the vector is synchronized (threads and ranks) at the end.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution, updated in place.
+   * \param[in] nSweeps - Number of local sweeps (each one forward and backward).
+   * \param[in] omega - Relaxation factor.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAsyncRelaxation(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x, unsigned long nSweeps,
+                              ScalarType omega, CGeometry *geometry, const CConfig *config) const;
+
+  /*!
+   * \brief Build the Linelet preconditioner, i.e. factorize the block-tridiagonal systems of the linelets
+   *        (with a distributed Thomas algorithm for linelets that cross ranks), and for LINELET_ILU,
+   *        the ILU of the remaining points.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
@@ -902,6 +1149,34 @@ public:
   void ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
                        CSysVector<ScalarType> & res) const;
 
+  /*!
+   * \brief Compute the linear residual with vectors of a different (usually higher) precision than the matrix.
+   * \note The products are accumulated in the precision of the vectors, the halos of "sol" must be up to date.
+   * \param[in] sol - Solution (x).
+   * \param[in] f - Right hand side (b).
+   * \param[out] res - Residual (Ax-b).
+   */
+  template<class OtherType>
+  void ComputeResidual(const CSysVector<OtherType> & sol, const CSysVector<OtherType> & f,
+                       CSysVector<OtherType> & res) const {
+    SU2_OMP_BARRIER
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      OtherType aux_vec[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = -f[iPoint*nVar+iVar];
+
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        const auto block = &matrix[index*nVar*nEqn];
+        const auto x_j = &sol[col_ind[index]*nEqn];
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          for (auto jVar = 0ul; jVar < nEqn; jVar++)
+            aux_vec[iVar] += OtherType(block[iVar*nEqn+jVar]) * x_j[jVar];
+      }
+      for (auto iVar = 0ul; iVar < nVar; iVar++) res[iPoint*nVar+iVar] = aux_vec[iVar];
+    }
+    END_SU2_OMP_FOR
+  }
+
   /*!
    * \brief Factorize matrix using PaStiX.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -920,4 +1195,21 @@ public:
   void ComputePastixPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                    CGeometry *geometry, const CConfig *config) const;
 
+  /*!
+   * \brief Factorize the matrix with the built-in sparse direct solver (see CSparseDirectSolver).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] kind_fact - Type of factorization (SPARSE_LU_P or SPARSE_LDLT_P).
+   */
+  void BuildSparseDirectPreconditioner(const CConfig *config, unsigned short kind_fact);
+
+  /*!
+   * \brief Apply the built-in sparse direct factorization to CSysVec.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeSparseDirectPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                         CGeometry *geometry, const CConfig *config) const;
+
 };
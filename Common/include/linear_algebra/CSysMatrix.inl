@@ -32,6 +32,22 @@
 
 #include "CSysMatrix.hpp"
 
+template<class ScalarType>
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::ILUBlockProductSub(Size n, unsigned long index, const ScalarType *vec,
+                                                            ScalarType *prod) const {
+  if (ILU_compressed.IsActive()) ILU_compressed.MatVecSub(index, vec, prod);
+  else MatrixVectorProductSub(n, &ILU_matrix[index*nVar*nVar], vec, prod);
+}
+
+template<class ScalarType>
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::LU_SGSBlockProductAdd(Size n, unsigned long index, const ScalarType *vec,
+                                                               ScalarType *prod) const {
+  if (LU_SGS_compressed.IsActive()) LU_SGS_compressed.MatVecAdd(index, vec, prod);
+  else MatrixVectorProductAdd(n, &matrix[index*nVar*nEqn], vec, prod);
+}
+
 template<class ScalarType>
 FORCEINLINE ScalarType *CSysMatrix<ScalarType>::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
   /*--- The position of the diagonal block is known which allows halving the search space. ---*/
@@ -52,12 +68,13 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlock_ILUMatrix(unsigned long block_
 
 namespace {
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T *b, T *c) {
+template<class T, bool alpha, bool beta, bool transp, class SizeN, class SizeM>
+FORCEINLINE void gemv_impl(SizeN n, SizeM m, const T *a, const T *b, T *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
    This is still the traditional "row dot vector" method.
+   The sizes are either integers or std::integral_constant (see FixedBlockSize).
   ---*/
   if (!transp) {
     for (auto i = 0ul; i < n; i++) {
@@ -73,9 +90,9 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T
   }
 }
 
-template<class T>
-FORCEINLINE void gemm_impl(unsigned long n, const T *a, const T *b, T *c) {
-  /*--- Same deal as for GEMV but here only the type is templated. ---*/
+template<class T, class Size>
+FORCEINLINE void gemm_impl(Size n, const T *a, const T *b, T *c) {
+  /*--- Same deal as for GEMV but here only the type (and size) is templated. ---*/
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
@@ -142,14 +159,37 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *m
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
+/*--- Kernels of the row loops, the compile-time sizes are only used without MKL (see Initialize). ---*/
+
+#define __SIZED_MATVECPROD__(NAME,ALPHA,BETA) \
+template<class ScalarType> \
+template<unsigned long N> \
+FORCEINLINE void CSysMatrix<ScalarType>::NAME(FixedBlockSize<N> n, const ScalarType *matrix, \
+                                              const ScalarType *vector, ScalarType *product) const { \
+  gemv_impl<ScalarType,ALPHA,BETA,false>(n, n, matrix, vector, product); \
+} \
+template<class ScalarType> \
+FORCEINLINE void CSysMatrix<ScalarType>::NAME(unsigned long, const ScalarType *matrix, \
+                                              const ScalarType *vector, ScalarType *product) const { \
+  NAME(matrix, vector, product); \
+}
+
+__SIZED_MATVECPROD__(MatrixVectorProduct, true, false)
+__SIZED_MATVECPROD__(MatrixVectorProductAdd, true, true)
+__SIZED_MATVECPROD__(MatrixVectorProductSub, false, true)
+
+#undef __SIZED_MATVECPROD__
+
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs) const {
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(Size n, unsigned long block_i, ScalarType* rhs) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
-  MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block);
+  const auto* diag = &matrix[dia_ptr[block_i]*n*n];
+  for (auto i = 0ul; i < n*n; ++i) block[i] = diag[i];
 
-  Gauss_Elimination(block, rhs);
+  Gauss_Elimination(n, block, rhs);
 }
 
 template<class ScalarType>
@@ -173,19 +213,21 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(Size n, const CSysVector<ScalarType> & vec,
                                                     unsigned long row_i, ScalarType *prod) const {
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     prod[iVar] = 0.0;
 
   for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
     auto col_j = col_ind[index];
-    MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
+    MatrixVectorProductAdd(n, &matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
   }
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_ub, ScalarType *prod) const {
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     prod[iVar] = 0.0;
@@ -194,12 +236,13 @@ FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarTyp
     auto col_j = col_ind[index];
     /*--- Always include halos. ---*/
     if (col_j < col_ub || col_j >= nPointDomain)
-      MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
+      LU_SGSBlockProductAdd(n, index, &vec[col_j*nEqn], prod);
   }
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(Size n, const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_lb, ScalarType *prod) const {
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     prod[iVar] = 0.0;
@@ -207,13 +250,14 @@ FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarTyp
   for (auto index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
     auto col_j = col_ind[index];
     if (col_j >= col_lb)
-      MatrixVectorProductAdd(&matrix[index*nVar*nEqn], &vec[col_j*nEqn], prod);
+      LU_SGSBlockProductAdd(n, index, &vec[col_j*nEqn], prod);
   }
 }
 
 template<class ScalarType>
-FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec,
+template<class Size>
+FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(Size n, const CSysVector<ScalarType> & vec,
                                                          unsigned long row_i, ScalarType *prod) const {
 
-  MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nEqn], &vec[row_i*nEqn], prod);
+  MatrixVectorProduct(n, &matrix[dia_ptr[row_i]*nVar*nEqn], &vec[row_i*nEqn], prod);
 }
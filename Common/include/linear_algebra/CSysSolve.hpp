@@ -76,6 +76,8 @@ public:
   using PrecondType = CPreconditioner<ScalarType>;
 
 private:
+  enum { OMP_MAX_SIZE = 4096 }; /*!< \brief Maximum chunk size used in the parallel loops over vectors. */
+
   const ScalarType eps;      /*!< \brief Machine epsilon used in this class. */
   ScalarType Residual=1e-20; /*!< \brief Residual at the end of a call to Solve or Solve_b. */
   unsigned long Iterations=0;/*!< \brief Iterations done in Solve or Solve_b. */
@@ -96,9 +98,21 @@ private:
 
   mutable std::vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable std::vector<VectorType> AZ; /*!< \brief Large matrix used by pipelined FGMRES, A * z^i. */
+  mutable std::vector<ScalarType> dotBuffer; /*!< \brief Partial and reduced dot products in pipelined FGMRES. */
+
+  std::vector<VectorType> U;      /*!< \brief Recycled subspace of GCRO-DR, kept between solves. */
+  std::vector<VectorType> C;      /*!< \brief Orthonormal image of the recycled subspace, C = A * U. */
+  std::vector<VectorType> Uhat;   /*!< \brief Recycled subspace in the preconditioned space, C = A * M^-1 * Uhat (flexible). */
+  std::vector<VectorType> U_new;  /*!< \brief Work space to update the recycled subspace. */
+  std::vector<VectorType> C_new;  /*!< \brief Work space to update the image of the recycled subspace. */
+  std::vector<VectorType> Uhat_new; /*!< \brief Work space to update the preconditioned recycled subspace. */
+  unsigned long nRecycled = 0;    /*!< \brief Number of valid vectors in U and C. */
+  bool recycledImageValid = false;/*!< \brief False if the matrix or preconditioner changed since U and C were computed. */
 
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
+  CSysVector<su2double> LinSysRes_refine; /*!< \brief Residual (and correction) in the precision of the original vectors, used for iterative refinement. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
   const VectorType* LinSysRes_ptr;  /*!< \brief Pointer to appropriate LinSysRes (set to original or temporary in call to Solve). */
 
@@ -175,6 +189,33 @@ private:
    */
   void ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w) const;
 
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization, with one re-orthogonalization pass if the norm of
+   *        the vector is reduced by more than half (in squared norm) by the first.
+   * \note Each pass uses the fused multi-vector operations of CSysVector, i.e. one pass over the basis and
+   *       one reduction for all the projections, instead of one per vector with modified Gram-Schmidt.
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in,out] Hsbg - the upper Hessenberg begin updated
+   * \param[in,out] w - the (i+1)th vector of w is orthogonalized against the previous vectors in w
+   * \param[in] work - Thread private workspace of size at least 2*(i+2), preallocated by the Krylov method.
+   */
+  void ClassicalGramSchmidt(int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType> & w, ScalarType* work) const;
+
+  /*!
+   * \brief Replace the recycled subspace of GCRO-DR by the harmonic Ritz vectors associated with the
+   *        smallest harmonic Ritz values, over the space spanned by the recycled and Krylov vectors.
+   * \note The augmented Arnoldi relation A*[U, Z] = [C, W] * G is used to compute the new U and C without
+   *       matrix-vector products, G = [I, B; 0, Hbar], where Hbar is the Hessenberg matrix (without rotations).
+   *       The harmonic Ritz problem is posed in the preconditioned space, G'*G*p = theta*G'*[C, W]'*[Uhat, W]*p.
+   * \param[in] n - Number of Krylov iterations performed.
+   * \param[in] Hbar - Hessenberg matrix.
+   * \param[in] B - Projections of the Krylov vectors onto the image of the recycled subspace.
+   * \param[in] basis - Krylov vectors to which the solution corrections belong (Z, or W if not flexible).
+   * \param[in] maxSize - Maximum dimension of the recycled subspace.
+   */
+  void UpdateRecycledSubspace(unsigned long n, const su2matrix<ScalarType>& Hbar, const su2matrix<ScalarType>& B,
+                              const std::vector<VectorType>& basis, unsigned long maxSize);
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -329,6 +370,47 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, const CConfig *config);
 
+  /*!
+   * \brief Pipelined Generalized Minimal Residual method (right preconditioned).
+   * \note All the dot products of an iteration are reduced with a single non-blocking operation, which is
+   *       overlapped with the preconditioner and matrix-vector product of the next iteration. This requires
+   *       storing one more basis than FGMRES, and a linear preconditioner (all the ones available are).
+   *       The orthogonality of the newest basis vector is monitored (at no extra memory traffic), if it is lost
+   *       the vector is corrected with one more Gram-Schmidt pass and that iteration is not overlapped.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                  const PrecondType & precond, ScalarType tol, unsigned long m,
+                                  ScalarType & residual, bool monitoring, const CConfig *config) const;
+
+  /*!
+   * \brief Generalized Conjugate Residual with inner Orthogonalization and Deflated Restarting (GCRO-DR).
+   * \note One cycle of FGMRES on the complement of a recycled subspace, the subspace approximates the
+   *       eigenvectors of the smallest (harmonic Ritz) eigenvalues and it is kept and updated between calls.
+   *       When the matrix changes between calls its image (C = A * U) is recomputed, costing "recycle size"
+   *       matrix-vector products, otherwise it is reused (e.g. the repeated solves of the discrete adjoint).
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long GCRODR_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                 const PrecondType & precond, ScalarType tol, unsigned long m,
+                                 ScalarType & residual, bool monitoring, const CConfig *config);
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -361,6 +443,27 @@ public:
                                    const PrecondType & precond, ScalarType tol, unsigned long m,
                                    ScalarType & residual, bool monitoring, const CConfig *config) const;
 
+  /*!
+   * \brief Asynchronous smoother, the threads relax their rows without barriers (see CSysMatrix::ComputeAsyncRelaxation).
+   * \note The residual is monitored after each iteration, if it does not decrease the iteration is undone and the
+   *       method continues as the (deterministic) generic smoother with the given preconditioner.
+   * \param[in] Jacobian - Matrix of the linear system.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner (of the fallback)
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long AsyncSmoother_LinSolver(const MatrixType & Jacobian, const VectorType & b, VectorType & x,
+                                        const ProductType & mat_vec, const PrecondType & precond, ScalarType tol,
+                                        unsigned long m, ScalarType & residual, bool monitoring,
+                                        CGeometry *geometry, const CConfig *config) const;
+
   /*!
    * \brief Solve the linear system using a Krylov subspace method
    * \param[in] Jacobian - Jacobian Matrix for the linear system
@@ -33,6 +33,8 @@
 #include "../parallelization/vectorization.hpp"
 #include "vector_expressions.hpp"
 
+#include <vector>
+
 /*!
  * \brief OpenMP worksharing construct used in CSysVector for loops.
  * \note The loop will only run in parallel if methods are called from a
@@ -49,9 +51,11 @@
 #else
 #define CSYSVEC_PARFOR SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
 #endif
+#define CSYSVEC_PARFOR_NOSIMD SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
 #define END_CSYSVEC_PARFOR END_SU2_OMP_FOR
 #else
 #define CSYSVEC_PARFOR SU2_OMP_SIMD
+#define CSYSVEC_PARFOR_NOSIMD
 #define END_CSYSVEC_PARFOR
 #endif
 
@@ -84,6 +88,38 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
   void Initialize(unsigned long numBlk, unsigned long numBlkDomain, unsigned long numVar, const ScalarType* val,
                   bool valIsArray, bool errorIfParallel = true);
 
+  /*!
+   * \brief Sum values across threads and ranks (e.g. partial dot products), in place.
+   * \note Must be called by all threads, the result is the same for all threads.
+   * \param[in,out] sums - Partial sums of this thread, on exit the global sums.
+   * \param[in] n - Number of values.
+   */
+  static void reduceSums(ScalarType* sums, unsigned long n) {
+    static std::vector<ScalarType> buffer;
+    /*--- All threads get the same "view" of the shared buffer. ---*/
+    SU2_OMP_SAFE_GLOBAL_ACCESS(buffer.assign(2 * n, ScalarType(0));)
+
+    /*--- Update shared variables with "our" partial sums. ---*/
+    for (auto k = 0ul; k < n; ++k) atomicAdd(sums[k], buffer[k]);
+
+#ifdef HAVE_MPI
+    /*--- Reduce across all mpi ranks, only master thread communicates. ---*/
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Allreduce(buffer.data(), buffer.data() + n, n, mpi_type, MPI_SUM,
+                                                 SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    const auto* result = buffer.data() + n;
+#else
+    /*--- Make view of result consistent across threads. ---*/
+    SU2_OMP_BARRIER
+    const auto* result = buffer.data();
+#endif
+
+    for (auto k = 0ul; k < n; ++k) sums[k] = result[k];
+  }
+
   /*!
    * \brief Helper to unpack (transpose) a SIMD input block.
    */
@@ -337,6 +373,110 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    */
   inline ScalarType norm() const { return sqrt(squaredNorm()); }
 
+  /*!
+   * \brief Dot products between "this" and the first n vectors of a list (e.g. a Krylov basis), computed in a
+   *        single pass over the vectors with a single reduction, the squared norm of "this" is also computed.
+   * \note The partial sums are accumulated directly in res, this is called for every Krylov iteration.
+   * \param[in] u - List of vectors.
+   * \param[in] n - Number of vectors of the list that are used.
+   * \param[out] res - Size n+1, the n dot products followed by the squared norm (should be private to each thread).
+   * \return Squared L2 norm of "this".
+   */
+  template <class VecList>
+  ScalarType multiDot(const VecList& u, unsigned long n, ScalarType* res) const {
+    for (auto k = 0ul; k <= n; ++k) res[k] = 0.0;
+
+    /*--- No simd, the reduction is into an array. ---*/
+    CSYSVEC_PARFOR_NOSIMD
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      const ScalarType val = vec_val[i];
+      for (auto k = 0ul; k < n; ++k) res[k] += val * u[k][i];
+      res[n] += val * val;
+    }
+    END_CSYSVEC_PARFOR
+
+    reduceSums(res, n + 1);
+
+    return res[n];
+  }
+
+  /*!
+   * \brief Update "this" with a linear combination of the first n vectors of a list, this += sum_k alpha_k u_k,
+   *        in a single pass over the vectors.
+   * \param[in] alpha - The n coefficients.
+   * \param[in] u - List of vectors.
+   * \param[in] n - Number of vectors of the list that are used.
+   */
+  template <class VecList>
+  void multiAxpy(const ScalarType* alpha, const VecList& u, unsigned long n) {
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElm; ++i) {
+      ScalarType val = vec_val[i];
+      for (auto k = 0ul; k < n; ++k) val += alpha[k] * u[k][i];
+      vec_val[i] = val;
+    }
+    END_CSYSVEC_PARFOR
+  }
+
+  /*!
+   * \brief Same as multiAxpy, with the squared norm of the result computed in the same pass.
+   * \param[in] alpha - The n coefficients.
+   * \param[in] u - List of vectors.
+   * \param[in] n - Number of vectors of the list that are used.
+   * \return Squared L2 norm of the updated vector.
+   */
+  template <class VecList>
+  ScalarType multiAxpySquaredNorm(const ScalarType* alpha, const VecList& u, unsigned long n) {
+    ScalarType sum = 0.0;
+
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      ScalarType val = vec_val[i];
+      for (auto k = 0ul; k < n; ++k) val += alpha[k] * u[k][i];
+      vec_val[i] = val;
+      sum += val * val;
+    }
+    END_CSYSVEC_PARFOR
+
+    /*--- Same static schedule, the halo entries are updated by the same threads as in other loops. ---*/
+    CSYSVEC_PARFOR
+    for (auto i = nElmDomain; i < nElm; ++i) {
+      for (auto k = 0ul; k < n; ++k) vec_val[i] += alpha[k] * u[k][i];
+    }
+    END_CSYSVEC_PARFOR
+
+    reduceSums(&sum, 1);
+    return sum;
+  }
+
+  /*!
+   * \brief Update "this" with a scaled vector, this += alpha * u, and compute the dot product of the result with
+   *        another vector (which may be "this") in the same pass.
+   * \param[in] alpha - Scale.
+   * \param[in] u - Vector that is added.
+   * \param[in] v - Vector for the dot product.
+   * \return Dot product of the updated vector and v.
+   */
+  ScalarType axpyDot(ScalarType alpha, const CSysVector& u, const CSysVector& v) {
+    ScalarType sum = 0.0;
+
+    CSYSVEC_PARFOR
+    for (auto i = 0ul; i < nElmDomain; ++i) {
+      vec_val[i] += alpha * u.vec_val[i];
+      sum += vec_val[i] * v.vec_val[i];
+    }
+    END_CSYSVEC_PARFOR
+
+    CSYSVEC_PARFOR
+    for (auto i = nElmDomain; i < nElm; ++i) {
+      vec_val[i] += alpha * u.vec_val[i];
+    }
+    END_CSYSVEC_PARFOR
+
+    reduceSums(&sum, 1);
+    return sum;
+  }
+
   /*!
    * \brief Get pointer to a block.
    * \param[in] iPoint - Index of block.
@@ -400,7 +540,7 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
    * \param[in] iPoint - SIMD integer, the positions to update.
    * \param[in] vector - Vector of SIMD scalars.
    * \param[in] mask - Optional scale factor (axpy type operation).
-   * \note Nothing is updated if the mask is 0.
+   * \note Nothing is updated if the mask is 0, the indices of those lanes are not accessed.
    */
   template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
   FORCEINLINE void SetBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
@@ -418,6 +558,26 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Vectorized version of SubtractBlock, updates multiple iPoint's.
+   * \note See SIMD overload of SetBlock.
+   */
+  template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
+  FORCEINLINE void SubtractBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
+    /*--- "Transpose" and scale input vector. ---*/
+    constexpr size_t nVar = VecTypeSIMD::StaticSize;
+    assert(nVar == this->nVar);
+    ScalarType vec[N][nVar];
+    UnpackBlock(vector, mask, vec);
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < nVar; ++i) vec_val[iPoint[k] * nVar + i] -= vec[k][i];
+    }
+  }
+
   /*!
    * \brief Vectorized version of UpdateBlocks, updates multiple i/jPoint's.
    * \note See SIMD overload of SetBlock.
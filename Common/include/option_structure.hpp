@@ -1377,7 +1377,9 @@ enum ENUM_HYBRIDRANSLES {
   SA_DES   = 1,          /*!< \brief Kind of Hybrid RANS/LES (SA - Detached Eddy Simulation (DES)). */
   SA_DDES  = 2,          /*!< \brief Kind of Hybrid RANS/LES (SA - Delayed DES (DDES) with Delta_max SGS ). */
   SA_ZDES  = 3,          /*!< \brief Kind of Hybrid RANS/LES (SA - Delayed DES (DDES) with Vorticity based SGS like Zonal DES). */
-  SA_EDDES = 4           /*!< \brief Kind of Hybrid RANS/LES (SA - Delayed DES (DDES) with Shear Layer Adapted SGS: Enhanced DDES). */
+  SA_EDDES = 4,          /*!< \brief Kind of Hybrid RANS/LES (SA - Delayed DES (DDES) with Shear Layer Adapted SGS: Enhanced DDES). */
+  SST_DDES = 5,          /*!< \brief Kind of Hybrid RANS/LES (SST or k-omega - Delayed DES (DDES) with Delta_max SGS). */
+  SST_IDDES = 6          /*!< \brief Kind of Hybrid RANS/LES (SST or k-omega - Improved DDES (IDDES)). */
 };
 static const MapType<std::string, ENUM_HYBRIDRANSLES> HybridRANSLES_Map = {
   MakePair("NONE", NO_HYBRIDRANSLES)
@@ -1385,6 +1387,8 @@ static const MapType<std::string, ENUM_HYBRIDRANSLES> HybridRANSLES_Map = {
   MakePair("SA_DDES", SA_DDES)
   MakePair("SA_ZDES", SA_ZDES)
   MakePair("SA_EDDES", SA_EDDES)
+  MakePair("SST_DDES", SST_DDES)
+  MakePair("SST_IDDES", SST_IDDES)
 };
 
 /*!
@@ -2221,15 +2225,23 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_FGMRES,     /*!< \brief GMRES (right preconditioned) with one non-blocking reduction per iteration. */
+  GCRODR,               /*!< \brief FGMRES with a recycled (deflation) subspace kept between solves (GCRO-DR). */
+  SPARSE_LDLT,          /*!< \brief FGMRES preconditioned by the built-in LDLT (complete) factorization. */
+  SPARSE_LU,            /*!< \brief FGMRES preconditioned by the built-in LU (complete) factorization. */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("GCRODR", GCRODR)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("SPARSE_LDLT", SPARSE_LDLT)
+  MakePair("SPARSE_LU", SPARSE_LU)
 };
 
 /*!
@@ -2286,18 +2298,40 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Algebraic multigrid preconditioner. */
+  LINELET_ILU,    /*!< \brief Line implicit preconditioner with ILU on the points not on lines. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
+  SPARSE_LU_P,    /*!< \brief Built-in sparse LU as preconditioner. */
+  SPARSE_LDLT_P,  /*!< \brief Built-in sparse LDLT as preconditioner. */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("JACOBI", JACOBI)
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
+  MakePair("LINELET_ILU", LINELET_ILU)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
+  MakePair("SPARSE_LU", SPARSE_LU_P)
+  MakePair("SPARSE_LDLT", SPARSE_LDLT_P)
+};
+
+/*!
+ * \brief Storage formats for the off-diagonal blocks of the ILU and LU_SGS preconditioners.
+ */
+enum class BLOCK_COMPRESSION {
+  NONE,      /*!< \brief Same precision as the matrix. */
+  FLOAT16,   /*!< \brief IEEE half precision (5 bit exponent) with per-block scaling. */
+  BFLOAT16,  /*!< \brief Brain floating point (8 bit exponent) with per-block scaling. */
+};
+static const MapType<std::string, BLOCK_COMPRESSION> Block_Compression_Map = {
+  MakePair("NONE", BLOCK_COMPRESSION::NONE)
+  MakePair("FLOAT16", BLOCK_COMPRESSION::FLOAT16)
+  MakePair("BFLOAT16", BLOCK_COMPRESSION::BFLOAT16)
 };
 
 /*!
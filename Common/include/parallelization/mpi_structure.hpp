@@ -207,6 +207,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -412,6 +417,11 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    AMPI_Iallreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm), request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
@@ -560,6 +570,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, count, datatype);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    CopyData(sendbuf, recvbuf, count, datatype);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -287,3 +287,35 @@ inline void atomicAdd(T rhs, T& lhs)
   SU2_OMP_ATOMIC
   lhs += rhs;
 }
+
+/*!
+ * \brief Atomically read a shared value that other threads may be writing to (relaxed, no ordering).
+ * \note For types without atomic support (non-arithmetic) this is a plain read.
+ * \param[in] src - Shared variable.
+ * \return Value of the shared variable.
+ */
+template<class T, su2enable_if<!std::is_arithmetic<T>::value> = 0>
+inline T atomicRead(const T& src) { return src; }
+template<class T, su2enable_if<std::is_arithmetic<T>::value> = 0>
+inline T atomicRead(const T& src)
+{
+  T val;
+  SU2_OMP(atomic read)
+  val = src;
+  return val;
+}
+
+/*!
+ * \brief Atomically write a shared value that other threads may be reading (relaxed, no ordering).
+ * \note For types without atomic support (non-arithmetic) this is a plain write.
+ * \param[in] val - Value to write.
+ * \param[out] dst - Shared variable.
+ */
+template<class T, su2enable_if<!std::is_arithmetic<T>::value> = 0>
+inline void atomicWrite(T val, T& dst) { dst = val; }
+template<class T, su2enable_if<std::is_arithmetic<T>::value> = 0>
+inline void atomicWrite(T val, T& dst)
+{
+  SU2_OMP(atomic write)
+  dst = val;
+}
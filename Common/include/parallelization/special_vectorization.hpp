@@ -39,8 +39,9 @@
  * \param[in] ARRAY_BOILERPLATE - Generates the general ctors, access, etc.
  * \note On top of that, the intrinsic functions must be wrapped to
  * strip their type / size characteristics, e.g. _mm256_add_pd -> add_p,
- * overload resolution will do the rest. The first four symbols are
- * undefined once we are done using them.
+ * overload resolution will do the rest. This includes the masked memory
+ * operations (maskloadu_p, maskstoreu_p, maskgather_p, maskscatter_p).
+ * The first four symbols are undefined once we are done using them.
  */
 template<>
 class ARRAY_T {
@@ -79,6 +80,19 @@ public:
   template<class T>
   FORCEINLINE void gather(const Scalar* begin, const T& offsets) { FOREACH x_[k] = begin[offsets[k]]; }
 
+  /*--- Masked primitives, lanes where the mask is 0 do not access memory. ---*/
+
+  FORCEINLINE void load(const Scalar* ptr, const Array& mask) { reg = maskloadu_p(SIZE_TAG, ptr, mask.reg); }
+  FORCEINLINE void store(Scalar* ptr, const Array& mask) const { maskstoreu_p(ptr, mask.reg, reg); }
+  template<class T>
+  FORCEINLINE void gather(const Scalar* begin, const T& offsets, const Array& mask) {
+    reg = maskgather_p(SIZE_TAG, begin, offsets, mask.reg);
+  }
+  template<class T>
+  FORCEINLINE void scatter(Scalar* begin, const T& offsets, const Array& mask) const {
+    maskscatter_p(begin, offsets, mask.reg, reg);
+  }
+
   /*--- Compound assignement operators. ---*/
 
 #define MAKE_COMPOUND(OP,IMPL)\
@@ -146,6 +160,9 @@ FORCEINLINE ARRAY_T NAME(const ARRAY_T& x) {                  \
   ARRAY_T res; FOREACH { res[k] = IMPL(x[k]); } return res;   \
 }
 
+MAKE_UNARY_FUN(exp, ::exp)
+MAKE_UNARY_FUN(tanh, ::tanh)
+
 #undef MAKE_UNARY_FUN
 
 /*--- Functions of two arguments, with arrays and scalars. ---*/
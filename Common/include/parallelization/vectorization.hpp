@@ -42,13 +42,20 @@ namespace simd {
 
 using namespace VecExpr;
 
-/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures. ---*/
+/*--- Detect preferred SIMD size (bytes). On x86 this follows the highest enabled
+ * instruction set. The size must be known at compile time, therefore on ARM, SVE is
+ * only used when the vector length is fixed (e.g. -msve-vector-bits=512), otherwise
+ * the NEON size is used (SVE implies NEON). ---*/
 #if defined(__AVX512F__)
 constexpr size_t PREFERRED_SIZE = 64;
 #elif defined(__AVX__)
 constexpr size_t PREFERRED_SIZE = 32;
 #elif defined(__SSE2__)
 constexpr size_t PREFERRED_SIZE = 16;
+#elif defined(__ARM_FEATURE_SVE_BITS) && (__ARM_FEATURE_SVE_BITS > 0)
+constexpr size_t PREFERRED_SIZE = __ARM_FEATURE_SVE_BITS / 8;
+#elif defined(__ARM_NEON)
+constexpr size_t PREFERRED_SIZE = 16;
 #else
 constexpr size_t PREFERRED_SIZE = 8;
 #endif
@@ -142,6 +149,22 @@ public:
   template<class T>
   FORCEINLINE void gather(const Scalar* begin, const T& offsets) { FOREACH x_[k] = begin[offsets[k]]; }
 
+  /*--- Masked versions of the primitives, memory is not accessed for lanes
+   * where the mask is 0, and those lanes are set to 0 by loads. ---*/
+
+  template<class M>
+  FORCEINLINE void load(const Scalar* ptr, const M& mask) { FOREACH x_[k] = (mask[k] != 0) ? ptr[k] : Scalar(0); }
+  template<class M>
+  FORCEINLINE void store(Scalar* ptr, const M& mask) const { FOREACH if (mask[k] != 0) ptr[k] = x_[k]; }
+  template<class T, class M>
+  FORCEINLINE void gather(const Scalar* begin, const T& offsets, const M& mask) {
+    FOREACH x_[k] = (mask[k] != 0) ? begin[offsets[k]] : Scalar(0);
+  }
+  template<class T, class M>
+  FORCEINLINE void scatter(Scalar* begin, const T& offsets, const M& mask) const {
+    FOREACH if (mask[k] != 0) begin[offsets[k]] = x_[k];
+  }
+
   /*--- Compound assignment operators. ---*/
 
 #define MAKE_COMPOUND(OP)                                                             \
@@ -217,6 +240,30 @@ FORCEINLINE __m128d abs_p(__m128d x) { return _mm_and_pd(x, abs_mask_2d); }
 FORCEINLINE __m128d neg_p(__m128d x) { return _mm_xor_pd(x, sign_mask_2d); }
 FORCEINLINE __m128d sign_p(__m128d x) { return _mm_or_pd(ones_2d, _mm_and_pd(x, sign_mask_2d)); }
 
+/*--- SSE2 has no masked memory operations, the active lanes are found from the mask bits. ---*/
+FORCEINLINE int maskbits_p(__m128d m) { return _mm_movemask_pd(_mm_cmpneq_pd(m, _mm_setzero_pd())); }
+FORCEINLINE __m128d maskloadu_p(SizeTag::TWO, const double* p, __m128d m) {
+  const int bits = maskbits_p(m);
+  if (bits == 3) return _mm_loadu_pd(p);
+  return _mm_set_pd((bits & 2) ? p[1] : 0.0, (bits & 1) ? p[0] : 0.0);
+}
+FORCEINLINE void maskstoreu_p(double* p, __m128d m, __m128d x) {
+  const int bits = maskbits_p(m);
+  if (bits & 1) _mm_storel_pd(p, x);
+  if (bits & 2) _mm_storeh_pd(p+1, x);
+}
+template<class T>
+FORCEINLINE __m128d maskgather_p(SizeTag::TWO, const double* p, const T& idx, __m128d m) {
+  const int bits = maskbits_p(m);
+  return _mm_set_pd((bits & 2) ? p[idx[1]] : 0.0, (bits & 1) ? p[idx[0]] : 0.0);
+}
+template<class T>
+FORCEINLINE void maskscatter_p(double* p, const T& idx, __m128d m, __m128d x) {
+  const int bits = maskbits_p(m);
+  if (bits & 1) _mm_storel_pd(&p[idx[0]], x);
+  if (bits & 2) _mm_storeh_pd(&p[idx[1]], x);
+}
+
 /*--- Generate specialization based on the defines
  * and functions above by including the header. ---*/
 
@@ -263,6 +310,33 @@ FORCEINLINE __m256d abs_p(__m256d x) { return _mm256_and_pd(x, abs_mask_4d); }
 FORCEINLINE __m256d neg_p(__m256d x) { return _mm256_xor_pd(x, sign_mask_4d); }
 FORCEINLINE __m256d sign_p(__m256d x) { return _mm256_or_pd(ones_4d, _mm256_and_pd(x, sign_mask_4d)); }
 
+/*--- Lanes are active if the mask is not 0, AVX uses the sign bit of each lane. ---*/
+FORCEINLINE __m256d maskreg_p(__m256d m) { return _mm256_cmp_pd(m, _mm256_setzero_pd(), 4); }
+FORCEINLINE __m256d maskloadu_p(SizeTag::FOUR, const double* p, __m256d m) {
+  return _mm256_maskload_pd(p, _mm256_castpd_si256(maskreg_p(m)));
+}
+FORCEINLINE void maskstoreu_p(double* p, __m256d m, __m256d x) {
+  _mm256_maskstore_pd(p, _mm256_castpd_si256(maskreg_p(m)), x);
+}
+template<class T>
+FORCEINLINE __m256d maskgather_p(SizeTag::FOUR, const double* p, const T& idx, __m256d m) {
+#ifdef __AVX2__
+  const __m256i off = _mm256_set_epi64x(idx[3], idx[2], idx[1], idx[0]);
+  return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), p, off, maskreg_p(m), 8);
+#else
+  const int bits = _mm256_movemask_pd(maskreg_p(m));
+  return _mm256_set_pd((bits & 8) ? p[idx[3]] : 0.0, (bits & 4) ? p[idx[2]] : 0.0,
+                       (bits & 2) ? p[idx[1]] : 0.0, (bits & 1) ? p[idx[0]] : 0.0);
+#endif
+}
+template<class T>
+FORCEINLINE void maskscatter_p(double* p, const T& idx, __m256d m, __m256d x) {
+  const int bits = _mm256_movemask_pd(maskreg_p(m));
+  alignas(32) double v[4];
+  _mm256_store_pd(v, x);
+  for (int k = 0; k < 4; ++k) if (bits & (1 << k)) p[idx[k]] = v[k];
+}
+
 #include "special_vectorization.hpp"
 
 #endif // __AVX__
@@ -310,6 +384,23 @@ FORCEINLINE __m512d abs_p(__m512d x) { return _mm512_and_pd(x, abs_mask_8d); }
 FORCEINLINE __m512d neg_p(__m512d x) { return _mm512_xor_pd(x, sign_mask_8d); }
 FORCEINLINE __m512d sign_p(__m512d x) { return _mm512_or_pd(ones_8d, _mm512_and_pd(x, sign_mask_8d)); }
 
+/*--- AVX512 has native masked operations, lanes are active if the mask is not 0. ---*/
+FORCEINLINE __mmask8 maskreg_p(__m512d m) { return _mm512_cmp_pd_mask(m, _mm512_setzero_pd(), 4); }
+FORCEINLINE __m512d maskloadu_p(SizeTag::EIGHT, const double* p, __m512d m) {
+  return _mm512_maskz_loadu_pd(maskreg_p(m), p);
+}
+FORCEINLINE void maskstoreu_p(double* p, __m512d m, __m512d x) { _mm512_mask_storeu_pd(p, maskreg_p(m), x); }
+template<class T>
+FORCEINLINE __m512d maskgather_p(SizeTag::EIGHT, const double* p, const T& idx, __m512d m) {
+  const __m512i off = _mm512_set_epi64(idx[7], idx[6], idx[5], idx[4], idx[3], idx[2], idx[1], idx[0]);
+  return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), maskreg_p(m), off, p, 8);
+}
+template<class T>
+FORCEINLINE void maskscatter_p(double* p, const T& idx, __m512d m, __m512d x) {
+  const __m512i off = _mm512_set_epi64(idx[7], idx[6], idx[5], idx[4], idx[3], idx[2], idx[1], idx[0]);
+  _mm512_mask_i64scatter_pd(p, maskreg_p(m), off, x, 8);
+}
+
 #include "special_vectorization.hpp"
 
 #endif // __AVX512F__
@@ -90,6 +90,36 @@ public:
                                           su2double       &qWall,
                                           su2double       &ViscosityWall,
                                           su2double       &kOverCvWall);
+
+  /*!
+   * \brief Virtual function, which computes the wall shear stress and heat flux for a given
+            exchange height. Used by the finite volume solvers, for which the exchange location
+            is the first point off the wall and the iterations are warm started.
+   * \param[in]     hExchange - Distance of the exchange location to the wall.
+   * \param[in,out] tauWall   - Initial guess if positive (e.g. the value of the previous
+                               iteration), computed wall shear stress on exit.
+   * \note The other arguments are the same as in WallShearStressAndHeatFlux.
+   */
+  virtual void WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                              const su2double tExchange,
+                                              const su2double velExchange,
+                                              const su2double muExchange,
+                                              const su2double pExchange,
+                                              const su2double Wall_HeatFlux,
+                                              const bool      HeatFlux_Prescribed,
+                                              const su2double Wall_Temperature,
+                                              const bool      Temperature_Prescribed,
+                                              CFluidModel     *FluidModel,
+                                              su2double       &tauWall,
+                                              su2double       &qWall,
+                                              su2double       &ViscosityWall,
+                                              su2double       &kOverCvWall) const;
+
+  /*!
+   * \brief Get the exchange height of the wall model, as specified for the marker.
+   */
+  inline su2double GetExchangeHeight(void) const { return h_wm; }
+
 protected:
 
   su2double h_wm;    /*!< \brief The thickness of the wall model. This is also basically the exchange location */
@@ -149,6 +179,25 @@ public:
                                   su2double       &ViscosityWall,
                                   su2double       &kOverCvWall) override;
 
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for a given
+            exchange height (see CWallModel).
+   */
+  void WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                      const su2double tExchange,
+                                      const su2double velExchange,
+                                      const su2double muExchange,
+                                      const su2double pExchange,
+                                      const su2double Wall_HeatFlux,
+                                      const bool      HeatFlux_Prescribed,
+                                      const su2double Wall_Temperature,
+                                      const bool      Temperature_Prescribed,
+                                      CFluidModel     *FluidModel,
+                                      su2double       &tauWall,
+                                      su2double       &qWall,
+                                      su2double       &ViscosityWall,
+                                      su2double       &kOverCvWall) const override;
+
 private:
 
   su2double expansionRatio;   /*!< \brief  Stretching factor used for the wall model grid. */
@@ -157,6 +206,23 @@ private:
   vector<su2double> y_cv;    /*!< \brief  The coordinates in normal direction of the wall model grid (control volumes). */
   vector<su2double> y_fa;    /*!< \brief  The coordinates in normal direction of the wall model grid (faces of CV). */
 
+  /*!
+   * \brief Solve the coupled momentum and energy equations of the wall model, starting from the
+            value of tauWall on input.
+   * \param[in] scale - Ratio of the exchange height and the height of the stored grid.
+   */
+  void SolveWallModel(const su2double scale,
+                      const su2double tExchange,
+                      const su2double velExchange,
+                      const su2double muExchange,
+                      const su2double pExchange,
+                      const bool      HeatFlux_Prescribed,
+                      const su2double TWall,
+                      su2double       &tauWall,
+                      su2double       &qWall,
+                      su2double       &ViscosityWall,
+                      su2double       &kOverCvWall) const;
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -208,10 +274,47 @@ public:
                                   su2double       &ViscosityWall,
                                   su2double       &kOverCvWall) override;
 
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for a given
+            exchange height (see CWallModel).
+   */
+  void WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                      const su2double tExchange,
+                                      const su2double velExchange,
+                                      const su2double muExchange,
+                                      const su2double pExchange,
+                                      const su2double Wall_HeatFlux,
+                                      const bool      HeatFlux_Prescribed,
+                                      const su2double Wall_Temperature,
+                                      const bool      Temperature_Prescribed,
+                                      CFluidModel     *FluidModel,
+                                      su2double       &tauWall,
+                                      su2double       &qWall,
+                                      su2double       &ViscosityWall,
+                                      su2double       &kOverCvWall) const override;
+
 private:
 
   su2double C;  /*!< \brief Constant to match the Reichardt BL profile. */
 
+  /*!
+   * \brief Newton solve of the Reichardt law for the friction velocity, starting from
+            the value of tauWall on input if positive.
+   * \param[in] hExchange - Distance of the exchange location to the wall.
+   */
+  void SolveLogLaw(const su2double hExchange,
+                   const su2double tExchange,
+                   const su2double velExchange,
+                   const su2double pExchange,
+                   const su2double Wall_HeatFlux,
+                   const su2double Wall_Temperature,
+                   const bool      Temperature_Prescribed,
+                   CFluidModel     *FluidModel,
+                   su2double       &tauWall,
+                   su2double       &qWall,
+                   su2double       &ViscosityWall,
+                   su2double       &kOverCvWall) const;
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -1694,6 +1694,16 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Preconditioner lagging parameters {max iterations before rebuild, max linear iterations before rebuild}. */
+  addUShortArrayOption("NEWTON_KRYLOV_PRECOND_LAG", NK_PrecLagIntParam.size(), NK_PrecLagIntParam.data());
+  /* DESCRIPTION: Rebuild the lagged preconditioner when the linear convergence rate drops below this fraction of the rate after the last rebuild. */
+  addDoubleOption("NEWTON_KRYLOV_PRECOND_LAG_RATE", NK_PrecLagRateFactor, 0.0);
+  /* DESCRIPTION: Evaluate the matrix-free products with frozen gradients, limiters, and sensors. */
+  addBoolOption("NEWTON_KRYLOV_FROZEN_PRODUCTS", NK_FrozenProducts, false);
+  /* DESCRIPTION: Solve the mean flow and turbulence implicit systems as one coupled linear system. */
+  addBoolOption("COUPLED_TURB_SOLVE", CoupledTurbSolve, false);
+  /* DESCRIPTION: Map the decreasing updates of k and omega as updates of log(k) and log(omega), keeping them positive. */
+  addBoolOption("TURB_POSITIVITY_UPDATE", TurbPositivityUpdate, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1785,12 +1795,36 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Level scheduling of the ILU factorization and substitutions, all threads of a rank share one factorization */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Levels, false);
+  /* DESCRIPTION: Maximum number of levels (including the fine level) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of pre- and post-smoothing sweeps on each level of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
+  /* DESCRIPTION: Strength of connection threshold used to form the aggregates of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of approximate eigenvectors recycled between linear solves by GCRODR */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
+  /* DESCRIPTION: Local block Gauss-Seidel sweeps per iteration of the asynchronous smoother, 0 (default) disables it. */
+  addUnsignedLongOption("LINEAR_SOLVER_SMOOTHER_ASYNC_SWEEPS", Linear_Solver_Smoother_Async_Sweeps, 0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Max number of mixed precision iterative refinement steps of the linear solver (0 disables refinement). */
+  addUnsignedShortOption("LINEAR_SOLVER_REFINEMENT_ITER", Linear_Solver_Refinement_Iter, 0);
+  /* DESCRIPTION: Use the SELL-C-sigma (sliced ELLPACK) format in sparse matrix-vector products. */
+  addBoolOption("LINEAR_SOLVER_SELL_FORMAT", Linear_Solver_SELL_Format, false);
+  /* DESCRIPTION: Store the off-diagonal blocks of the ILU and LU_SGS preconditioners in a 16 bit format (NONE, FLOAT16, BFLOAT16). */
+  addEnumOption("LINEAR_SOLVER_PREC_COMPRESSION", Linear_Solver_Prec_Compression, Block_Compression_Map, BLOCK_COMPRESSION::NONE);
+  /* DESCRIPTION: Use classical Gram-Schmidt with re-orthogonalization in FGMRES and GCRODR (fewer passes over the vectors and reductions). */
+  addBoolOption("LINEAR_SOLVER_CLASSICAL_GRAM_SCHMIDT", Linear_Solver_Classical_GS, false);
+  /* DESCRIPTION: Build linelets also in anisotropic regions away from walls (wakes, off-body refinement). */
+  addBoolOption("LINELET_OFF_BODY", Linelet_Off_Body, false);
+  /* DESCRIPTION: Allow linelets to continue across MPI partitions (distributed tridiagonal solves). */
+  addBoolOption("LINELET_ACROSS_RANKS", Linelet_Across_Ranks, false);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -2889,6 +2923,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Level of fill for PaStiX incomplete LU factorization. */
   addUnsignedShortOption("PASTIX_FILL_LEVEL", pastix_fill_lvl, 1);
 
+  /* DESCRIPTION: Number of calls to 'Build' that trigger re-factorization with the built-in sparse direct solver (0 means only once). */
+  addUnsignedLongOption("SPARSE_DIRECT_FACTORIZATION_FREQUENCY", sparse_direct_fact_freq, 1);
+
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
@@ -3499,7 +3536,19 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       if ((Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::ADAPTIVE_FUNCTION) ||
           (Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::SCALABLE_FUNCTION) ||
           (Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::NONEQUILIBRIUM_MODEL))
-        SU2_MPI::Error(string("For RANS problems, use NONE, STANDARD_WALL_FUNCTION or EQUILIBRIUM_WALL_MODEL.\n"), CURRENT_FUNCTION);
+        SU2_MPI::Error(string("For RANS problems, use NONE, STANDARD_WALL_FUNCTION, EQUILIBRIUM_WALL_MODEL or LOGARITHMIC_WALL_MODEL.\n"), CURRENT_FUNCTION);
+
+      if ((Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::EQUILIBRIUM_MODEL) ||
+          (Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::LOGARITHMIC_MODEL)) {
+        if ((Kind_Solver == MAIN_SOLVER::INC_NAVIER_STOKES) || (Kind_Solver == MAIN_SOLVER::INC_RANS) ||
+            (Kind_Solver == MAIN_SOLVER::NEMO_NAVIER_STOKES))
+          SU2_MPI::Error(string("Wall models EQUILIBRIUM_WALL_MODEL and LOGARITHMIC_WALL_MODEL are only available\n") +
+                         string("for the compressible ideal gas solvers.\n"), CURRENT_FUNCTION);
+        if ((Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::EQUILIBRIUM_MODEL) &&
+            ((Kind_Solver == MAIN_SOLVER::NAVIER_STOKES) || (Kind_Solver == MAIN_SOLVER::RANS)) &&
+            (Ref_NonDim != DIMENSIONAL))
+          SU2_MPI::Error(string("Wall model EQUILIBRIUM_WALL_MODEL requires REF_DIMENSIONALIZATION= DIMENSIONAL.\n"), CURRENT_FUNCTION);
+      }
 
       if (Kind_WallFunctions[iMarker] == WALL_FUNCTIONS::STANDARD_FUNCTION) {
         if (!((Kind_Solver == MAIN_SOLVER::RANS) || (Kind_Solver == MAIN_SOLVER::INC_RANS)))
@@ -4664,6 +4713,40 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error("Only TIME_DISCRE_TURB = EULER_IMPLICIT, EULER_EXPLICIT have been implemented.", CURRENT_FUNCTION);
   }
 
+  if (NewtonKrylov && (NK_PrecLagIntParam[0] > 1) &&
+      (Kind_Linear_Solver_Prec == LU_SGS || Kind_Linear_Solver_Prec == LINELET ||
+       Kind_Linear_Solver_Prec == LINELET_ILU || Kind_Linear_Solver_Prec == AMG)) {
+    SU2_MPI::Error("NEWTON_KRYLOV_PRECOND_LAG cannot be used with LU_SGS, LINELET, LINELET_ILU or AMG, these\n"
+                   "preconditioners combine the current Jacobian with data computed when they are built.",
+                   CURRENT_FUNCTION);
+  }
+
+  if (CoupledTurbSolve) {
+    if (Kind_Turb_Model == TURB_MODEL::NONE || GetNEMOProblem())
+      SU2_MPI::Error("COUPLED_TURB_SOLVE requires a RANS problem (compressible or incompressible).", CURRENT_FUNCTION);
+    if (Kind_Trans_Model != TURB_TRANS_MODEL::NONE)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE is not compatible with transition models.", CURRENT_FUNCTION);
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT || Kind_TimeIntScheme_Turb != EULER_IMPLICIT)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE requires TIME_DISCRE_FLOW and TIME_DISCRE_TURB = EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE is not compatible with multigrid (MGLEVEL must be 0).", CURRENT_FUNCTION);
+    if (NewtonKrylov)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE is not compatible with NEWTON_KRYLOV.", CURRENT_FUNCTION);
+    if (ContinuousAdjoint || DiscreteAdjoint)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE is only available for the primal solver.", CURRENT_FUNCTION);
+  }
+
+  if (TurbPositivityUpdate && Kind_Turb_Model != TURB_MODEL::SST && Kind_Turb_Model != TURB_MODEL::KW)
+    SU2_MPI::Error("TURB_POSITIVITY_UPDATE is only available for KIND_TURB_MODEL= SST or KW.", CURRENT_FUNCTION);
+
+  if (Kind_HybridRANSLES != NO_HYBRIDRANSLES && Kind_Turb_Model != TURB_MODEL::NONE) {
+    const bool sstHybrid = (Kind_HybridRANSLES == SST_DDES || Kind_HybridRANSLES == SST_IDDES);
+    if (sstHybrid && Kind_Turb_Model != TURB_MODEL::SST && Kind_Turb_Model != TURB_MODEL::KW)
+      SU2_MPI::Error("HYBRID_RANSLES= SST_DDES and SST_IDDES require KIND_TURB_MODEL= SST or KW.", CURRENT_FUNCTION);
+    if (!sstHybrid && Kind_Turb_Model != TURB_MODEL::SA)
+      SU2_MPI::Error("HYBRID_RANSLES= SA_DES, SA_DDES, SA_ZDES, and SA_EDDES require KIND_TURB_MODEL= SA.", CURRENT_FUNCTION);
+  }
+
   if (nIntCoeffs == 0) {
     nIntCoeffs = 2;
     Int_Coeffs = new su2double[2]; Int_Coeffs[0] = 0.25; Int_Coeffs[1] = 0.5;
@@ -5158,6 +5241,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  /* The built-in direct solvers use the factorization as the preconditioner of FGMRES. */
+
+  auto sparsePrec = [](unsigned short kindSolver, unsigned short& kindPrec) {
+    if (kindSolver == SPARSE_LU) kindPrec = SPARSE_LU_P;
+    if (kindSolver == SPARSE_LDLT) kindPrec = SPARSE_LDLT_P;
+  };
+
+  sparsePrec(Kind_Linear_Solver, Kind_Linear_Solver_Prec);
+  sparsePrec(Kind_DiscAdj_Linear_Solver, Kind_DiscAdj_Linear_Prec);
+  sparsePrec(Kind_Deform_Linear_Solver, Kind_Deform_Linear_Solver_Prec);
+
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -6103,6 +6197,8 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
           case SA_DDES:  cout << "Delayed Detached Eddy Simulation (DDES) with Standard SGS" << endl; break;
           case SA_ZDES:  cout << "Delayed Detached Eddy Simulation (DDES) with Vorticity-based SGS" << endl; break;
           case SA_EDDES: cout << "Delayed Detached Eddy Simulation (DDES) with Shear-layer Adapted SGS" << endl; break;
+          case SST_DDES: cout << "SST-based Delayed Detached Eddy Simulation (DDES)" << endl; break;
+          case SST_IDDES: cout << "SST-based Improved Delayed Detached Eddy Simulation (IDDES)" << endl; break;
         }
         break;
       case MAIN_SOLVER::NEMO_EULER:
@@ -6866,21 +6962,36 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_FGMRES:
+            case GCRODR:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == GCRODR)
+                cout << "GCRO-DR (FGMRES with subspace recycling) is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG: cout << "Using an AMG preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case LINELET_ILU: cout << "Using a linelet preconditioning, with ILU("<< Linear_Solver_ILU_n <<") elsewhere."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
               }
               break;
+            case SPARSE_LU:
+            case SPARSE_LDLT:
+              cout << "FGMRES preconditioned by the built-in sparse " << (Kind_Linear_Solver == SPARSE_LU ? "LU" : "LDLT")
+                   << " factorization is used for solving the linear system." << endl;
+              break;
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An AMG"; break;
                 case LINELET: cout << "A Linelet"; break;
+                case LINELET_ILU: cout << "A Linelet-ILU"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
               }
@@ -6915,7 +7026,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_FGMRES: case GCRODR:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -25,6 +25,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <numeric>
 #include <unordered_set>
 
 #include "../../include/geometry/CGeometry.hpp"
@@ -1400,7 +1401,6 @@ void CGeometry::SetEdges(void) {
       }
     }
   }
-  edges->SetPaddingNodes();
 }
 
 void CGeometry::SetFaces(void) {
@@ -3863,112 +3863,276 @@ void CGeometry::ColorMGLevels(unsigned short nMGLevels, const CGeometry* const*
 
 const CGeometry::CLineletInfo& CGeometry::GetLineletInfo(const CConfig* config) const {
   auto& li = lineletInfo;
-  if (!li.linelets.empty() || nPoint == 0) return li;
+  if (!li.lineletIdx.empty() || nPoint == 0) return li;
 
   li.lineletIdx.resize(nPoint, CLineletInfo::NO_LINELET);
 
-  /*--- Estimate number of linelets. ---*/
+  /*--- Linelets can only continue on other ranks on the fine grid, where the global indices are known. ---*/
+  const bool acrossRanks = config->GetLinelet_Across_Ranks() && (size > 1) && (MGLevel == MESH_0);
+
+  /*--- Ratio of min to max edge weight around a point, isotropic regions have values close to 1. ---*/
+
+  auto weightRatio = [&](unsigned long iPoint) {
+    su2double max_weight = 0.0, min_weight = std::numeric_limits<su2double>::max();
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      const auto jPoint = nodes->GetPoint(iPoint, iNode);
+      const auto iEdge = nodes->GetEdge(iPoint, iNode);
+      const auto* normal = edges->GetNormal(iEdge);
+      const su2double area = GeometryToolbox::Norm(nDim, normal);
+      const su2double volume_iPoint = nodes->GetVolume(iPoint);
+      const su2double volume_jPoint = nodes->GetVolume(jPoint);
+      const su2double weight = 0.5 * area * (1.0 / volume_iPoint + 1.0 / volume_jPoint);
+      max_weight = max(max_weight, weight);
+      min_weight = min(min_weight, weight);
+    }
+    return min_weight / max_weight;
+  };
+
+  /*--- Closest valid neighbor of iPoint in the direction kPoint->iPoint (any direction if kPoint == iPoint).
+   * Halo points of other ranks are valid if "allowHalo", the linelet is then continued by that rank. ---*/
+
+  auto nextPoint = [&](unsigned long iPoint, unsigned long kPoint, bool allowHalo) {
+    su2double min_dist2 = std::numeric_limits<su2double>::max();
+    auto next_Point = iPoint;
+    const auto* iCoord = nodes->GetCoord(iPoint);
+
+    for (const auto jPoint : nodes->GetPoints(iPoint)) {
+      if (li.lineletIdx[jPoint] != CLineletInfo::NO_LINELET) continue;
+      const bool valid = nodes->GetDomain(jPoint) ||
+                         (allowHalo && static_cast<int>(nodes->GetColor(jPoint)) != rank);
+      if (!valid) continue;
+
+      const auto* jCoord = nodes->GetCoord(jPoint);
+      const su2double d2 = GeometryToolbox::SquaredDistance(nDim, iCoord, jCoord);
+      su2double cosTheta = 1;
+      if (kPoint != iPoint) {
+        const auto* kCoord = nodes->GetCoord(kPoint);
+        su2double dij[3] = {0.0}, dki[3] = {0.0};
+        GeometryToolbox::Distance(nDim, iCoord, kCoord, dki);
+        GeometryToolbox::Distance(nDim, jCoord, iCoord, dij);
+        cosTheta = GeometryToolbox::DotProduct(3, dki, dij) / sqrt(d2 * GeometryToolbox::SquaredNorm(nDim, dki));
+      }
+      if (d2 < min_dist2 && cosTheta > 0.7071) {
+        next_Point = jPoint;
+        min_dist2 = d2;
+      }
+    }
+    return next_Point;
+  };
+
+  /*--- Grow a linelet (by appending points) until it reaches an isotropic region, the maximum size, or a point
+   * that cannot be added. Returns the halo point where the linelet continues, or the last point if it does not.
+   * "kPoint" gives the initial direction of growth, when the linelet has a single point. ---*/
+
+  auto grow = [&](vector<unsigned long>& linelet, unsigned long iLinelet, unsigned long maxSize,
+                  unsigned long kPoint, bool allowHalo) {
+    while (linelet.size() < maxSize) {
+      const auto iPoint = linelet.back();
+
+      /*--- Isotropic, stop this linelet. ---*/
+      if (weightRatio(iPoint) > CLineletInfo::ALPHA_ISOTROPIC()) break;
+
+      /*--- Otherwise, add the closest valid neighbor. ---*/
+      if (linelet.size() > 1) kPoint = linelet[linelet.size() - 2];
+      const auto next_Point = nextPoint(iPoint, kPoint, allowHalo);
+
+      /*--- Did not find a suitable point. ---*/
+      if (next_Point == iPoint) break;
+
+      /*--- The linelet continues on another rank. ---*/
+      if (!nodes->GetDomain(next_Point)) return next_Point;
+
+      linelet.push_back(next_Point);
+      li.lineletIdx[next_Point] = iLinelet;
+    }
+    return linelet.back();
+  };
+
+  /*--- Linelets that may continue on other ranks, and the halo point where they continue. ---*/
+  vector<std::pair<unsigned long, unsigned long> > pending;
+
+  auto addLinelet = [&](unsigned long iPoint, unsigned short stage) {
+    li.linelets.push_back({iPoint});
+    li.lineletStage.push_back(stage);
+    li.lineletIdx[iPoint] = li.linelets.size() - 1;
+  };
+
+  /*--- Define the basic linelets, starting from each vertex of solid walls, preventing duplication of points. ---*/
 
-  unsigned long nLinelet = 0;
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetSolid_Wall(iMarker) || config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY) {
-      nLinelet += nVertex[iMarker];
+      for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+        const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+        if (li.lineletIdx[iPoint] == CLineletInfo::NO_LINELET && nodes->GetDomain(iPoint)) {
+          addLinelet(iPoint, 0);
+        }
+      }
     }
   }
 
-  /*--- If the domain contains well defined Linelets ---*/
+  /*--- Create the linelet structure. ---*/
 
-  unsigned long maxNPoints = 0, sumNPoints = 0;
+  for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); ++iLinelet) {
+    auto& linelet = li.linelets[iLinelet];
+    const auto last = grow(linelet, iLinelet, CLineletInfo::MAX_LINELET_POINTS, linelet[0], acrossRanks);
+    if (!nodes->GetDomain(last)) pending.emplace_back(iLinelet, last);
+  }
 
-  if (nLinelet != 0) {
-    /*--- Define the basic linelets, starting from each vertex, preventing duplication of points. ---*/
-
-    li.linelets.resize(nLinelet);
-    nLinelet = 0;
-    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetSolid_Wall(iMarker) || config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY) {
-        for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
-          const auto iPoint = vertex[iMarker][iVertex]->GetNode();
-          if (li.lineletIdx[iPoint] == CLineletInfo::NO_LINELET && nodes->GetDomain(iPoint)) {
-            li.linelets[nLinelet].push_back(iPoint);
-            li.lineletIdx[iPoint] = nLinelet;
-            ++nLinelet;
-          }
-        }
+  /*--- Off-body linelets, seeded at the most anisotropic points not yet on a linelet (e.g. wakes). They grow in
+   * both directions from the seed, and can only continue on other ranks in the forward direction. ---*/
+
+  if (config->GetLinelet_Off_Body()) {
+    vector<std::pair<passivedouble, unsigned long> > seeds;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (li.lineletIdx[iPoint] != CLineletInfo::NO_LINELET) continue;
+      const passivedouble ratio = SU2_TYPE::GetValue(weightRatio(iPoint));
+      if (ratio <= CLineletInfo::ALPHA_ISOTROPIC()) seeds.emplace_back(ratio, iPoint);
+    }
+    std::sort(seeds.begin(), seeds.end());
+
+    for (const auto& seed : seeds) {
+      const auto iPoint = seed.second;
+      if (li.lineletIdx[iPoint] != CLineletInfo::NO_LINELET) continue;
+
+      const auto iLinelet = li.linelets.size();
+      addLinelet(iPoint, 0);
+
+      vector<unsigned long> fwd = {iPoint};
+      const auto last = grow(fwd, iLinelet, CLineletInfo::MAX_LINELET_POINTS, iPoint, acrossRanks);
+
+      /*--- The backward direction is the opposite of the first forward step. ---*/
+      vector<unsigned long> bwd = {iPoint};
+      const auto kPoint = (fwd.size() > 1) ? fwd[1] : last;
+      if (kPoint != iPoint) grow(bwd, iLinelet, CLineletInfo::MAX_LINELET_POINTS + 1 - fwd.size(), kPoint, false);
+
+      auto& linelet = li.linelets[iLinelet];
+      linelet.assign(bwd.rbegin(), bwd.rend() - 1);
+      linelet.insert(linelet.end(), fwd.begin(), fwd.end());
+
+      if (!nodes->GetDomain(last)) {
+        pending.emplace_back(iLinelet, last);
+      } else if (linelet.size() == 1) {
+        /*--- Not worth a linelet. ---*/
+        li.lineletIdx[iPoint] = CLineletInfo::NO_LINELET;
+        li.linelets.pop_back();
+        li.lineletStage.pop_back();
       }
     }
-    li.linelets.resize(nLinelet);
-
-    /*--- Create the linelet structure. ---*/
-
-    nLinelet = 0;
-    for (auto& linelet : li.linelets) {
-      while (linelet.size() < CLineletInfo::MAX_LINELET_POINTS) {
-        const auto iPoint = linelet.back();
-
-        /*--- Compute the value of the max and min weights to detect if this region is isotropic. ---*/
-
-        su2double max_weight = 0.0, min_weight = std::numeric_limits<su2double>::max();
-        for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-          const auto jPoint = nodes->GetPoint(iPoint, iNode);
-          const auto iEdge = nodes->GetEdge(iPoint, iNode);
-          const auto* normal = edges->GetNormal(iEdge);
-          const su2double area = GeometryToolbox::Norm(nDim, normal);
-          const su2double volume_iPoint = nodes->GetVolume(iPoint);
-          const su2double volume_jPoint = nodes->GetVolume(jPoint);
-          const su2double weight = 0.5 * area * (1.0 / volume_iPoint + 1.0 / volume_jPoint);
-          max_weight = max(max_weight, weight);
-          min_weight = min(min_weight, weight);
-        }
+  }
 
-        /*--- Isotropic, stop this linelet. ---*/
-        if (min_weight / max_weight > CLineletInfo::ALPHA_ISOTROPIC()) break;
-
-        /*--- Otherwise, add the closest valid neighbor. ---*/
-
-        su2double min_dist2 = std::numeric_limits<su2double>::max();
-        auto next_Point = iPoint;
-        const auto* iCoord = nodes->GetCoord(iPoint);
-
-        for (const auto jPoint : nodes->GetPoints(iPoint)) {
-          if (li.lineletIdx[jPoint] == CLineletInfo::NO_LINELET && nodes->GetDomain(jPoint)) {
-            const auto* jCoord = nodes->GetCoord(jPoint);
-            const su2double d2 = GeometryToolbox::SquaredDistance(nDim, iCoord, jCoord);
-            su2double cosTheta = 1;
-            if (linelet.size() > 1) {
-              const auto* kCoord = nodes->GetCoord(linelet[linelet.size() - 2]);
-              su2double dij[3] = {0.0}, dki[3] = {0.0};
-              GeometryToolbox::Distance(nDim, iCoord, kCoord, dki);
-              GeometryToolbox::Distance(nDim, jCoord, iCoord, dij);
-              cosTheta = GeometryToolbox::DotProduct(3, dki, dij) / sqrt(d2 * GeometryToolbox::SquaredNorm(nDim, dki));
-            }
-            if (d2 < min_dist2 && cosTheta > 0.7071) {
-              next_Point = jPoint;
-              min_dist2 = d2;
-            }
-          }
-        }
+  /*--- Continue linelets on other ranks. Each round the linelets that reached halo points send requests (start
+   * point, last point, size of the chain of linelets, stage) to the owners of the halo points, which grow new
+   * linelets from the start points if they are still free, and reply whether the request was accepted. ---*/
 
-        /*--- Did not find a suitable point. ---*/
-        if (next_Point == iPoint) break;
+  /*--- Global index of the first point of the second linelet of each link, to sort them consistently. ---*/
+  vector<unsigned long> nextLinkKey, prevLinkKey;
 
-        linelet.push_back(next_Point);
-        li.lineletIdx[next_Point] = nLinelet;
-      }
-      ++nLinelet;
+  /*--- Size of the chain of linelets ending with each linelet. ---*/
+  vector<unsigned long> chainSize(li.linelets.size());
+  for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); ++iLinelet) chainSize[iLinelet] = li.linelets[iLinelet].size();
 
-      maxNPoints = max<unsigned long>(maxNPoints, linelet.size());
-      sumNPoints += linelet.size();
+  constexpr int REQ_SIZE = 4;
+
+  while (acrossRanks) {
+    unsigned long nPending = pending.size(), nPendingGlobal = 0;
+    SU2_MPI::Allreduce(&nPending, &nPendingGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if (nPendingGlobal == 0) break;
+
+    /*--- Sort requests by destination rank, requests that would exceed the maximum size are dropped. ---*/
+    vector<std::pair<unsigned long, unsigned long> > requests;
+    vector<int> sendCount(size, 0), recvCount(size, 0), sendDisp(size + 1, 0), recvDisp(size + 1, 0);
+    for (const auto& p : pending) {
+      if (chainSize[p.first] >= CLineletInfo::MAX_LINELET_POINTS) continue;
+      requests.push_back(p);
+      sendCount[nodes->GetColor(p.second)] += REQ_SIZE;
+    }
+    std::stable_sort(requests.begin(), requests.end(), [&](const std::pair<unsigned long, unsigned long>& a,
+                                                           const std::pair<unsigned long, unsigned long>& b) {
+      return nodes->GetColor(a.second) < nodes->GetColor(b.second);
+    });
+    pending.clear();
+
+    SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendDisp[iRank + 1] = sendDisp[iRank] + sendCount[iRank];
+      recvDisp[iRank + 1] = recvDisp[iRank] + recvCount[iRank];
+    }
+
+    vector<unsigned long> sendBuf(sendDisp[size]), recvBuf(recvDisp[size]);
+    for (auto iReq = 0ul; iReq < requests.size(); ++iReq) {
+      const auto iLinelet = requests[iReq].first;
+      auto* req = &sendBuf[iReq * REQ_SIZE];
+      req[0] = nodes->GetGlobalIndex(requests[iReq].second);
+      req[1] = nodes->GetGlobalIndex(li.linelets[iLinelet].back());
+      req[2] = chainSize[iLinelet];
+      req[3] = li.lineletStage[iLinelet];
+    }
+    SU2_MPI::Alltoallv(sendBuf.data(), sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG, recvBuf.data(),
+                       recvCount.data(), recvDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    /*--- Process the received requests in order of start point for reproducibility. ---*/
+    const auto nRecv = recvBuf.size() / REQ_SIZE;
+    vector<unsigned long> order(nRecv);
+    std::iota(order.begin(), order.end(), 0ul);
+    std::stable_sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) {
+      return recvBuf[a * REQ_SIZE] < recvBuf[b * REQ_SIZE];
+    });
+
+    /*--- The replies are the accepted flags, in the order of the requests. ---*/
+    vector<unsigned long> replies(nRecv, 0);
+    for (const auto iReq : order) {
+      const auto* req = &recvBuf[iReq * REQ_SIZE];
+      const auto iPoint = GetGlobal_to_Local_Point(req[0]);
+      const auto kPoint = GetGlobal_to_Local_Point(req[1]);
+      if (iPoint < 0 || kPoint < 0 || !nodes->GetDomain(iPoint) ||
+          li.lineletIdx[iPoint] != CLineletInfo::NO_LINELET) continue;
+      replies[iReq] = 1;
+
+      const int srcRank = std::upper_bound(recvDisp.begin(), recvDisp.end(), int(iReq * REQ_SIZE)) - recvDisp.begin() - 1;
+      const auto stage = static_cast<unsigned short>(req[3] + 1);
+      const auto iLinelet = li.linelets.size();
+      addLinelet(iPoint, stage);
+      li.prevLinks.push_back({iLinelet, static_cast<unsigned long>(kPoint), srcRank, static_cast<unsigned short>(req[3])});
+      prevLinkKey.push_back(req[0]);
+
+      auto& linelet = li.linelets[iLinelet];
+      const auto last = grow(linelet, iLinelet, CLineletInfo::MAX_LINELET_POINTS - req[2], kPoint, true);
+      chainSize.push_back(req[2] + linelet.size());
+      if (!nodes->GetDomain(last)) pending.emplace_back(iLinelet, last);
+    }
+
+    /*--- Send the replies back, the accepted requests become links to the next linelet. ---*/
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendCount[iRank] /= REQ_SIZE; sendDisp[iRank] /= REQ_SIZE;
+      recvCount[iRank] /= REQ_SIZE; recvDisp[iRank] /= REQ_SIZE;
+    }
+    vector<unsigned long> accepted(requests.size());
+    SU2_MPI::Alltoallv(replies.data(), recvCount.data(), recvDisp.data(), MPI_UNSIGNED_LONG, accepted.data(),
+                       sendCount.data(), sendDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+    for (auto iReq = 0ul; iReq < requests.size(); ++iReq) {
+      if (!accepted[iReq]) continue;
+      const auto iLinelet = requests[iReq].first;
+      const auto jPoint = requests[iReq].second;
+      li.nextLinks.push_back({iLinelet, jPoint, static_cast<int>(nodes->GetColor(jPoint)), li.lineletStage[iLinelet]});
+      nextLinkKey.push_back(nodes->GetGlobalIndex(jPoint));
     }
   }
 
+  const unsigned long nLinelet = li.linelets.size();
+  unsigned long maxNPoints = 0, sumNPoints = 0;
+  for (const auto& linelet : li.linelets) {
+    maxNPoints = max<unsigned long>(maxNPoints, linelet.size());
+    sumNPoints += linelet.size();
+  }
+
   /*--- Average linelet size over all ranks. ---*/
 
   unsigned long globalNPoints, globalNLineLets;
   SU2_MPI::Allreduce(&sumNPoints, &globalNPoints, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&nLinelet, &globalNLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
-  if (rank == MASTER_NODE) {
+  if (rank == MASTER_NODE && globalNLineLets > 0) {
     std::cout << "Computed linelet structure, "
               << static_cast<unsigned long>(passivedouble(globalNPoints) / globalNLineLets)
               << " points in each line (average)." << std::endl;
@@ -3998,7 +4162,10 @@ const CGeometry::CLineletInfo& CGeometry::GetLineletInfo(const CConfig* config)
 
   /*--- Sort linelets by color. ---*/
   std::vector<std::vector<unsigned long>> sortedLinelets;
+  std::vector<unsigned short> sortedStages;
+  std::vector<unsigned long> newIdx(nLinelet);
   sortedLinelets.reserve(nLinelet);
+  sortedStages.reserve(nLinelet);
   li.colorOffsets.reserve(nColors + 1);
   li.colorOffsets.push_back(0);
 
@@ -4008,11 +4175,45 @@ const CGeometry::CLineletInfo& CGeometry::GetLineletInfo(const CConfig* config)
       for (const auto iPoint : li.linelets[iLine]) {
         li.lineletIdx[iPoint] = sortedLinelets.size();
       }
+      newIdx[iLine] = sortedLinelets.size();
       sortedLinelets.push_back(std::move(li.linelets[iLine]));
+      sortedStages.push_back(li.lineletStage[iLine]);
     }
     li.colorOffsets.push_back(sortedLinelets.size());
   }
   li.linelets = std::move(sortedLinelets);
+  li.lineletStage = std::move(sortedStages);
+
+  /*--- Sort the links by stage, rank, and key, and map them to the sorted linelets. ---*/
+
+  auto sortLinks = [&](vector<CLineletInfo::CLink>& links, const vector<unsigned long>& keys,
+                       vector<unsigned long>& linkIdx) {
+    vector<unsigned long> order(links.size());
+    std::iota(order.begin(), order.end(), 0ul);
+    std::sort(order.begin(), order.end(), [&](unsigned long a, unsigned long b) {
+      const auto& la = links[a];
+      const auto& lb = links[b];
+      if (la.stage != lb.stage) return la.stage < lb.stage;
+      if (la.rank != lb.rank) return la.rank < lb.rank;
+      return keys[a] < keys[b];
+    });
+    vector<CLineletInfo::CLink> sorted;
+    sorted.reserve(links.size());
+    linkIdx.assign(nLinelet, CLineletInfo::NO_LINK);
+    for (const auto i : order) {
+      sorted.push_back(links[i]);
+      sorted.back().linelet = newIdx[links[i].linelet];
+      linkIdx[sorted.back().linelet] = sorted.size() - 1;
+    }
+    links = std::move(sorted);
+  };
+  sortLinks(li.nextLinks, nextLinkKey, li.nextLinkIdx);
+  sortLinks(li.prevLinks, prevLinkKey, li.prevLinkIdx);
+
+  /*--- Number of stages, the same on all ranks. ---*/
+  unsigned short nStages = 1;
+  for (const auto stage : li.lineletStage) nStages = max<unsigned short>(nStages, stage + 1);
+  SU2_MPI::Allreduce(&nStages, &li.nStages, 1, MPI_UNSIGNED_SHORT, MPI_MAX, SU2_MPI::GetComm());
 
   /*--- For visualization, offset colors to avoid coloring across ranks. ---*/
   std::vector<unsigned long> allNColors(size);
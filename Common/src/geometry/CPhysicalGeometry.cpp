@@ -6667,6 +6667,19 @@ void CPhysicalGeometry::SetMaxLength(CConfig* config) {
   }
   END_SU2_OMP_FOR
 
+  /*--- The per direction distances to the neighbors are only needed by the length scales
+   *    of hybrid RANS/LES models, they are updated whenever the max length is. ---*/
+
+  if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(nodes->AllocateNeighborDelta();)
+
+    SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      nodes->SetNeighborDelta(iPoint);
+    }
+    END_SU2_OMP_FOR
+  }
+
   InitiateComms(this, config, MAX_LENGTH);
   CompleteComms(this, config, MAX_LENGTH);
 
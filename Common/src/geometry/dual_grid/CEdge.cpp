@@ -27,16 +27,13 @@
 
 #include "../../../include/geometry/dual_grid/CEdge.hpp"
 #include "../../../include/toolboxes/geometry_toolbox.hpp"
-#include "../../../include/parallelization/omp_structure.hpp"
 
 using namespace GeometryToolbox;
 
 CEdge::CEdge(unsigned long nEdge_, unsigned long nDim)
-  : nEdge(nEdge_),
-    nEdgeSIMD(nextMultiple(nEdge_, simd::preferredLen<su2double>())) {
-  /*--- Allocate with padding. ---*/
-  Nodes.resize(nEdgeSIMD,2) = 0;
-  Normal.resize(nEdgeSIMD,nDim) = su2double(0.0);
+  : nEdge(nEdge_) {
+  Nodes.resize(nEdge,2) = 0;
+  Normal.resize(nEdge,nDim) = su2double(0.0);
 }
 
 void CEdge::SetZeroValues(void) {
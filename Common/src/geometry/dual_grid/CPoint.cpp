@@ -28,6 +28,7 @@
 #include "../../../include/geometry/dual_grid/CPoint.hpp"
 #include "../../../include/CConfig.hpp"
 #include "../../../include/parallelization/omp_structure.hpp"
+#include "../../../include/toolboxes/geometry_toolbox.hpp"
 
 CPoint::CPoint(unsigned long npoint, unsigned long ndim) : nDim(ndim) {
 
@@ -154,6 +155,33 @@ void CPoint::SetPoints(const vector<vector<unsigned long> >& pointsMatrix) {
   Edge = CCompressedSparsePatternL(Point.outerPtr(), Point.outerPtr()+Point.getOuterSize()+1, long(-1));
 }
 
+void CPoint::AllocateNeighborDelta() {
+
+  if (NeighborDelta.rows() == Point.getNumNonZeros()) return;
+
+  MaxDelta.resize(MaxLength.size(), nDim) = su2double(0.0);
+  MinLength.resize(MaxLength.size()) = su2double(0.0);
+  NeighborDelta.resize(Point.getNumNonZeros(), nDim) = su2double(0.0);
+}
+
+void CPoint::SetNeighborDelta(unsigned long iPoint) {
+
+  for (unsigned long iDim = 0; iDim < nDim; iDim++) MaxDelta(iPoint,iDim) = 0.0;
+
+  MinLength(iPoint) = MaxLength(iPoint);
+
+  const auto offset = Point.outerPtr()[iPoint];
+
+  for (unsigned long iNeigh = 0; iNeigh < Point.getNumNonZeros(iPoint); iNeigh++) {
+    const auto jPoint = Point.getInnerIdx(iPoint, iNeigh);
+    for (unsigned long iDim = 0; iDim < nDim; iDim++) {
+      NeighborDelta(offset+iNeigh, iDim) = fabs(Coord(jPoint,iDim) - Coord(iPoint,iDim));
+      MaxDelta(iPoint,iDim) = max(MaxDelta(iPoint,iDim), NeighborDelta(offset+iNeigh, iDim));
+    }
+    MinLength(iPoint) = min(MinLength(iPoint), GeometryToolbox::Norm(nDim, NeighborDelta[offset+iNeigh]));
+  }
+}
+
 void CPoint::SetVolume_n() {
   assert(Volume_n.size() == Volume.size());
   parallelCopy(Volume.size(), Volume.data(), Volume_n.data());
@@ -0,0 +1,506 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the aggregation-based algebraic multigrid preconditioner.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysMatrix.inl"
+
+#include <algorithm>
+
+namespace {
+/*!
+ * \brief Frobenius norm of a block, used to measure the strength of the connections.
+ */
+template<class T>
+passivedouble BlockNorm(const T* block, unsigned long size) {
+  passivedouble norm = 0.0;
+  for (auto k = 0ul; k < size; ++k) norm += pow(SU2_TYPE::GetValue(block[k]), 2);
+  return sqrt(norm);
+}
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(const CSysMatrix<ScalarType>& mat, const CConfig* config) {
+
+  const auto nVar = mat.nVar;
+  const auto blkSize = nVar*nVar;
+
+  /*--- The aggregates and coarse patterns only depend on the sparse pattern (and on the values
+   *    at the time of the first build), they are kept while the matrix is the same. ---*/
+
+  if (nLevels == 0 || levels[0].row_ptr != mat.row_ptr) {
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      const auto maxLevels = max<unsigned short>(config->GetLinear_Solver_AMG_Levels(), 1);
+      nSweeps = max<unsigned short>(config->GetLinear_Solver_AMG_Sweeps(), 1);
+      strength = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+
+      /*--- Size for the max number of levels to keep references valid while coarsening. ---*/
+      levels.clear();
+      levels.resize(maxLevels);
+
+      /*--- The fine level uses the matrix data, halo columns are ignored. ---*/
+      auto& fine = levels[0];
+      fine.nPoint = mat.nPointDomain;
+      fine.row_ptr = mat.row_ptr;
+      fine.col_ind = mat.col_ind;
+      fine.dia_ptr = mat.dia_ptr;
+      fine.matrix = mat.matrix;
+      fine.partitions.assign(mat.omp_partitions, mat.omp_partitions+mat.omp_num_parts+1);
+      fine.invDiag.resize(fine.nPoint*blkSize);
+      fine.res.resize(fine.nPoint*nVar);
+      nLevels = 1;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    for (unsigned short iLevel = 0; iLevel+1ul < levels.size(); ++iLevel) {
+      if (!Coarsen(mat, iLevel)) break;
+    }
+  }
+
+  /*--- Numerical part, coarse operators and inverse diagonal blocks for the smoother. ---*/
+
+  for (unsigned short iLevel = 1; iLevel < nLevels; ++iLevel)
+    ComputeGalerkinProduct(mat, iLevel);
+
+  for (unsigned short iLevel = 0; iLevel < nLevels; ++iLevel) {
+    auto& level = levels[iLevel];
+
+    SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+    for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+      ScalarType block[CSysMatrix<ScalarType>::MAXNVAR*CSysMatrix<ScalarType>::MAXNVAR];
+      mat.MatrixCopy(&level.matrix[level.dia_ptr[iPoint]*blkSize], block);
+      mat.MatrixInverse(block, &level.invDiag[iPoint*blkSize]);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template<class ScalarType>
+bool CAlgebraicMultigrid<ScalarType>::Coarsen(const CSysMatrix<ScalarType>& mat, unsigned short iLevel) {
+
+  const auto nVar = mat.nVar;
+  const auto blkSize = nVar*nVar;
+
+  auto& fine = levels[iLevel];
+  auto& coarse = levels[iLevel+1];
+  const auto nParts = fine.nParts();
+
+  /*--- Not worth coarsening further. ---*/
+  if (fine.nPoint <= MIN_COARSE_POINTS*nParts) return false;
+
+  /*--- The threshold is relaxed on coarse levels as the operators become less anisotropic. ---*/
+  const passivedouble theta = strength * pow(0.5, iLevel);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    fine.aggregate.assign(fine.nPoint, NOT_SET);
+    coarse.partitions.assign(nParts+1, 0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Aggregation, each partition of the fine level produces a partition of the coarse level. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+    const auto begin = fine.partitions[iPart];
+    const auto end = fine.partitions[iPart+1];
+    if (begin == end) continue;
+
+    auto& agg = fine.aggregate;
+
+    vector<passivedouble> diagNorm(end-begin);
+    for (auto iPoint = begin; iPoint < end; ++iPoint)
+      diagNorm[iPoint-begin] = BlockNorm(&fine.matrix[fine.dia_ptr[iPoint]*blkSize], blkSize);
+
+    /*--- Strength of the connection of a non zero with its row, 0 if not strong. ---*/
+    auto strongValue = [&](unsigned long iPoint, unsigned long k) {
+      const auto jPoint = fine.col_ind[k];
+      if (jPoint == iPoint || jPoint < begin || jPoint >= end) return passivedouble(0);
+      const auto norm = BlockNorm(&fine.matrix[k*blkSize], blkSize);
+      const auto ref = theta * sqrt(diagNorm[iPoint-begin] * diagNorm[jPoint-begin]);
+      return (norm >= ref && norm > 0)? norm : passivedouble(0);
+    };
+
+    unsigned long nAgg = 0;
+
+    /*--- 1st pass, points whose strong neighbors are all free become the roots of aggregates. ---*/
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != NOT_SET) continue;
+      bool isolated = true, free = true;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1] && free; ++k) {
+        if (strongValue(iPoint, k) == 0) continue;
+        isolated = false;
+        free = (agg[fine.col_ind[k]] == NOT_SET);
+      }
+      if (isolated || !free) continue;
+
+      agg[iPoint] = nAgg;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k)
+        if (strongValue(iPoint, k) > 0) agg[fine.col_ind[k]] = nAgg;
+      ++nAgg;
+    }
+
+    /*--- 2nd pass, join the remaining points to the aggregate of their strongest neighbor.
+     *    The choices are only applied at the end so that aggregates grow by one layer. ---*/
+
+    vector<unsigned long> join(end-begin, NOT_SET);
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != NOT_SET) continue;
+      passivedouble maxValue = 0;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto value = strongValue(iPoint, k);
+        const auto jAgg = (value > 0)? agg[fine.col_ind[k]] : NOT_SET;
+        if (jAgg != NOT_SET && value > maxValue) {
+          maxValue = value;
+          join[iPoint-begin] = jAgg;
+        }
+      }
+    }
+    for (auto iPoint = begin; iPoint < end; ++iPoint)
+      if (join[iPoint-begin] != NOT_SET) agg[iPoint] = join[iPoint-begin];
+
+    /*--- 3rd pass, new aggregates with what is left (isolated points become singletons). ---*/
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) {
+      if (agg[iPoint] != NOT_SET) continue;
+      agg[iPoint] = nAgg;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        if (strongValue(iPoint, k) > 0 && agg[fine.col_ind[k]] == NOT_SET)
+          agg[fine.col_ind[k]] = nAgg;
+      }
+      ++nAgg;
+    }
+
+    coarse.partitions[iPart+1] = nAgg;
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    for (auto iPart = 0ul; iPart < nParts; ++iPart)
+      coarse.partitions[iPart+1] += coarse.partitions[iPart];
+    coarse.nPoint = coarse.partitions[nParts];
+
+    coarsen = (coarse.nPoint <= MAX_COARSENING_RATIO * fine.nPoint);
+
+    if (coarsen) {
+      fine.aggPtr.resize(coarse.nPoint+1);
+      fine.aggPtr[0] = 0;
+      fine.aggPoints.resize(fine.nPoint);
+    }
+    else {
+      fine.aggregate.clear();
+      coarse = CLevel();
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  if (!coarsen) return false;
+
+  /*--- Global numbering of the aggregates and lists of points of each aggregate. The aggregates
+   *    of a partition only contain points of the partition, hence the lists can be built locally. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+    const auto begin = fine.partitions[iPart];
+    const auto end = fine.partitions[iPart+1];
+    const auto cBegin = coarse.partitions[iPart];
+    const auto cEnd = coarse.partitions[iPart+1];
+    if (begin == end) continue;
+
+    auto& agg = fine.aggregate;
+    auto& ptr = fine.aggPtr;
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint) agg[iPoint] += cBegin;
+
+    for (auto iAgg = cBegin; iAgg < cEnd; ++iAgg) ptr[iAgg+1] = 0;
+    for (auto iPoint = begin; iPoint < end; ++iPoint) ++ptr[agg[iPoint]+1];
+
+    /*--- The points of the partition start at "begin" in the lists. ---*/
+    ptr[cBegin+1] += begin;
+    for (auto iAgg = cBegin+1; iAgg < cEnd; ++iAgg) ptr[iAgg+1] += ptr[iAgg];
+
+    vector<unsigned long> pos(cEnd-cBegin);
+    pos[0] = begin;
+    for (auto iAgg = cBegin+1; iAgg < cEnd; ++iAgg) pos[iAgg-cBegin] = ptr[iAgg];
+
+    for (auto iPoint = begin; iPoint < end; ++iPoint)
+      fine.aggPoints[pos[agg[iPoint]-cBegin]++] = iPoint;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Sparse pattern of the coarse operator, first count the non zeros of each row. ---*/
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(coarse.rowPtr.resize(coarse.nPoint+1); coarse.rowPtr[0] = 0;)
+
+  auto coarseRow = [&](unsigned long iAgg, vector<unsigned long>& cols) {
+    cols.clear();
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg+1]; ++p) {
+      const auto iPoint = fine.aggPoints[p];
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint < fine.nPoint) cols.push_back(fine.aggregate[jPoint]);
+      }
+    }
+    sort(cols.begin(), cols.end());
+    cols.resize(unique(cols.begin(), cols.end()) - cols.begin());
+  };
+
+  vector<unsigned long> cols;
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+    coarseRow(iAgg, cols);
+    coarse.rowPtr[iAgg+1] = cols.size();
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg)
+      coarse.rowPtr[iAgg+1] += coarse.rowPtr[iAgg];
+    const auto nnz = coarse.rowPtr[coarse.nPoint];
+
+    coarse.colInd.resize(nnz);
+    coarse.diaPtr.resize(coarse.nPoint);
+    coarse.values.resize(nnz*blkSize);
+    coarse.invDiag.resize(coarse.nPoint*blkSize);
+    coarse.sol.resize(coarse.nPoint*nVar);
+    coarse.rhs.resize(coarse.nPoint*nVar);
+    coarse.res.resize(coarse.nPoint*nVar);
+    fine.galerkinMap.resize(fine.row_ptr[fine.nPoint]);
+
+    coarse.row_ptr = coarse.rowPtr.data();
+    coarse.col_ind = coarse.colInd.data();
+    coarse.dia_ptr = coarse.diaPtr.data();
+    coarse.matrix = coarse.values.data();
+
+    nLevels = iLevel+2;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Fill the pattern and map the fine non zeros to the coarse ones. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+    coarseRow(iAgg, cols);
+
+    const auto first = coarse.colInd.begin() + coarse.rowPtr[iAgg];
+    copy(cols.begin(), cols.end(), first);
+    coarse.diaPtr[iAgg] = lower_bound(first, first+cols.size(), iAgg) - coarse.colInd.begin();
+
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg+1]; ++p) {
+      const auto iPoint = fine.aggPoints[p];
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint >= fine.nPoint) {
+          fine.galerkinMap[k] = NOT_SET;
+          continue;
+        }
+        fine.galerkinMap[k] = lower_bound(first, first+cols.size(), fine.aggregate[jPoint]) - coarse.colInd.begin();
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+
+  return true;
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::ComputeGalerkinProduct(const CSysMatrix<ScalarType>& mat, unsigned short iLevel) {
+
+  const auto blkSize = mat.nVar*mat.nVar;
+  const auto& fine = levels[iLevel-1];
+  auto& coarse = levels[iLevel];
+
+  /*--- With piecewise constant transfer operators, each block of the coarse operator is
+   *    the sum of the fine blocks that couple the respective pair of aggregates.
+   *    All contributions to a coarse row come from the points of its aggregate. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+
+    for (auto k = coarse.rowPtr[iAgg]*blkSize; k < coarse.rowPtr[iAgg+1]*blkSize; ++k)
+      coarse.values[k] = 0.0;
+
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg+1]; ++p) {
+      const auto iPoint = fine.aggPoints[p];
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint+1]; ++k) {
+        const auto kc = fine.galerkinMap[k];
+        if (kc == NOT_SET) continue;
+        for (auto i = 0ul; i < blkSize; ++i)
+          coarse.values[kc*blkSize+i] += fine.matrix[k*blkSize+i];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CSysMatrix<ScalarType>& mat, unsigned short iLevel, bool forward,
+                                             const ScalarType* rhs, ScalarType* sol) const {
+  const auto nVar = mat.nVar;
+  const auto blkSize = nVar*nVar;
+  const auto& level = levels[iLevel];
+
+  /*--- Since the sweep starts from zero, each rhs entry is used only before the corresponding
+   *    entry of sol is computed, therefore this also works in place (rhs == sol). ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < level.nParts(); ++iPart) {
+    const auto begin = level.partitions[iPart];
+    const auto end = level.partitions[iPart+1];
+    if (begin == end) continue;
+
+    ScalarType aux[CSysMatrix<ScalarType>::MAXNVAR];
+
+    if (forward) {
+      for (auto iPoint = begin; iPoint < end; ++iPoint) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) aux[iVar] = rhs[iPoint*nVar+iVar];
+
+        for (auto k = level.row_ptr[iPoint]; k < level.dia_ptr[iPoint]; ++k) {
+          const auto jPoint = level.col_ind[k];
+          if (jPoint < begin) continue;
+          mat.MatrixVectorProductSub(&level.matrix[k*blkSize], &sol[jPoint*nVar], aux);
+        }
+        mat.MatrixVectorProduct(&level.invDiag[iPoint*blkSize], aux, &sol[iPoint*nVar]);
+      }
+    }
+    else {
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--; // unsigned type
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) aux[iVar] = rhs[iPoint*nVar+iVar];
+
+        for (auto k = level.dia_ptr[iPoint]+1; k < level.row_ptr[iPoint+1]; ++k) {
+          const auto jPoint = level.col_ind[k];
+          if (jPoint >= end) break;
+          mat.MatrixVectorProductSub(&level.matrix[k*blkSize], &sol[jPoint*nVar], aux);
+        }
+        mat.MatrixVectorProduct(&level.invDiag[iPoint*blkSize], aux, &sol[iPoint*nVar]);
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Residual(const CSysMatrix<ScalarType>& mat, unsigned short iLevel,
+                                               const ScalarType* rhs, const ScalarType* sol, ScalarType* res) const {
+  const auto nVar = mat.nVar;
+  const auto blkSize = nVar*nVar;
+  const auto& level = levels[iLevel];
+
+  SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+  for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+    ScalarType aux[CSysMatrix<ScalarType>::MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) aux[iVar] = rhs[iPoint*nVar+iVar];
+
+    for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = level.col_ind[k];
+      if (jPoint >= level.nPoint) continue;
+      mat.MatrixVectorProductSub(&level.matrix[k*blkSize], &sol[jPoint*nVar], aux);
+    }
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iPoint*nVar+iVar] = aux[iVar];
+  }
+  END_SU2_OMP_FOR
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(const CSysMatrix<ScalarType>& mat, unsigned short iLevel,
+                                            const ScalarType* rhs, ScalarType* sol) const {
+  const auto nVar = mat.nVar;
+  const auto& level = levels[iLevel];
+  const auto n = level.nPoint*nVar;
+  auto res = level.res.data();
+
+  /*--- Smoothing in correction form, sol += S(rhs - A*sol). ---*/
+  auto correct = [&](bool forward) {
+    Residual(mat, iLevel, rhs, sol, res);
+    Smooth(mat, iLevel, forward, res, res);
+    SU2_OMP_FOR_STAT(OMP_MAX_SIZE)
+    for (auto i = 0ul; i < n; ++i) sol[i] += res[i];
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Pre-smoothing. ---*/
+  Smooth(mat, iLevel, true, rhs, sol);
+  for (auto iSweep = 1u; iSweep < nSweeps; ++iSweep) correct(true);
+
+  /*--- Coarse grid correction. ---*/
+  if (iLevel+1u < nLevels) {
+    const auto& coarse = levels[iLevel+1];
+
+    Residual(mat, iLevel, rhs, sol, res);
+
+    /*--- Restriction, sum of the residuals of each aggregate. ---*/
+    SU2_OMP_FOR_DYN(OMP_MAX_SIZE)
+    for (auto iAgg = 0ul; iAgg < coarse.nPoint; ++iAgg) {
+      auto coarseRhs = &coarse.rhs[iAgg*nVar];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarseRhs[iVar] = 0.0;
+
+      for (auto p = level.aggPtr[iAgg]; p < level.aggPtr[iAgg+1]; ++p) {
+        const auto iPoint = level.aggPoints[p];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) coarseRhs[iVar] += res[iPoint*nVar+iVar];
+      }
+    }
+    END_SU2_OMP_FOR
+
+    Cycle(mat, iLevel+1, coarse.rhs.data(), coarse.sol.data());
+
+    /*--- Prolongation, injection of the aggregate correction. ---*/
+    SU2_OMP_FOR_STAT(OMP_MAX_SIZE)
+    for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+      const auto iAgg = level.aggregate[iPoint];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sol[iPoint*nVar+iVar] += coarse.sol[iAgg*nVar+iVar];
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Post-smoothing, backward sweeps to keep the cycle symmetric. ---*/
+  for (auto iSweep = 0u; iSweep < nSweeps; ++iSweep) correct(false);
+}
+
+template<class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const CSysMatrix<ScalarType>& mat, const CSysVector<ScalarType>& vec,
+                                            CSysVector<ScalarType>& prod) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  Cycle(mat, 0, &vec[0], &prod[0]);
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#endif
+#endif
@@ -0,0 +1,184 @@
+/*!
+ * \file CSellMatrix.cpp
+ * \brief Implementation of the sliced ELLPACK (SELL-C-sigma) matrix-vector product.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysMatrix.inl"
+
+#include <algorithm>
+#include <numeric>
+
+template<class ScalarType>
+void CSellMatrix<ScalarType>::Initialize(const CSysMatrix<ScalarType>& mat) {
+
+  nVar = mat.nVar;
+  nEqn = mat.nEqn;
+
+  if (nVar > MAXNVAR || nEqn > MAXNVAR) {
+    SU2_MPI::Error("nVar larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+  }
+
+  /*--- Without halo exchange all rows form the first group, and the second is empty. ---*/
+
+  std::vector<unsigned long> allRows;
+  const std::vector<unsigned long>* groups[] = {&mat.send_rows, &mat.inner_rows};
+
+  if (mat.send_rows.empty()) {
+    allRows.resize(mat.nPointDomain);
+    std::iota(allRows.begin(), allRows.end(), 0ul);
+    groups[0] = &allRows;
+  }
+
+  auto rowLength = [&](unsigned long iPoint) { return mat.row_ptr[iPoint+1] - mat.row_ptr[iPoint]; };
+
+  slicePtr.assign(1, 0);
+  sliceRows.clear();
+  colIdx.clear();
+  nzIdx.clear();
+
+  for (auto iGroup = 0ul; iGroup < 2; ++iGroup) {
+
+    /*--- Sort by decreasing length within each window of SIGMA rows, the sort is stable
+     *    to keep the original (bandwidth reducing) order of rows with the same length. ---*/
+
+    auto rows = *groups[iGroup];
+    const auto nRows = rows.size();
+
+    for (auto begin = 0ul; begin < nRows; begin += SIGMA) {
+      const auto end = std::min(begin + SIGMA, nRows);
+      std::stable_sort(rows.begin() + begin, rows.begin() + end,
+                       [&](unsigned long a, unsigned long b) { return rowLength(a) > rowLength(b); });
+    }
+
+    for (auto first = 0ul; first < nRows; first += C) {
+
+      /*--- Rows of the slice, the last slice is padded with the first row (whose results are not stored). ---*/
+
+      unsigned long width = 0;
+      for (auto iLane = 0ul; iLane < C; ++iLane) {
+        const bool padded = (first + iLane >= nRows);
+        sliceRows.push_back(padded? PADDING : rows[first + iLane]);
+        if (!padded) width = std::max(width, rowLength(rows[first + iLane]));
+      }
+      const auto* lanes = &sliceRows[sliceRows.size() - C];
+
+      /*--- The diagonal goes first, then the other blocks of the row in the original order. ---*/
+
+      for (auto k = 0ul; k < width; ++k) {
+        for (auto iLane = 0ul; iLane < C; ++iLane) {
+          const auto iPoint = lanes[iLane];
+
+          if (iPoint == PADDING || k >= rowLength(iPoint)) {
+            /*--- Any valid column will do since the padding blocks are zero. ---*/
+            colIdx.push_back(iPoint == PADDING? lanes[0] : iPoint);
+            nzIdx.push_back(PADDING);
+            continue;
+          }
+          const auto nDiag = mat.dia_ptr[iPoint] - mat.row_ptr[iPoint];
+          const auto index = (k == 0)? mat.dia_ptr[iPoint] : mat.row_ptr[iPoint] + k - (k <= nDiag);
+
+          colIdx.push_back(mat.col_ind[index]);
+          nzIdx.push_back(index);
+        }
+      }
+      slicePtr.push_back(slicePtr.back() + width);
+    }
+    groupPtr[iGroup+1] = slicePtr.size() - 1;
+  }
+
+  values.resize(slicePtr.back()*C*nVar*nEqn);
+  valid = false;
+}
+
+template<class ScalarType>
+void CSellMatrix<ScalarType>::UpdateValues(const CSysMatrix<ScalarType>& mat) {
+
+  /*--- Nothing to do if the matrix did not change since the last update. ---*/
+  if (values.empty() || valid) return;
+
+  const auto blkSize = nVar*nEqn;
+  const auto nEntries = slicePtr.back();
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE*C)
+  for (auto k = 0ul; k < nEntries; ++k) {
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      const auto index = nzIdx[k*C + iLane];
+      for (auto i = 0ul; i < blkSize; ++i)
+        values[(k*blkSize + i)*C + iLane] = (index == PADDING)? ScalarType(0) : mat.matrix[index*blkSize + i];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(valid = true;)
+}
+
+template<class ScalarType>
+void CSellMatrix<ScalarType>::Product(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                      unsigned long iGroup) const {
+
+  const auto blkSize = nVar*nEqn;
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iSlice = groupPtr[iGroup]; iSlice < groupPtr[iGroup+1]; ++iSlice) {
+
+    /*--- The innermost loops are over the lanes (rows of the slice), for vectorization. ---*/
+
+    ScalarType sum[MAXNVAR][C];
+    for (auto i = 0ul; i < nVar; ++i)
+      for (auto iLane = 0ul; iLane < C; ++iLane) sum[i][iLane] = 0.0;
+
+    for (auto k = slicePtr[iSlice]; k < slicePtr[iSlice+1]; ++k) {
+      const auto* cols = &colIdx[k*C];
+      const auto* block = &values[k*blkSize*C];
+
+      for (auto j = 0ul; j < nEqn; ++j) {
+        ScalarType x[C];
+        for (auto iLane = 0ul; iLane < C; ++iLane) x[iLane] = vec[cols[iLane]*nEqn + j];
+
+        for (auto i = 0ul; i < nVar; ++i) {
+          const auto* a_ij = &block[(i*nEqn + j)*C];
+          for (auto iLane = 0ul; iLane < C; ++iLane) sum[i][iLane] += a_ij[iLane] * x[iLane];
+        }
+      }
+    }
+
+    const auto* rows = &sliceRows[iSlice*C];
+    for (auto iLane = 0ul; iLane < C; ++iLane) {
+      if (rows[iLane] == PADDING) break;
+      for (auto i = 0ul; i < nVar; ++i) prod[rows[iLane]*nVar + i] = sum[i][iLane];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CSellMatrix<su2double>;
+#else
+template class CSellMatrix<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CSellMatrix<passivedouble>;
+#endif
+#endif
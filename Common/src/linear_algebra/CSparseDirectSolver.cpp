@@ -0,0 +1,422 @@
+/*!
+ * \file CSparseDirectSolver.cpp
+ * \brief Implementation of the built-in sparse direct solver.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysMatrix.inl"
+#include "../../include/CConfig.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#ifdef HAVE_METIS
+#include "metis.h"
+#endif
+
+template<class ScalarType>
+void CSparseDirectSolver<ScalarType>::Order(const CSysMatrix<ScalarType>& mat) {
+
+  const auto n = nPoint;
+  perm.resize(n);
+  iperm.resize(n);
+
+  /*--- Graph of the domain points, without the diagonal and the halo columns. ---*/
+
+  std::vector<unsigned long> xadj(n+1, 0), adj;
+  adj.reserve(mat.row_ptr[n]);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto idx = mat.row_ptr[i]; idx < mat.row_ptr[i+1]; ++idx) {
+      const auto j = mat.col_ind[idx];
+      if (j != i && j < n) adj.push_back(j);
+    }
+    xadj[i+1] = adj.size();
+  }
+
+#ifdef HAVE_METIS
+  {
+    auto nv = static_cast<idx_t>(n);
+    std::vector<idx_t> xadjM(xadj.begin(), xadj.end()), adjM(adj.begin(), adj.end()), permM(n), ipermM(n);
+    idx_t options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+    options[METIS_OPTION_NUMBERING] = 0;
+
+    /*--- perm is "new to old" (row i of the permuted matrix is row perm[i] of the original). ---*/
+    if (n > 0 && !adj.empty() &&
+        METIS_NodeND(&nv, xadjM.data(), adjM.data(), nullptr, options, permM.data(), ipermM.data()) == METIS_OK) {
+      for (auto i = 0ul; i < n; ++i) {
+        perm[i] = permM[i];
+        iperm[perm[i]] = i;
+      }
+      return;
+    }
+  }
+#endif
+
+  /*--- Recursive bisection with level set separators. The points of each subgraph are a range of "verts",
+   *    the separator of a subgraph is numbered after (above) the two halves, which are dissected in turn.
+   *    A depth first traversal (explicit stack) keeps the numbers of each subtree contiguous. ---*/
+
+  std::vector<unsigned long> verts(n), level(n), inSet(n, NOT_SET), visited(n, NOT_SET), queue, tmp;
+  std::iota(verts.begin(), verts.end(), 0ul);
+  std::vector<std::pair<unsigned long, unsigned long> > stack;
+  if (n > 0) stack.emplace_back(0ul, n);
+
+  unsigned long next = n, nSets = 0, nSearches = 0;
+
+  auto number = [&](unsigned long v) { perm[--next] = v; };
+
+  /*--- Breadth first search within a subgraph, the queue ends up sorted by level, returns the last point. ---*/
+  auto bfs = [&](unsigned long root, unsigned long set) {
+    const auto stamp = nSearches++;
+    queue.clear();
+    queue.push_back(root);
+    visited[root] = stamp;
+    level[root] = 0;
+    for (auto k = 0ul; k < queue.size(); ++k) {
+      const auto v = queue[k];
+      for (auto p = xadj[v]; p < xadj[v+1]; ++p) {
+        const auto w = adj[p];
+        if (inSet[w] != set || visited[w] == stamp) continue;
+        visited[w] = stamp;
+        level[w] = level[v] + 1;
+        queue.push_back(w);
+      }
+    }
+    return queue.back();
+  };
+
+  while (!stack.empty()) {
+    const auto begin = stack.back().first;
+    const auto end = stack.back().second;
+    stack.pop_back();
+
+    if (end - begin <= ND_LEAF_SIZE) {
+      for (auto k = end; k > begin;) number(verts[--k]);
+      continue;
+    }
+
+    const auto set = nSets++;
+    for (auto k = begin; k < end; ++k) inSet[verts[k]] = set;
+
+    /*--- Pseudo-peripheral root (the end of a BFS), the second BFS gives the level structure. ---*/
+    bfs(bfs(verts[begin], set), set);
+    const auto stamp = nSearches-1;
+    const auto height = level[queue.back()];
+
+    tmp.clear();
+
+    if (queue.size() < end - begin) {
+      /*--- Disconnected, the reached component and the rest are independent. ---*/
+      tmp = queue;
+      const auto mid = begin + tmp.size();
+      for (auto k = begin; k < end; ++k) if (visited[verts[k]] != stamp) tmp.push_back(verts[k]);
+      std::copy(tmp.begin(), tmp.end(), verts.begin()+begin);
+      stack.emplace_back(begin, mid);
+      stack.emplace_back(mid, end);
+      continue;
+    }
+
+    if (height < 2) {
+      /*--- Nearly complete graph, nothing to gain. ---*/
+      for (auto k = end; k > begin;) number(verts[--k]);
+      continue;
+    }
+
+    /*--- Middle level, only its points connected to the next level are needed to separate the halves. ---*/
+    const auto m = std::max<unsigned long>(1, std::min(level[queue[(end-begin)/2]], height-1));
+
+    for (auto v : queue) {
+      if (level[v] < m) {
+        tmp.push_back(v);
+      } else if (level[v] == m) {
+        bool sep = false;
+        for (auto p = xadj[v]; p < xadj[v+1] && !sep; ++p)
+          sep = (inSet[adj[p]] == set) && (level[adj[p]] > m);
+        if (sep) number(v);
+        else tmp.push_back(v);
+      }
+    }
+    const auto mid = begin + tmp.size();
+    for (auto v : queue) if (level[v] > m) tmp.push_back(v);
+    std::copy(tmp.begin(), tmp.end(), verts.begin()+begin);
+
+    stack.emplace_back(begin, mid);
+    stack.emplace_back(mid, begin + tmp.size());
+  }
+
+  if (next != 0) SU2_MPI::Error("Nested dissection failed to number all points.", CURRENT_FUNCTION);
+
+  for (auto i = 0ul; i < n; ++i) iperm[perm[i]] = i;
+}
+
+template<class ScalarType>
+void CSparseDirectSolver<ScalarType>::SymbolicFactorization(const CSysMatrix<ScalarType>& mat) {
+
+  const auto n = nPoint;
+
+  /*--- Lower neighbors of each row in the new numbering (the pattern of the matrix is symmetric). ---*/
+  std::vector<unsigned long> lower;
+  auto getLower = [&](unsigned long i) -> const std::vector<unsigned long>& {
+    lower.clear();
+    const auto oi = perm[i];
+    for (auto idx = mat.row_ptr[oi]; idx < mat.row_ptr[oi+1]; ++idx) {
+      const auto oj = mat.col_ind[idx];
+      if (oj < n && iperm[oj] < i) lower.push_back(iperm[oj]);
+    }
+    return lower;
+  };
+
+  /*--- Elimination tree (Liu's algorithm with path compression). ---*/
+
+  std::vector<unsigned long> parent(n, NOT_SET), ancestor(n, NOT_SET);
+
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto k : getLower(i)) {
+      auto r = k;
+      while (ancestor[r] != NOT_SET && ancestor[r] != i) {
+        const auto t = ancestor[r];
+        ancestor[r] = i;
+        r = t;
+      }
+      if (ancestor[r] == NOT_SET) {
+        ancestor[r] = i;
+        parent[r] = i;
+      }
+    }
+  }
+
+  /*--- Pattern of each row of L, the union of the paths in the tree from its lower neighbors to the row. ---*/
+
+  std::vector<unsigned long> flag(n, NOT_SET);
+  Lptr.assign(n+1, 0);
+  Lcol.clear();
+
+  for (auto i = 0ul; i < n; ++i) {
+    const auto start = Lcol.size();
+    flag[i] = i;
+    for (auto k : getLower(i)) {
+      for (; flag[k] != i; k = parent[k]) {
+        flag[k] = i;
+        Lcol.push_back(k);
+      }
+    }
+    std::sort(Lcol.begin()+start, Lcol.end());
+    Lptr[i+1] = Lcol.size();
+  }
+
+  /*--- U has the transposed pattern, the rows are sorted because L is traversed by rows. ---*/
+
+  Uptr.assign(n+1, 0);
+  for (auto k : Lcol) ++Uptr[k+1];
+  for (auto i = 0ul; i < n; ++i) Uptr[i+1] += Uptr[i];
+
+  Ucol.resize(Lcol.size());
+  LtoU.resize(Lcol.size());
+  std::vector<unsigned long> pos(Uptr.begin(), Uptr.end()-1);
+
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto p = Lptr[i]; p < Lptr[i+1]; ++p) {
+      const auto q = pos[Lcol[p]]++;
+      Ucol[q] = i;
+      LtoU[p] = q;
+    }
+  }
+}
+
+template<class ScalarType>
+void CSparseDirectSolver<ScalarType>::NumericFactorization(const CSysMatrix<ScalarType>& mat) {
+
+  const auto n = nPoint;
+  const auto bs = nVar*nVar;
+
+  if (!symmetric) Lval.resize(Lcol.size()*bs);
+  Uval.resize(Ucol.size()*bs);
+  invD.resize(n*bs);
+
+  unsigned long maxRowL = 0;
+  for (auto i = 0ul; i < n; ++i) maxRowL = std::max(maxRowL, Lptr[i+1]-Lptr[i]);
+
+  /*--- The blocks of row i are computed in place, colPtr maps the columns to their storage. ---*/
+  std::vector<ScalarType*> colPtr(n, nullptr);
+  std::vector<ScalarType> rowL(maxRowL*bs), diag(bs), tmp(bs), prod(bs);
+
+  for (auto i = 0ul; i < n; ++i) {
+
+    /*--- Map and clear the storage of the row, then scatter the row of the matrix. ---*/
+
+    for (auto p = Lptr[i]; p < Lptr[i+1]; ++p) colPtr[Lcol[p]] = &rowL[(p-Lptr[i])*bs];
+    colPtr[i] = diag.data();
+    for (auto q = Uptr[i]; q < Uptr[i+1]; ++q) colPtr[Ucol[q]] = &Uval[q*bs];
+
+    std::fill(rowL.begin(), rowL.begin()+(Lptr[i+1]-Lptr[i])*bs, ScalarType(0.0));
+    std::fill(diag.begin(), diag.end(), ScalarType(0.0));
+    std::fill(Uval.begin()+Uptr[i]*bs, Uval.begin()+Uptr[i+1]*bs, ScalarType(0.0));
+
+    const auto oi = perm[i];
+    for (auto idx = mat.row_ptr[oi]; idx < mat.row_ptr[oi+1]; ++idx) {
+      const auto oj = mat.col_ind[idx];
+      if (oj >= n) continue;
+      const auto j = iperm[oj];
+      /*--- For LDL^T the lower part of the row is obtained from the upper factor. ---*/
+      if (symmetric && j < i) continue;
+      auto* dst = colPtr[j];
+      const auto* src = &mat.matrix[idx*bs];
+      for (auto k = 0ul; k < bs; ++k) dst[k] += src[k];
+    }
+
+    /*--- Eliminate the lower part, in increasing column order, L_ik = W_ik * D_k^-1, W_ij -= L_ik * U_kj. ---*/
+
+    for (auto p = Lptr[i]; p < Lptr[i+1]; ++p) {
+      const auto k = Lcol[p];
+      auto* lik = colPtr[k];
+
+      if (symmetric) {
+        /*--- L_ik = U_ki^T * D_k^-1 since A (and so D_k) is symmetric. ---*/
+        const auto* uki = &Uval[LtoU[p]*bs];
+        for (auto r = 0ul; r < nVar; ++r)
+          for (auto c = 0ul; c < nVar; ++c)
+            tmp[r*nVar+c] = uki[c*nVar+r];
+      } else {
+        mat.MatrixCopy(lik, tmp.data());
+      }
+      mat.MatrixMatrixProduct(tmp.data(), &invD[k*bs], lik);
+
+      for (auto q = Uptr[k]; q < Uptr[k+1]; ++q) {
+        const auto j = Ucol[q];
+        if (symmetric && j < i) continue;
+        mat.MatrixMatrixProduct(lik, &Uval[q*bs], prod.data());
+        mat.MatrixSubtraction(colPtr[j], prod.data(), colPtr[j]);
+      }
+    }
+
+    /*--- Pivot. ---*/
+
+    mat.MatrixInverse(diag.data(), &invD[i*bs]);
+
+    if (!symmetric) std::copy(rowL.begin(), rowL.begin()+(Lptr[i+1]-Lptr[i])*bs, Lval.begin()+Lptr[i]*bs);
+  }
+}
+
+template<class ScalarType>
+void CSparseDirectSolver<ScalarType>::Build(const CSysMatrix<ScalarType>& mat, const CConfig* config, bool ldlt) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    if (mat.nVar != mat.nEqn) {
+      SU2_MPI::Error("The sparse direct solver requires square blocks.", CURRENT_FUNCTION);
+    }
+
+    /*--- Ordering and symbolic factorization only when the pattern (or type of factorization) changes. ---*/
+
+    if (patternRef != mat.row_ptr || nPoint != mat.nPointDomain || nVar != mat.nVar || symmetric != ldlt ||
+        perm.empty()) {
+      nPoint = mat.nPointDomain;
+      nVar = mat.nVar;
+      symmetric = ldlt;
+      patternRef = mat.row_ptr;
+
+      Order(mat);
+      SymbolicFactorization(mat);
+
+      if (symmetric) Lval.clear();
+      work.resize(nPoint*nVar);
+      factorized = false;
+      nBuilds = 0;
+    }
+
+    const auto freq = config->GetSparseDirect_FactFreq();
+    const bool refactorize = (freq != 0) && (nBuilds % freq == 0);
+    ++nBuilds;
+
+    if (!factorized || refactorize) {
+      NumericFactorization(mat);
+      factorized = true;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template<class ScalarType>
+void CSparseDirectSolver<ScalarType>::Solve(const CSysMatrix<ScalarType>& mat, const CSysVector<ScalarType>& vec,
+                                            CSysVector<ScalarType>& prod) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    const auto n = nPoint;
+    const auto bs = nVar*nVar;
+    ScalarType t[CSysMatrix<ScalarType>::MAXNVAR], y[CSysMatrix<ScalarType>::MAXNVAR];
+
+    for (auto i = 0ul; i < n; ++i)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        work[i*nVar+iVar] = vec(perm[i], iVar);
+
+    /*--- Forward substitution, L y = b. ---*/
+
+    if (!symmetric) {
+      for (auto i = 0ul; i < n; ++i)
+        for (auto p = Lptr[i]; p < Lptr[i+1]; ++p)
+          mat.MatrixVectorProductSub(&Lval[p*bs], &work[Lcol[p]*nVar], &work[i*nVar]);
+    } else {
+      /*--- By columns, L_jk y_k = U_kj^T (D_k^-1 y_k). ---*/
+      for (auto k = 0ul; k < n; ++k) {
+        mat.MatrixVectorProduct(&invD[k*bs], &work[k*nVar], t);
+        for (auto q = Uptr[k]; q < Uptr[k+1]; ++q) {
+          const auto* ukj = &Uval[q*bs];
+          auto* yj = &work[Ucol[q]*nVar];
+          for (auto r = 0ul; r < nVar; ++r)
+            for (auto c = 0ul; c < nVar; ++c)
+              yj[c] -= ukj[r*nVar+c] * t[r];
+        }
+      }
+    }
+
+    /*--- Backward substitution, (D + U) x = y. ---*/
+
+    for (auto i = n; i > 0;) {
+      --i;
+      for (auto q = Uptr[i]; q < Uptr[i+1]; ++q)
+        mat.MatrixVectorProductSub(&Uval[q*bs], &work[Ucol[q]*nVar], &work[i*nVar]);
+      mat.MatrixVectorProduct(&invD[i*bs], &work[i*nVar], y);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) work[i*nVar+iVar] = y[iVar];
+    }
+
+    for (auto i = 0ul; i < n; ++i)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        prod(perm[i], iVar) = work[i*nVar+iVar];
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CSparseDirectSolver<su2double>;
+#else
+template class CSparseDirectSolver<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CSparseDirectSolver<passivedouble>;
+#endif
+#endif
@@ -38,8 +38,10 @@ CSysMatrix<ScalarType>::CSysMatrix() :
   size(SU2_MPI::GetSize()) {
 
   nPoint = nPointDomain = nVar = nEqn = 0;
+  fixedBlockSize = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
+  ilu_row_work_size = 0;
 
   omp_partitions    = nullptr;
 
@@ -121,15 +123,34 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     prec = config->GetKind_Grad_Linear_Solver_Prec();
   }
 
-  const bool ilu_needed = (prec==ILU);
+  /*--- LINELET_ILU uses ILU on the points that are not on linelets. ---*/
+  linelet_ilu = (prec==LINELET_ILU);
+  const bool ilu_needed = (prec==ILU) || linelet_ilu;
   const bool diag_needed = ilu_needed || (prec==JACOBI) || (prec==LINELET);
 
+  /*--- Off-diagonal blocks of the preconditioners in 16 bit format. ---*/
+  const auto compression = config->GetLinear_Solver_Prec_Compression();
+  const bool compress_ilu = (prec==ILU) && (compression != BLOCK_COMPRESSION::NONE);
+
+  if (compression != BLOCK_COMPRESSION::NONE && !std::is_arithmetic<ScalarType>::value) {
+    SU2_MPI::Error("LINEAR_SOLVER_PREC_COMPRESSION is not compatible with AD.", CURRENT_FUNCTION);
+  }
+
   /*--- Basic dimensions. ---*/
   nVar = nvar;
   nEqn = neqn;
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Square blocks up to MAXFIXEDNVAR use the row loops specialized for their size (see FixedBlockSize),
+   *    with MKL the loops use the JIT kernels of the runtime size instead. ---*/
+#ifndef USE_MKL
+  fixedBlockSize = (nVar == nEqn && nVar <= MAXFIXEDNVAR)? nVar : 0;
+#else
+  fixedBlockSize = 0;
+#endif
+  static_assert(MAXFIXEDNVAR == 7, "Update CALL_WITH_BLOCK_SIZE.");
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -160,6 +181,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    if (config->GetLinear_Solver_ILU_Levels() && !linelet_ilu) SetILULevelSchedule();
   }
 
   /*--- Allocate data. ---*/
@@ -171,7 +194,13 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   /*--- Preconditioners. ---*/
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu*nVar*nEqn);
+  if (ilu_needed) {
+    /*--- The compressed factors replace the ILU matrix. ---*/
+    if (compress_ilu) ILU_compressed.Initialize(compression, nnz_ilu, nVar, nEqn);
+    else allocAndInit(ILU_matrix, nnz_ilu*nVar*nEqn);
+  }
+
+  if (prec == LU_SGS) LU_SGS_compressed.Initialize(compression, nnz, nVar, nEqn);
 
   if (diag_needed) allocAndInit(invM, nPointDomain*nVar*nEqn);
 
@@ -187,6 +216,15 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   omp_num_parts = config->GetLinear_Solver_Prec_Threads();
   if (omp_num_parts == 0) omp_num_parts = num_threads;
 
+  /*--- Work rows used to factorize the compressed ILU, one per thread. ---*/
+  if (compress_ilu) {
+    unsigned long maxRowSize = 0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      maxRowSize = max(maxRowSize, row_ptr_ilu[iPoint+1] - row_ptr_ilu[iPoint]);
+    ilu_row_work_size = maxRowSize*nVar*nEqn;
+    ILU_row_work.resize(num_threads*ilu_row_work_size);
+  }
+
   /*--- This is akin to the row_ptr. ---*/
   omp_partitions = new unsigned long [omp_num_parts+1];
   for (unsigned long i = 0; i <= omp_num_parts; ++i) omp_partitions[i] = nPointDomain;
@@ -212,6 +250,24 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     }
   }
 
+  /*--- Split the rows into those that are sent to other ranks, and the others (inner rows).
+   *    This allows the products to be communicated while the inner rows are computed. ---*/
+
+  if (geometry->nP2PSend > 0) {
+    vector<bool> isSendRow(nPointDomain, false);
+    for (int iSend = 0; iSend < geometry->nPoint_P2PSend[geometry->nP2PSend]; ++iSend)
+      isSendRow[geometry->Local_Point_P2PSend[iSend]] = true;
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (isSendRow[iPoint]) send_rows.push_back(iPoint);
+      else inner_rows.push_back(iPoint);
+    }
+  }
+
+  /*--- Layout of the optional SELL-C-sigma copy, its values are set by UpdateSELLValues. ---*/
+
+  if (config->GetLinear_Solver_SELL_Format()) sell_matrix.Initialize(*this);
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -491,6 +547,9 @@ void CSysMatrix<ScalarType>::SetValZero() {
   const auto begin = chunk * omp_get_thread_num();
   const auto mySize = min(chunk, size-begin) * sizeof(ScalarType);
   memset(&matrix[begin], 0, mySize);
+  SU2_OMP_MASTER
+  sell_matrix.Invalidate();
+  END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 }
 
@@ -503,15 +562,11 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
   END_SU2_OMP_FOR
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+namespace {
+/*--- The dense block solvers, "nVar" is a compile-time constant in the row loops specialized for it. ---*/
 
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
-#else
+template<class ScalarType, class Size>
+FORCEINLINE void gauss_elimination_impl(Size nVar, ScalarType* matrix, ScalarType* vec) {
 #define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Transform system in Upper Matrix ---*/
@@ -525,42 +580,25 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   }
 
   /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
+  for (unsigned long iVar = nVar; iVar > 0ul;) {
     iVar--; // unsigned type
     for (auto jVar = iVar+1; jVar < nVar; jVar++)
       vec[iVar] -= A(iVar,jVar) * vec[jVar];
     vec[iVar] /= A(iVar,iVar);
   }
 #undef A
-#endif
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
-
-  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here. ---*/
-
-  assert((matrix != inverse) && "Output cannot be the same as the input.");
-
+template<class ScalarType, class Size>
+FORCEINLINE void matrix_inverse_impl(Size nVar, ScalarType* matrix, ScalarType* inverse) {
 #define M(I,J) inverse[(I)*nVar+(J)]
+#define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Initialize the inverse with the identity. ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     for (auto jVar = 0ul; jVar < nVar; jVar++)
       M(iVar,jVar) = ScalarType(iVar==jVar);
 
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
-  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
-  lapack_int ipiv[MAXNVAR];
-  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
-  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
-#else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
   /*--- Transform system in Upper Matrix ---*/
   for (auto iVar = 1ul; iVar < nVar; iVar++) {
     for (auto jVar = 0ul; jVar < iVar; jVar++)
@@ -577,7 +615,7 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
   }
 
   /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
+  for (unsigned long iVar = nVar; iVar > 0ul;) {
     iVar--; // unsigned type
     for (auto jVar = iVar+1; jVar < nVar; jVar++)
       for (auto kVar = 0ul; kVar < nVar; kVar++)
@@ -587,9 +625,52 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
       M(iVar,kVar) /= A(iVar,iVar);
   }
 #undef A
-#endif
 #undef M
 }
+} // namespace
+
+template<class ScalarType>
+template<unsigned long N>
+void CSysMatrix<ScalarType>::Gauss_Elimination(FixedBlockSize<N> n, ScalarType* matrix, ScalarType* vec) const {
+  gauss_elimination_impl(n, matrix, vec);
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
+#else
+  gauss_elimination_impl(nVar, matrix, vec);
+#endif
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
+
+  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here. ---*/
+
+  assert((matrix != inverse) && "Output cannot be the same as the input.");
+
+#ifdef USE_MKL_LAPACK
+  // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    for (auto jVar = 0ul; jVar < nVar; jVar++)
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar);
+
+  lapack_int ipiv[MAXNVAR];
+  LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
+  LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
+#else
+  matrix_inverse_impl(nVar, matrix, inverse);
+#endif
+}
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
@@ -605,6 +686,65 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
   }
 }
 
+template<class ScalarType>
+template<class RowOperation>
+void CSysMatrix<ScalarType>::RowLoopWithComms(const RowOperation& rowOp, CSysVector<ScalarType> & prod,
+                                              CGeometry *geometry, const CConfig *config) const {
+
+  if (send_rows.empty() || geometry->nP2PSend == 0) {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      rowOp(iPoint);
+    END_SU2_OMP_FOR
+
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    CSysMatrixComms::Complete(prod, geometry, config);
+    return;
+  }
+
+  /*--- Rows needed by other ranks first, the implicit barrier makes them visible to the packing of
+   *    the send buffers. Initiate only posts the non-blocking messages, so the inner rows can then be
+   *    computed while they are in flight. Complete only writes to halos, which no row reads here. ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iSend = 0ul; iSend < send_rows.size(); iSend++)
+    rowOp(send_rows[iSend]);
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iInner = 0ul; iInner < inner_rows.size(); iInner++)
+    rowOp(inner_rows[iInner]);
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+/*--- Call a row loop (member function template with the block size as first argument) instantiated for the
+ *    block size of the matrix, the compile-time sizes are 1 to MAXFIXEDNVAR (see Initialize). ---*/
+#define CALL_WITH_BLOCK_SIZE(LOOP, ...)                     \
+  switch (fixedBlockSize) {                                 \
+    case 1: LOOP(FixedBlockSize<1>(), __VA_ARGS__); break;  \
+    case 2: LOOP(FixedBlockSize<2>(), __VA_ARGS__); break;  \
+    case 3: LOOP(FixedBlockSize<3>(), __VA_ARGS__); break;  \
+    case 4: LOOP(FixedBlockSize<4>(), __VA_ARGS__); break;  \
+    case 5: LOOP(FixedBlockSize<5>(), __VA_ARGS__); break;  \
+    case 6: LOOP(FixedBlockSize<6>(), __VA_ARGS__); break;  \
+    case 7: LOOP(FixedBlockSize<7>(), __VA_ARGS__); break;  \
+    default: LOOP(nVar, __VA_ARGS__); break;                \
+  }
+
+template<class ScalarType>
+template<class Size>
+void CSysMatrix<ScalarType>::RowProducts(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                         CGeometry *geometry, const CConfig *config) const {
+
+  RowLoopWithComms([&](unsigned long row_i) { RowProduct(n, vec, row_i, &prod[row_i*nVar]); },
+                   prod, geometry, config);
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                  CGeometry *geometry, const CConfig *config) const {
@@ -625,16 +765,18 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i*nVar]);
-  }
-  END_SU2_OMP_FOR
+  /*--- MPI Parallelization is overlapped with the computation of inner rows. ---*/
 
-  /*--- MPI Parallelization. ---*/
+  if (sell_matrix.IsValid()) {
+    /*--- Same as RowLoopWithComms, the first group of slices contains the rows sent to other ranks. ---*/
+    sell_matrix.Product(vec, prod, 0);
+    CSysMatrixComms::Initiate(prod, geometry, config);
+    sell_matrix.Product(vec, prod, 1);
+    CSysMatrixComms::Complete(prod, geometry, config);
+    return;
+  }
 
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+  CALL_WITH_BLOCK_SIZE(RowProducts, vec, prod, geometry, config)
 
 }
 
@@ -655,20 +797,43 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
-  END_SU2_OMP_FOR
 
-  /*--- MPI Parallelization ---*/
-  CSysMatrixComms::Initiate(prod, geometry, config);
-  CSysMatrixComms::Complete(prod, geometry, config);
+  /*--- MPI Parallelization is overlapped with the computation of inner rows. ---*/
+  RowLoopWithComms([&](unsigned long iPoint) {
+    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  }, prod, geometry, config);
 
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
+  /*--- With compressed factors the rows are factorized one by one in work memory, only the
+   *    order in which they are processed depends on the parallel strategy. ---*/
+
+  if (ILU_compressed.IsActive()) {
+    if (!ilu_lower_level_ptr.empty()) {
+      for (auto iLevel = 0ul; iLevel+1 < ilu_lower_level_ptr.size(); ++iLevel) {
+        SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+        for (auto k = ilu_lower_level_ptr[iLevel]; k < ilu_lower_level_ptr[iLevel+1]; ++k) {
+          auto row = &ILU_row_work[omp_get_thread_num()*ilu_row_work_size];
+          FactorizeCompressedILURow(ilu_lower_levels[k], 0, nPointDomain, row);
+        }
+        END_SU2_OMP_FOR
+      }
+    }
+    else {
+      SU2_OMP_FOR_STAT(1)
+      for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+        auto row = &ILU_row_work[omp_get_thread_num()*ilu_row_work_size];
+        for (auto iPoint = omp_partitions[thread]; iPoint < omp_partitions[thread+1]; ++iPoint)
+          FactorizeCompressedILURow(iPoint, omp_partitions[thread], omp_partitions[thread+1], row);
+      }
+      END_SU2_OMP_FOR
+    }
+    return;
+  }
+
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
   if (ilu_fill_in == 0) {
@@ -699,6 +864,11 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (!ilu_lower_level_ptr.empty()) {
+    BuildILUWithLevels();
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -780,6 +950,25 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  if (!ilu_lower_level_ptr.empty()) {
+    CALL_WITH_BLOCK_SIZE(ComputeILUWithLevels, vec, prod)
+  }
+  else {
+    CALL_WITH_BLOCK_SIZE(ComputeILUPartitions, vec, prod)
+  }
+
+  /*--- MPI Parallelization, unlike in RowLoopWithComms the communication cannot be overlapped
+   *    with computation since any row depends on the entire backward substitution of its partition. ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+template<class ScalarType>
+template<class Size>
+void CSysMatrix<ScalarType>::ComputeILUPartitions(Size n, const CSysVector<ScalarType> & vec,
+                                                  CSysVector<ScalarType> & prod) const {
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
@@ -803,8 +992,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
       for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        ILUBlockProductSub(n, index, &prod[jPoint*nVar], &prod[iPoint*nVar]);
       }
     }
 
@@ -818,15 +1006,223 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
       for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
         auto jPoint = col_ind_ilu[index];
         if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+        ILUBlockProductSub(n, index, &prod[jPoint*nVar], aux_vec);
       }
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      MatrixVectorProduct(n, &invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
     }
   }
   END_SU2_OMP_FOR
 
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetILULevelSchedule() {
+
+  /*--- The level of a row is one more than the highest level of the rows it depends on, i.e. the
+   *    columns of its lower (upper) part for the forward (backward) substitution. The factorization
+   *    of a row only needs the factorized upper part of the rows in its lower part, hence it has
+   *    the same dependencies as the forward substitution. Columns outside the domain are ignored. ---*/
+
+  auto schedule = [&](bool lower, vector<unsigned long>& levelPtr, vector<unsigned long>& levelRows) {
+
+    vector<unsigned long> level(nPointDomain, 0);
+    unsigned long nLevels = 0;
+
+    for (auto k = 0ul; k < nPointDomain; ++k) {
+      const auto iPoint = lower? k : nPointDomain-1-k;
+      unsigned long iLevel = 0;
+
+      if (lower) {
+        for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+          iLevel = max(iLevel, level[col_ind_ilu[index]]+1);
+      }
+      else {
+        for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; ++index) {
+          const auto jPoint = col_ind_ilu[index];
+          if (jPoint >= nPointDomain) break;
+          iLevel = max(iLevel, level[jPoint]+1);
+        }
+      }
+      level[iPoint] = iLevel;
+      nLevels = max(nLevels, iLevel+1);
+    }
+
+    /*--- Group the rows by level (counting sort), keeping them in ascending order within each level. ---*/
+
+    levelPtr.assign(nLevels+1, 0);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) ++levelPtr[level[iPoint]+1];
+    for (auto iLevel = 0ul; iLevel < nLevels; ++iLevel) levelPtr[iLevel+1] += levelPtr[iLevel];
+
+    auto pos = levelPtr;
+    levelRows.resize(nPointDomain);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) levelRows[pos[level[iPoint]]++] = iPoint;
+  };
+
+  schedule(true, ilu_lower_level_ptr, ilu_lower_levels);
+  schedule(false, ilu_upper_level_ptr, ilu_upper_levels);
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildILUWithLevels() {
+
+  /*--- Same algorithm as BuildILUPreconditioner, on the entire domain, but the rows are processed
+   *    by level. The diagonal of a row is inverted as soon as the row is factorized. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < ilu_lower_level_ptr.size(); ++iLevel) {
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto k = ilu_lower_level_ptr[iLevel]; k < ilu_lower_level_ptr[iLevel+1]; ++k) {
+      const auto iPoint = ilu_lower_levels[k];
+
+      ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+        const auto jPoint = col_ind_ilu[index];
+
+        auto Block_ij = &ILU_matrix[index*nVar*nVar];
+        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+          const auto kPoint = col_ind_ilu[index_];
+          if (kPoint >= nPointDomain) break;
+
+          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+          if (Block_ik != nullptr) {
+            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+            MatrixMatrixProduct(weight, Block_jk, aux_block);
+            MatrixSubtraction(Block_ik, aux_block, Block_ik);
+          }
+        }
+
+        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+          Block_ij[iVar] = weight[iVar];
+      }
+
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template<class ScalarType>
+template<class Size>
+void CSysMatrix<ScalarType>::ComputeILUWithLevels(Size n, const CSysVector<ScalarType> & vec,
+                                                  CSysVector<ScalarType> & prod) const {
+
+  /*--- Forward substitution, the first level has no dependencies so it only copies. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < ilu_lower_level_ptr.size(); ++iLevel) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto k = ilu_lower_level_ptr[iLevel]; k < ilu_lower_level_ptr[iLevel+1]; ++k) {
+      const auto iPoint = ilu_lower_levels[k];
+
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+
+      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+        auto jPoint = col_ind_ilu[index];
+        ILUBlockProductSub(n, index, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Backward substitution. ---*/
+
+  for (auto iLevel = 0ul; iLevel+1 < ilu_upper_level_ptr.size(); ++iLevel) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto k = ilu_upper_level_ptr[iLevel]; k < ilu_upper_level_ptr[iLevel+1]; ++k) {
+      const auto iPoint = ilu_upper_levels[k];
+
+      ScalarType aux_vec[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+        auto jPoint = col_ind_ilu[index];
+        if (jPoint >= nPointDomain) break;
+        ILUBlockProductSub(n, index, &prod[jPoint*nVar], aux_vec);
+      }
+
+      MatrixVectorProduct(n, &invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeCompressedILURow(unsigned long iPoint, unsigned long begin,
+                                                       unsigned long end, ScalarType* row) {
+  const auto nBlk = nVar*nVar;
+  const auto first = row_ptr_ilu[iPoint];
+  const auto last = row_ptr_ilu[iPoint+1];
+
+  /*--- Gather the row of the matrix, both patterns are sorted by column. ---*/
+
+  for (auto k = 0ul; k < (last-first)*nBlk; ++k) row[k] = 0.0;
+
+  for (auto index = row_ptr[iPoint], pos = first; index < row_ptr[iPoint+1]; ++index) {
+    while (col_ind_ilu[pos] < col_ind[index]) ++pos;
+    MatrixCopy(&matrix[index*nBlk], &row[(pos-first)*nBlk]);
+  }
+
+  /*--- Same algorithm as BuildILUPreconditioner, the blocks of the row are found by merging
+   *    the (sorted) columns of the row with those of the upper part of the rows it depends on. ---*/
+
+  ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR], Block_jk[MAXNVAR*MAXNVAR];
+
+  for (auto index = first; index < dia_ptr_ilu[iPoint]; index++) {
+    const auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+
+    auto Block_ij = &row[(index-first)*nBlk];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint*nBlk], weight);
+
+    auto pos = index+1;
+    for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+      const auto kPoint = col_ind_ilu[index_];
+      if (kPoint >= end) break;
+
+      while (pos < last && col_ind_ilu[pos] < kPoint) ++pos;
+      if (pos == last) break;
+      if (col_ind_ilu[pos] != kPoint) continue;
+
+      auto Block_ik = &row[(pos-first)*nBlk];
+      ILU_compressed.Decompress(index_, Block_jk);
+      MatrixMatrixProduct(weight, Block_jk, aux_block);
+      MatrixSubtraction(Block_ik, aux_block, Block_ik);
+    }
+
+    for (auto iVar = 0ul; iVar < nBlk; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- Invert the diagonal block (which is kept in full precision) and compress the others. ---*/
+
+  for (auto index = first; index < last; ++index) {
+    auto Block = &row[(index-first)*nBlk];
+    if (index == dia_ptr_ilu[iPoint]) MatrixInverse(Block, &invM[iPoint*nBlk]);
+    else ILU_compressed.Compress(index, Block);
+  }
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig *config) {
+
+  amg_hierarchy.Build(*this, config);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, const CConfig *config) const {
+
+  amg_hierarchy.Apply(*this, vec, prod);
+
   /*--- MPI Parallelization ---*/
 
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -834,15 +1230,40 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildLU_SGSPreconditioner() {
+
+  if (!LU_SGS_compressed.IsActive()) return;
+
+  /*--- The sweeps use the off-diagonal blocks of the domain rows (including halo columns). ---*/
+
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+      if (index != dia_ptr[iPoint]) LU_SGS_compressed.Compress(index, &matrix[index*nVar*nEqn]);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, const CConfig *config) const {
 
-  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
-
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  CALL_WITH_BLOCK_SIZE(LU_SGSSweeps, vec, prod, geometry, config)
+
+}
+
+template<class ScalarType>
+template<class Size>
+void CSysMatrix<ScalarType>::LU_SGSSweeps(Size n, const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                          CGeometry *geometry, const CConfig *config) const {
+
+  /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
@@ -860,9 +1281,9 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
     for (auto iPoint = begin; iPoint < end; ++iPoint) {
       auto idx = iPoint*nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
+      LowerProduct(n, prod, iPoint, begin, low_prod);     // Compute L.x*
       VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
+      Gauss_Elimination(n, iPoint, &prod[idx]);           // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
@@ -887,10 +1308,10 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
     for (auto iPoint = row_end; iPoint > begin;) {
       iPoint--; // because of unsigned type
       auto idx = iPoint*nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
-      UpperProduct(prod, iPoint, row_end, up_prod);     // Compute U.x_(n+1)
+      DiagonalProduct(n, prod, iPoint, dia_prod);       // Compute D.x*
+      UpperProduct(n, prod, iPoint, row_end, up_prod);  // Compute U.x_(n+1)
       VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
+      Gauss_Elimination(n, iPoint, &prod[idx]);         // Solve D.x* = y
     }
   }
   END_SU2_OMP_FOR
@@ -903,31 +1324,244 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry *geometry, const CConfig *config) {
+void CSysMatrix<ScalarType>::ComputeAsyncRelaxation(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                    unsigned long nSweeps, ScalarType omega,
+                                                    CGeometry *geometry, const CConfig *config) const {
 
-  BuildJacobiPreconditioner();
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  /*--- Each thread sweeps its rows nSweeps times without waiting for the others. The couplings to
+   *    rows of other threads use whatever values are in x at that moment (older or newer), this
+   *    is the chaotic relaxation of Chazan and Miranker, it converges for (block) diagonally dominant
+   *    matrices regardless of the order of the updates. There is only one barrier at the end.
+   *    The entries of x are shared by threads that read and write them concurrently, therefore all
+   *    accesses, except the reads by the thread that owns the row, are (relaxed) atomic. ---*/
 
-  /*--- Allocate working vectors if not done yet. ---*/
-  if (!LineletUpper.empty()) return;
+  SU2_OMP_FOR_STAT(1)
+  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread+1];
+    if (begin == end) continue;
 
-  const auto nThreads = omp_get_max_threads();
+    ScalarType res[MAXNVAR], xj[MAXNVAR];
 
+    /*--- x_i += omega * D_i^-1 (b_i - A_i x). ---*/
+    auto relax = [&](unsigned long iPoint) {
+      const auto idx = iPoint*nVar;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iVar] = 0.0;
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; ++index) {
+        const auto jdx = col_ind[index]*nEqn;
+        for (auto jVar = 0ul; jVar < nEqn; ++jVar) xj[jVar] = atomicRead(x[jdx+jVar]);
+        MatrixVectorProductAdd(&matrix[index*nVar*nEqn], xj, res);
+      }
+      VectorSubtraction(&b[idx], res, res);
+      Gauss_Elimination(nVar, iPoint, res);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) atomicWrite(x[idx+iVar] + omega * res[iVar], x[idx+iVar]);
+    };
+
+    for (auto iSweep = 0ul; iSweep < nSweeps; ++iSweep) {
+      for (auto iPoint = begin; iPoint < end; ++iPoint) relax(iPoint);
+      for (auto iPoint = end; iPoint > begin;) relax(--iPoint);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(x, geometry, config);
+  CSysMatrixComms::Complete(x, geometry, config);
+
+}
+
+namespace {
+/*!
+ * \brief Exchange one block per link between linelets that continue on other ranks.
+ * \param[in] li - Linelet information.
+ * \param[in] stage - The links of this stage (of the first linelet) are used.
+ * \param[in] forward - From the first to the second linelet (nextBuf -> prevBuf) or the opposite.
+ * \param[in] blkSize - Number of entries per link.
+ * \param[in,out] nextBuf - Data of the links to the next linelets.
+ * \param[in,out] prevBuf - Data of the links to the previous linelets.
+ */
+template<class ScalarType>
+void LineletComms(const CGeometry::CLineletInfo& li, unsigned short stage, bool forward,
+                  unsigned long blkSize, ScalarType* nextBuf, ScalarType* prevBuf) {
+#ifdef HAVE_MPI
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    const auto& li = geometry->GetLineletInfo(config);
-    if (!li.linelets.empty()) {
-      LineletUpper.resize(nThreads);
-      LineletVector.resize(nThreads);
-      LineletInvDiag.resize(nThreads);
+    const int size = SU2_MPI::GetSize();
+
+    /*--- The links of a stage are contiguous and sorted by rank. ---*/
+    auto countLinks = [&](const vector<CGeometry::CLineletInfo::CLink>& links, vector<int>& count,
+                          vector<int>& disp) {
+      count.assign(size, 0);
+      disp.assign(size, 0);
+      unsigned long begin = links.size();
+      for (auto i = 0ul; i < links.size(); ++i) {
+        if (links[i].stage != stage) continue;
+        begin = min(begin, i);
+        count[links[i].rank] += blkSize;
+      }
+      for (int iRank = 1; iRank < size; ++iRank) disp[iRank] = disp[iRank-1] + count[iRank-1];
+      return (begin == links.size()) ? 0ul : begin * blkSize;
+    };
+    vector<int> nextCount, nextDisp, prevCount, prevDisp;
+    const auto nextBegin = countLinks(li.nextLinks, nextCount, nextDisp);
+    const auto prevBegin = countLinks(li.prevLinks, prevCount, prevDisp);
+
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    if (forward) {
+      SelectMPIWrapper<ScalarType>::W::Alltoallv(nextBuf + nextBegin, nextCount.data(), nextDisp.data(), mpi_type,
+                                                 prevBuf + prevBegin, prevCount.data(), prevDisp.data(), mpi_type,
+                                                 SU2_MPI::GetComm());
+    } else {
+      SelectMPIWrapper<ScalarType>::W::Alltoallv(prevBuf + prevBegin, prevCount.data(), prevDisp.data(), mpi_type,
+                                                 nextBuf + nextBegin, nextCount.data(), nextDisp.data(), mpi_type,
+                                                 SU2_MPI::GetComm());
     }
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#endif
+}
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry *geometry, const CConfig *config) {
+
+  BuildJacobiPreconditioner();
+
+  /*--- The linelets are computed on the first call, by one thread. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto& li = geometry->GetLineletInfo(config);
+    LineletNextBuf.resize(li.nextLinks.size()*nVar*nVar);
+    LineletPrevBuf.resize(li.prevLinks.size()*nVar*nVar);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  const auto& li = geometry->GetLineletInfo(config);
+
+  /*--- Factorize the tridiagonal systems, invM stores the inverse of the modified diagonal blocks. Linelets
+   *    that continue the linelets of other ranks need data from them, hence the factorization by stages. ---*/
+
+  for (auto iStage = 0u; iStage < li.nStages; ++iStage) {
+
+    /*--- Receive M = inv(d'_n) * u_n, from the last point "n" of the previous linelets. ---*/
+    if (iStage > 0) LineletComms(li, iStage-1, true, nVar*nVar, LineletNextBuf.data(), LineletPrevBuf.data());
+
+    SU2_OMP_FOR_DYN(1)
+    for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
+      if (li.lineletStage[iLinelet] != iStage) continue;
+
+      const auto& linelet = li.linelets[iLinelet];
+      const auto nElem = linelet.size();
+
+      /*--- Small temporaries. ---*/
+      ScalarType aux_block[MAXNVAR*MAXNVAR], weight[MAXNVAR*MAXNVAR];
+
+      /*--- Modified diagonal of the first point. ---*/
+      MatrixCopy(&matrix[dia_ptr[linelet[0]]*nVar*nVar], aux_block);
+
+      const auto iPrev = li.prevLinkIdx.empty()? CGeometry::CLineletInfo::NO_LINK : li.prevLinkIdx[iLinelet];
+      if (iPrev != CGeometry::CLineletInfo::NO_LINK) {
+        const auto* l = GetBlock(linelet[0], li.prevLinks[iPrev].point);
+        MatrixMatrixProduct(l, &LineletPrevBuf[iPrev*nVar*nVar], weight);
+        MatrixSubtraction(aux_block, weight, aux_block);
+      }
+      MatrixInverse(aux_block, &invM[linelet[0]*nVar*nVar]);
+
+      for (auto iElem = 1ul; iElem < nElem; iElem++) {
+
+        /*--- Setup pointers to required matrices ---*/
+        const auto im1Point = linelet[iElem-1];
+        const auto iPoint = linelet[iElem];
+
+        const auto* d = &matrix[dia_ptr[iPoint]*nVar*nVar];
+        const auto* l = GetBlock(iPoint, im1Point);
+        const auto* u = GetBlock(im1Point, iPoint);
+
+        /*--- Left-multiply by lower block to obtain the weight ---*/
+        MatrixMatrixProduct(l, &invM[im1Point*nVar*nVar], weight);
+
+        /*--- Multiply weight by upper block to modify current diagonal, and invert it. ---*/
+        MatrixMatrixProduct(weight, u, aux_block);
+        MatrixSubtraction(d, aux_block, aux_block);
+        MatrixInverse(aux_block, &invM[iPoint*nVar*nVar]);
+      }
+
+      /*--- Data for the next linelet. ---*/
+      const auto iNext = li.nextLinkIdx.empty()? CGeometry::CLineletInfo::NO_LINK : li.nextLinkIdx[iLinelet];
+      if (iNext != CGeometry::CLineletInfo::NO_LINK) {
+        const auto* u = GetBlock(linelet.back(), li.nextLinks[iNext].point);
+        MatrixMatrixProduct(&invM[linelet.back()*nVar*nVar], u, &LineletNextBuf[iNext*nVar*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  if (!linelet_ilu) return;
+
+  /*--- ILU on the points that are not on linelets, i.e. the ILU of the matrix reordered such that the linelet
+   *    points come first, without the rows and columns of the linelet points (which are handled by the
+   *    tridiagonal solves). The partitions for threads are the same as for ILU. ---*/
+
+  auto onLinelet = [&](unsigned long iPoint) {
+    return iPoint < nPointDomain && li.lineletIdx[iPoint] != CGeometry::CLineletInfo::NO_LINELET;
+  };
+
+  if (ilu_fill_in == 0) {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nnz*nVar*nVar; ++iVar)
+      ILU_matrix[iVar] = matrix[iVar];
+    END_SU2_OMP_FOR
+  }
+  else {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nnz_ilu*nVar*nVar; iVar++)
+      ILU_matrix[iVar] = 0.0;
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        auto jPoint = col_ind[index];
+        SetBlock_ILUMatrix(iPoint, jPoint, &matrix[index*nVar*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
 
   SU2_OMP_FOR_STAT(1)
-  for (int iThread = 0; iThread < nThreads; ++iThread) {
-    const auto size = CGeometry::CLineletInfo::MAX_LINELET_POINTS;
-    LineletUpper[iThread].resize(size, nullptr);
-    LineletVector[iThread].resize(size * nVar, 0.0);
-    LineletInvDiag[iThread].resize(size * nVar * nVar, 0.0);
+  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+    const auto begin = omp_partitions[thread];
+    const auto end = omp_partitions[thread+1];
+
+    ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+    for (auto iPoint = begin; iPoint < end; iPoint++) {
+      if (onLinelet(iPoint)) continue;
+
+      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+        const auto jPoint = col_ind_ilu[index];
+        if (jPoint < begin || onLinelet(jPoint)) continue;
+
+        /*--- Aik -= Aij*inv(Ajj)*Ajk, and store the weight in the lower part. ---*/
+        auto Block_ij = &ILU_matrix[index*nVar*nVar];
+        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+          const auto kPoint = col_ind_ilu[index_];
+          if (kPoint >= end) break;
+          if (onLinelet(kPoint)) continue;
+
+          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+          if (Block_ik != nullptr) {
+            MatrixMatrixProduct(weight, &ILU_matrix[index_*nVar*nVar], aux_block);
+            MatrixSubtraction(Block_ik, aux_block, Block_ik);
+          }
+        }
+        MatrixCopy(weight, Block_ij);
+      }
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint*nVar*nVar]);
+    }
   }
   END_SU2_OMP_FOR
 }
@@ -939,102 +1573,157 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   SU2_OMP_BARRIER
 
   const auto& li = geometry->GetLineletInfo(config);
+  constexpr auto NO_LINK = CGeometry::CLineletInfo::NO_LINK;
 
   /*--- Jacobi preconditioning where there are no linelets. ---*/
 
-  SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
-    if (li.lineletIdx[iPoint] == CGeometry::CLineletInfo::NO_LINELET)
-      MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
-  END_SU2_OMP_FOR
-
-  /*--- Solve the tridiagonal systems for the linelets. ---*/
+  if (!linelet_ilu) {
+    SU2_OMP_FOR_(schedule(dynamic,omp_heavy_size) SU2_NOWAIT)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      if (li.lineletIdx[iPoint] == CGeometry::CLineletInfo::NO_LINELET)
+        MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+    END_SU2_OMP_FOR
+  }
 
-  SU2_OMP_FOR_DYN(1)
-  for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
+  /*--- Solve the tridiagonal systems for the linelets, using the factorization of the build step.
+   *    Forward pass, prod becomes the modified rhs b'_i = b_i - l_i * inv(d'_{i-1}) * b'_{i-1}. ---*/
 
-    /*--- Get references to the working vectors allocated for this thread. ---*/
+  for (auto iStage = 0u; iStage < li.nStages; ++iStage) {
 
-    const int thread = omp_get_thread_num();
-    auto& lineletUpper = LineletUpper[thread];
-    auto& lineletInvDiag = LineletInvDiag[thread];
-    auto& lineletVector = LineletVector[thread];
+    /*--- Receive inv(d'_n) * b'_n from the last point of the previous linelets. ---*/
+    if (iStage > 0) LineletComms(li, iStage-1, true, nVar, LineletNextBuf.data(), LineletPrevBuf.data());
 
-    /*--- Initialize the solution vector with the rhs ---*/
+    SU2_OMP_FOR_DYN(1)
+    for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
+      if (li.lineletStage[iLinelet] != iStage) continue;
 
-    const auto nElem = li.linelets[iLinelet].size();
+      const auto& linelet = li.linelets[iLinelet];
+      ScalarType aux_vector[MAXNVAR];
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
       for (auto iVar = 0ul; iVar < nVar; iVar++)
-        lineletVector[iElem*nVar+iVar] = vec[iPoint*nVar+iVar];
-    }
+        prod[linelet[0]*nVar+iVar] = vec[linelet[0]*nVar+iVar];
 
-    /*--- Forward pass, eliminate lower entries, modify diagonal and rhs. ---*/
+      const auto iPrev = li.prevLinkIdx.empty()? NO_LINK : li.prevLinkIdx[iLinelet];
+      if (iPrev != NO_LINK) {
+        const auto* l = GetBlock(linelet[0], li.prevLinks[iPrev].point);
+        MatrixVectorProductSub(l, &LineletPrevBuf[iPrev*nVar], &prod[linelet[0]*nVar]);
+      }
 
-    /*--- Small temporaries. ---*/
-    ScalarType aux_block[MAXNVAR*MAXNVAR], aux_vector[MAXNVAR];
+      for (auto iElem = 1ul; iElem < linelet.size(); iElem++) {
+        const auto im1Point = linelet[iElem-1];
+        const auto iPoint = linelet[iElem];
+        MatrixVectorProduct(&invM[im1Point*nVar*nVar], &prod[im1Point*nVar], aux_vector);
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+        MatrixVectorProductSub(GetBlock(iPoint, im1Point), aux_vector, &prod[iPoint*nVar]);
+      }
 
-    /*--- Copy diagonal block for first point in this linelet. ---*/
-    MatrixCopy(&matrix[dia_ptr[li.linelets[iLinelet][0]]*nVar*nVar],
-               lineletInvDiag.data());
+      const auto iNext = li.nextLinkIdx.empty()? NO_LINK : li.nextLinkIdx[iLinelet];
+      if (iNext != NO_LINK) {
+        const auto iPoint = linelet.back();
+        MatrixVectorProduct(&invM[iPoint*nVar*nVar], &prod[iPoint*nVar], &LineletNextBuf[iNext*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
 
-    for (auto iElem = 1ul; iElem < nElem; iElem++) {
+  /*--- Backward substitution, x_i = inv(d'_i) * (b'_i - u_i * x_{i+1}), prod becomes the solution. ---*/
 
-      /*--- Setup pointers to required matrices and vectors ---*/
-      const auto im1Point = li.linelets[iLinelet][iElem-1];
-      const auto iPoint = li.linelets[iLinelet][iElem];
+  for (auto iStage = li.nStages; iStage > 0;) {
+    --iStage;
 
-      const auto* d = &matrix[dia_ptr[iPoint]*nVar*nVar];
-      const auto* l = GetBlock(iPoint, im1Point);
-      const auto* u = GetBlock(im1Point, iPoint);
+    /*--- Receive the solution at the first point of the next linelets. ---*/
+    if (iStage+1 < li.nStages) LineletComms(li, iStage, false, nVar, LineletNextBuf.data(), LineletPrevBuf.data());
 
-      auto* inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      auto* d_prime = &lineletInvDiag[iElem*nVar*nVar];
-      auto* b_prime = &lineletVector[iElem*nVar];
+    SU2_OMP_FOR_DYN(1)
+    for (auto iLinelet = 0ul; iLinelet < li.linelets.size(); iLinelet++) {
+      if (li.lineletStage[iLinelet] != iStage) continue;
 
-      /*--- Invert previous modified diagonal ---*/
-      MatrixCopy(inv_dm1, aux_block);
-      MatrixInverse(aux_block, inv_dm1);
+      const auto& linelet = li.linelets[iLinelet];
+      ScalarType aux_vector[MAXNVAR];
 
-      /*--- Left-multiply by lower block to obtain the weight ---*/
-      MatrixMatrixProduct(l, inv_dm1, aux_block);
+      auto backSubstitute = [&](unsigned long iPoint, unsigned long jPoint, const ScalarType* x_j) {
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          aux_vector[iVar] = prod[iPoint*nVar+iVar];
+        if (x_j) MatrixVectorProductSub(GetBlock(iPoint, jPoint), x_j, aux_vector);
+        MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vector, &prod[iPoint*nVar]);
+      };
 
-      /*--- Multiply weight by upper block to modify current diagonal ---*/
-      MatrixMatrixProduct(aux_block, u, d_prime);
-      MatrixSubtraction(d, d_prime, d_prime);
+      const auto iNext = li.nextLinkIdx.empty()? NO_LINK : li.nextLinkIdx[iLinelet];
+      if (iNext != NO_LINK) {
+        backSubstitute(linelet.back(), li.nextLinks[iNext].point, &LineletNextBuf[iNext*nVar]);
+      } else {
+        backSubstitute(linelet.back(), 0, nullptr);
+      }
 
-      /*--- Update the rhs ---*/
-      MatrixVectorProduct(aux_block, &lineletVector[(iElem-1)*nVar], aux_vector);
-      VectorSubtraction(b_prime, aux_vector, b_prime);
+      for (auto iElem = linelet.size()-1; iElem > 0; --iElem) {
+        backSubstitute(linelet[iElem-1], linelet[iElem], &prod[linelet[iElem]*nVar]);
+      }
 
-      /*--- Cache upper block pointer for the backward substitution phase ---*/
-      lineletUpper[iElem-1] = u;
+      /*--- Solution at the first point for the previous linelet. ---*/
+      const auto iPrev = li.prevLinkIdx.empty()? NO_LINK : li.prevLinkIdx[iLinelet];
+      if (iPrev != NO_LINK) {
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          LineletPrevBuf[iPrev*nVar+iVar] = prod[linelet[0]*nVar+iVar];
+      }
     }
+    END_SU2_OMP_FOR
+  }
 
-    /*--- Backwards substitution, LineletVector becomes the solution ---*/
+  /*--- ILU on the other points, the rhs is corrected with the solution on the linelets. ---*/
 
-    /*--- x_n = d_n^{-1} * b_n ---*/
-    Gauss_Elimination(&lineletInvDiag[(nElem-1)*nVar*nVar], &lineletVector[(nElem-1)*nVar]);
+  if (linelet_ilu) {
+    auto onLinelet = [&](unsigned long iPoint) {
+      return iPoint < nPointDomain && li.lineletIdx[iPoint] != CGeometry::CLineletInfo::NO_LINELET;
+    };
 
-    /*--- x_i = d_i^{-1}*(b_i - u_i*x_{i+1}) ---*/
-    for (auto iElem = nElem-1; iElem > 0; --iElem) {
-      const auto* inv_dm1 = &lineletInvDiag[(iElem-1)*nVar*nVar];
-      MatrixVectorProduct(lineletUpper[iElem-1], &lineletVector[iElem*nVar], aux_vector);
-      VectorSubtraction(&lineletVector[(iElem-1)*nVar], aux_vector, aux_vector);
-      MatrixVectorProduct(inv_dm1, aux_vector, &lineletVector[(iElem-1)*nVar]);
-    }
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-    /*--- Copy results to product vector ---*/
+      ScalarType aux_vec[MAXNVAR];
 
-    for (auto iElem = 0ul; iElem < nElem; iElem++) {
-      const auto iPoint = li.linelets[iLinelet][iElem];
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        prod[iPoint*nVar+iVar] = lineletVector[iElem*nVar+iVar];
-    }
+      /*--- Forward solve. ---*/
+      for (auto iPoint = begin; iPoint < end; iPoint++) {
+        if (onLinelet(iPoint)) continue;
+
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+
+        for (auto index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+          const auto jPoint = col_ind[index];
+          if (onLinelet(jPoint))
+            MatrixVectorProductSub(&matrix[index*nVar*nVar], &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        }
+
+        for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+          const auto jPoint = col_ind_ilu[index];
+          if (jPoint < begin || onLinelet(jPoint)) continue;
+          ILUBlockProductSub(nVar, index, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        }
+      }
+
+      /*--- Backward substitution. ---*/
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;
+        if (onLinelet(iPoint)) continue;
 
+        for (auto iVar = 0ul; iVar < nVar; iVar++)
+          aux_vec[iVar] = prod[iPoint*nVar+iVar];
+
+        for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
+          const auto jPoint = col_ind_ilu[index];
+          if (jPoint >= end) break;
+          if (onLinelet(jPoint)) continue;
+          ILUBlockProductSub(nVar, index, &prod[jPoint*nVar], aux_vec);
+        }
+
+        MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
@@ -1050,7 +1739,7 @@ void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol,
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     ScalarType aux_vec[MAXNVAR];
-    RowProduct(sol, iPoint, aux_vec);
+    RowProduct(nVar, sol, iPoint, aux_vec);
     VectorSubtraction(aux_vec, &f[iPoint*nVar], &res[iPoint*nVar]);
   }
   END_SU2_OMP_FOR
@@ -1235,6 +1924,13 @@ void CSysMatrix<ScalarType>::TransposeInPlace() {
   pastix_wrapper.SetTransposedSolve();
   END_SU2_OMP_MASTER
 #endif
+
+  /*--- The built-in factorization is not transposed, it is recomputed on the next build. ---*/
+  SU2_OMP_MASTER
+  sparse_direct.Invalidate();
+  END_SU2_OMP_MASTER
+
+  InvalidateSELLValues();
 }
 
 template<class ScalarType>
@@ -1254,6 +1950,7 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
     matrix[i] += alpha*B.matrix[i];
   END_SU2_OMP_FOR
 
+  InvalidateSELLValues();
 }
 
 template<class ScalarType>
@@ -1285,6 +1982,28 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildSparseDirectPreconditioner(const CConfig *config, unsigned short kind_fact) {
+
+  sparse_direct.Build(*this, config, kind_fact == SPARSE_LDLT_P);
+
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeSparseDirectPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                               CGeometry *geometry, const CConfig *config) const {
+
+  sparse_direct.Solve(*this, vec, prod);
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+
+}
+
+#undef CALL_WITH_BLOCK_SIZE
+
 /*--- Explicit instantiations ---*/
 
 #define INSTANTIATE_COMMS(TYPE)\
@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/linear_algebra/blas_structure.hpp"
 
 #include <limits>
 
@@ -120,9 +121,12 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
   const ScalarType reorth = 0.98;
 
   /*--- Get the norm of the vector being orthogonalized, and find the
-  threshold for re-orthogonalization ---*/
+  threshold for re-orthogonalization. The dot product with the first vector
+  is computed in the same pass, the others are fused with the updates. ---*/
 
-  ScalarType nrm = w[i+1].squaredNorm();
+  ScalarType dots[2];
+  ScalarType nrm = w[i+1].multiDot(w, 1, dots);
+  ScalarType prod = dots[0];
   ScalarType thr = nrm*reorth;
 
   /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
@@ -135,18 +139,20 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
   /*--- Begin main Gram-Schmidt loop ---*/
 
   for (int k = 0; k < i+1; k++) {
-    ScalarType prod = w[i+1].dot(w[k]);
     Hsbg(k,i) = prod;
-    w[i+1] -= prod * w[k];
 
     /*--- Check if reorthogonalization is necessary ---*/
 
     if (prod*prod > thr) {
-      prod = w[i+1].dot(w[k]);
+      prod = w[i+1].axpyDot(-prod, w[k], w[k]);
       Hsbg(k,i) += prod;
-      w[i+1] -= prod * w[k];
     }
 
+    /*--- Update, and dot product with the next vector (or squared norm after the last). ---*/
+
+    const auto& next = (k < i)? w[k+1] : w[i+1];
+    prod = w[i+1].axpyDot(-prod, w[k], next);
+
     /*--- Update the norm and check its size ---*/
 
     nrm -= pow(Hsbg(k,i),2);
@@ -156,7 +162,7 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
 
   /*--- Test the resulting vector ---*/
 
-  nrm = w[i+1].norm();
+  nrm = sqrt(prod);
   Hsbg(i+1,i) = nrm;
 
   /*--- Scale the resulting vector ---*/
@@ -165,6 +171,54 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::ClassicalGramSchmidt(int i, su2matrix<ScalarType>& Hsbg,
+                                                 vector<CSysVector<ScalarType> >& w, ScalarType* work) const {
+
+  /*--- Parameter for reorthonormalization, the norm reduction above which the
+   *    orthogonality of one pass is considered sufficient ("twice is enough"). ---*/
+
+  const ScalarType reorth = 0.5;
+
+  /*--- Projections (and norm), and coefficients of the update, the workspace is preallocated by the caller. ---*/
+
+  ScalarType* h = work;
+  ScalarType* alpha = work + i+2;
+
+  /*--- Projections on the basis and norm of the vector, in one pass. ---*/
+
+  const ScalarType nrm0 = w[i+1].multiDot(w, i+1, h);
+
+  if ((nrm0 <= 0.0) || (nrm0 != nrm0)) {
+    /*--- nrm0 is the result of a dot product, communications are implicitly handled. ---*/
+    SU2_MPI::Error("FGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+  }
+
+  for (int k = 0; k < i+1; k++) {
+    Hsbg(k,i) = h[k];
+    alpha[k] = -h[k];
+  }
+  ScalarType nrm = w[i+1].multiAxpySquaredNorm(alpha, w, i+1);
+
+  /*--- Repeat if the cancellation was large. ---*/
+
+  if (nrm < reorth*nrm0) {
+    w[i+1].multiDot(w, i+1, h);
+    for (int k = 0; k < i+1; k++) {
+      Hsbg(k,i) += h[k];
+      alpha[k] = -h[k];
+    }
+    nrm = w[i+1].multiAxpySquaredNorm(alpha, w, i+1);
+  }
+
+  /*--- Scale the resulting vector ---*/
+
+  nrm = sqrt(nrm);
+  Hsbg(i+1,i) = nrm;
+  w[i+1] /= nrm;
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -343,6 +397,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
   const bool flexible = !precond.IsIdentity();
+  const bool classicalGS = config->GetLinear_Solver_Classical_GS();
 
   /*---  Check the subspace size ---*/
 
@@ -374,6 +429,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
    (reduced across all threads and ranks) all threads do the same computations. ---*/
 
   su2vector<ScalarType> g(m+1), sn(m+1), cs(m+1), y(m);
+  su2vector<ScalarType> gsWork(2*(m+1));  // workspace of the classical Gram-Schmidt
   g = ScalarType(0);
   sn = ScalarType(0);
   cs = ScalarType(0);
@@ -448,9 +504,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
       mat_vec(W[i], W[i+1]);
     }
 
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Gram-Schmidt orthogonalization ---*/
 
-    ModGramSchmidt(i, H, W);
+    if (classicalGS) ClassicalGramSchmidt(i, H, W, gsWork.data());
+    else ModGramSchmidt(i, H, W);
 
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
      new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
@@ -476,9 +533,7 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
   const auto& basis = flexible? Z : W;
 
-  for (unsigned long k = 0; k < i; k++) {
-    x += y[k] * basis[k];
-  }
+  x.multiAxpy(y.data(), basis, i);
 
   /*---  Recalculate final (neg.) residual (this should be optional) ---*/
 
@@ -529,6 +584,690 @@ unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarTy
   return 0;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                       ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. W is the orthonormal basis, Z = M*W, and AZ = A*Z. ---*/
+
+  if (W.size() <= m || Z.size() <= m || AZ.size() <= m) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      W.resize(m+1);
+      Z.resize(m+1);
+      AZ.resize(m+1);
+      for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      for (auto& az : AZ) az.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      dotBuffer.resize(4*(m+1));
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  su2vector<ScalarType> g(m+1), sn(m+1), cs(m+1), y(m), h(m+1), hPrev(m+1);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m+1, m);
+  H = ScalarType(0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] -= b;
+  }
+  else {
+    W[0] = -b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+    if (master) cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= -beta;
+  g[0] = beta;
+
+  /*--- The first product cannot be overlapped with communication. ---*/
+
+  precond(W[0], Z[0]);
+  mat_vec(Z[0], AZ[0]);
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("PFGMRES", tol, beta);
+    WriteHistory(i, beta/norm0);
+  }
+
+  const auto nElm = x.GetLocSize();
+  const auto nElmDomain = x.GetNElmDomain();
+#ifdef HAVE_OMP
+  const auto chunkSize = computeStaticChunkSize(nElm, omp_get_num_threads(), OMP_MAX_SIZE);
+#endif
+  vector<ScalarType> localDot(2*(m+1));
+
+  /*--- Loss of orthogonality of the newest basis vector above which it is corrected. ---*/
+  const ScalarType orthTol = sqrt(eps);
+  ScalarType gPrev = 0.0;
+
+  for (i = 0; i < m; i++) {
+
+    if (beta < tol*norm0) break;
+
+    /*--- Dot products of the new (not yet orthogonal) vector with the basis, and its squared norm,
+     *    in a single pass over the vectors. The reduction is started but not completed.
+     *    Without re-orthogonalization the basis loses orthogonality as the iterations progress,
+     *    to monitor this, the products of the newest basis vector with the others (and its
+     *    squared norm) are also computed, these require no additional memory traffic. ---*/
+
+    const auto nDot = 2*i+3;
+    auto* sendBuf = dotBuffer.data();
+    auto* recvBuf = dotBuffer.data() + 2*(m+1);
+    const auto* orth = recvBuf + i+2;
+    const auto& w = AZ[i];
+    const auto& wi = W[i];
+
+    SU2_OMP_SAFE_GLOBAL_ACCESS(for (auto k = 0ul; k < nDot; ++k) sendBuf[k] = 0.0;)
+
+    for (auto k = 0ul; k < nDot; ++k) localDot[k] = 0.0;
+
+    SU2_OMP_FOR_STAT(chunkSize)
+    for (auto iElm = 0ul; iElm < nElmDomain; ++iElm) {
+      for (auto k = 0ul; k < i; ++k) {
+        localDot[k] += w[iElm] * W[k][iElm];
+        localDot[i+2+k] += wi[iElm] * W[k][iElm];
+      }
+      localDot[i] += w[iElm] * wi[iElm];
+      localDot[i+1] += w[iElm] * w[iElm];
+      localDot[2*i+2] += wi[iElm] * wi[iElm];
+    }
+    END_SU2_OMP_FOR
+
+    for (auto k = 0ul; k < nDot; ++k) atomicAdd(localDot[k], sendBuf[k]);
+
+    typename SelectMPIWrapper<ScalarType>::W::Request request;
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+      SelectMPIWrapper<ScalarType>::W::Iallreduce(sendBuf, recvBuf, nDot, mpi_type, MPI_SUM, SU2_MPI::GetComm(), &request);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    /*--- Overlap with the next preconditioner and product, M*AZ[i] and A*M*AZ[i].
+     *    Since M is linear, Z[i+1] and AZ[i+1] are then obtained by recurrence. ---*/
+
+    precond(AZ[i], Z[i+1]);
+    mat_vec(Z[i+1], AZ[i+1]);
+
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SelectMPIWrapper<ScalarType>::W::Wait(&request, MPI_STATUS_IGNORE);)
+
+    /*--- Correct the newest basis vector if it lost orthogonality, one more pass of classical
+     *    Gram-Schmidt with the products computed above. All the quantities derived from it are
+     *    corrected, the Hessenberg column that defines it, and the last Givens rotation.
+     *    The products and reductions of this iteration are then recomputed (not overlapped). ---*/
+
+    ScalarType loss = fabs(orth[i] - 1.0);
+    for (auto k = 0ul; k < i; ++k) loss = max(loss, fabs(orth[k]));
+
+    if (i > 0 && loss > orthTol) {
+      ScalarType nrm2 = orth[i];
+      for (auto k = 0ul; k < i; ++k) nrm2 -= orth[k]*orth[k];
+      const ScalarType scale = 1.0 / sqrt(nrm2);
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (auto iElm = 0ul; iElm < nElm; ++iElm) {
+        ScalarType v = W[i][iElm], z = Z[i][iElm], az = AZ[i][iElm];
+        for (auto k = 0ul; k < i; ++k) {
+          v -= orth[k] * W[k][iElm];
+          z -= orth[k] * Z[k][iElm];
+          az -= orth[k] * AZ[k][iElm];
+        }
+        W[i][iElm] = v * scale;
+        Z[i][iElm] = z * scale;
+        AZ[i][iElm] = az * scale;
+      }
+      END_SU2_OMP_FOR
+
+      for (auto k = 0ul; k < i; ++k) hPrev[k] += hPrev[i] * orth[k];
+      hPrev[i] *= sqrt(nrm2);
+
+      for (auto k = 0ul; k <= i; ++k) H(k,i-1) = hPrev[k];
+      for (auto k = 0ul; k+1 < i; ++k) ApplyGivens(sn[k], cs[k], H(k,i-1), H(k+1,i-1));
+      GenerateGivens(H(i-1,i-1), H(i,i-1), sn[i-1], cs[i-1]);
+      g[i-1] = gPrev;
+      g[i] = 0.0;
+      ApplyGivens(sn[i-1], cs[i-1], g[i-1], g[i]);
+
+      precond(AZ[i], Z[i+1]);
+      mat_vec(Z[i+1], AZ[i+1]);
+      AZ[i].multiDot(W, i+1, localDot.data());
+
+      SU2_OMP_SAFE_GLOBAL_ACCESS(for (auto k = 0ul; k < i+2; ++k) recvBuf[k] = localDot[k];)
+    }
+
+    /*--- New column of the Hessenberg matrix, the norm of the orthogonal vector is obtained from
+     *    Pythagoras' theorem, if the cancellation is severe the basis lost orthogonality. ---*/
+
+    if ((recvBuf[i+1] <= 0.0) || (recvBuf[i+1] != recvBuf[i+1])) {
+      /*--- The result is the same on all ranks, communications are implicitly handled. ---*/
+      SU2_MPI::Error("PFGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+
+    ScalarType nrm = recvBuf[i+1];
+    for (auto k = 0ul; k <= i; ++k) {
+      h[k] = recvBuf[k];
+      nrm -= h[k]*h[k];
+    }
+
+    const bool breakdown = (nrm <= eps * recvBuf[i+1]);
+    nrm = breakdown? ScalarType(0) : sqrt(nrm);
+
+    for (auto k = 0ul; k <= i; ++k) H(k,i) = h[k];
+    H(i+1,i) = nrm;
+
+    /*--- Keep the column before the rotations, in case it needs to be corrected. ---*/
+
+    for (auto k = 0ul; k <= i+1; ++k) hPrev[k] = H(k,i);
+
+    /*--- Fused updates of the three bases (all elements to keep the halos consistent). ---*/
+
+    if (!breakdown) {
+      const ScalarType scale = 1.0 / nrm;
+
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (auto iElm = 0ul; iElm < nElm; ++iElm) {
+        ScalarType v = w[iElm], z = Z[i+1][iElm], az = AZ[i+1][iElm];
+        for (auto k = 0ul; k <= i; ++k) {
+          v -= h[k] * W[k][iElm];
+          z -= h[k] * Z[k][iElm];
+          az -= h[k] * AZ[k][iElm];
+        }
+        W[i+1][iElm] = v * scale;
+        Z[i+1][iElm] = z * scale;
+        AZ[i+1][iElm] = az * scale;
+      }
+      END_SU2_OMP_FOR
+    }
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++)
+      ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    gPrev = g[i];
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+    beta = fabs(g[i+1]);
+
+    if ((((monitoring) && (master)) && ((i+1) % monitorFreq == 0)) && (master))
+      WriteHistory(i+1, beta/norm0);
+
+    if (breakdown) {
+      i++;
+      break;
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  x.multiAxpy(y.data(), Z, i);
+
+  /*--- The residual is estimated from recurrences, recompute it if monitoring. ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("PFGMRES", i, beta/norm0);
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol*10) {
+        if (master) {
+          WriteWarning(beta, res, tol);
+        }
+      }
+    }
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::GCRODR_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                      const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                      ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, const CConfig *config) {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  const bool flexible = !precond.IsIdentity();
+  const bool classicalGS = config->GetLinear_Solver_Classical_GS();
+  const unsigned long recycleSize = config->GetLinear_Solver_Recycle_Size();
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("GCRO-DR subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet ---*/
+
+  if (W.size() <= m || (flexible && Z.size() <= m) || U.size() < recycleSize) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      if (W.size() <= m) {
+        W.resize(m+1);
+        for (auto& w : W) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+      if (flexible && Z.size() <= m) {
+        Z.resize(m+1);
+        for (auto& z : Z) z.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+      if (U.size() < recycleSize) {
+        for (auto* vecs : {&U, &C, &Uhat, &U_new, &C_new, &Uhat_new}) {
+          vecs->resize(recycleSize);
+          for (auto& v : *vecs) v.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+        }
+        nRecycled = 0;
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Arrays of the reduced system, see FGMRES, plus the projections onto C and
+   *    a copy of the Hessenberg matrix before the Givens rotations are applied. ---*/
+
+  su2vector<ScalarType> g(m+1), sn(m+1), cs(m+1), y(m);
+  su2vector<ScalarType> gsWork(2*(m+1));  // workspace of the classical Gram-Schmidt
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m+1, m), Hbar(m+1, m), B(max<unsigned long>(recycleSize, 1), m);
+  H = ScalarType(0);
+  Hbar = ScalarType(0);
+  B = ScalarType(0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] = b - W[0];
+  }
+  else {
+    W[0] = b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+    if (master) cout << "CSysSolve::GCRODR(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  /*--- If the matrix (or the preconditioner) changed, compute the image of the recycled subspace, C = A*U,
+   *    orthonormalize it, and apply the same transformation to U and Uhat. With preconditioning the pair must
+   *    satisfy U = M^-1 * Uhat for the current M, since M itself is not available U is recomputed from Uhat
+   *    (both span approximations of the same deflation space). ---*/
+
+  if (!recycledImageValid) {
+    unsigned long nValid = 0;
+    for (auto j = 0ul; j < nRecycled; ++j) {
+      if (nValid != j) {
+        U[nValid] = U[j];
+        Uhat[nValid] = Uhat[j];
+      }
+      if (flexible) precond(Uhat[nValid], U[nValid]);
+      mat_vec(U[nValid], C[nValid]);
+      const ScalarType nrmRef = C[nValid].norm();
+
+      for (auto l = 0ul; l < nValid; ++l) {
+        const ScalarType proj = C[l].dot(C[nValid]);
+        C[nValid] -= proj * C[l];
+        U[nValid] -= proj * U[l];
+        Uhat[nValid] -= proj * Uhat[l];
+      }
+      const ScalarType nrm = C[nValid].norm();
+
+      /*--- Discard vectors that became (nearly) linearly dependent. ---*/
+      if (nrm > sqrt(eps) * nrmRef) {
+        C[nValid] /= nrm;
+        U[nValid] /= nrm;
+        Uhat[nValid] /= nrm;
+        ++nValid;
+      }
+    }
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      nRecycled = nValid;
+      recycledImageValid = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  const auto k = nRecycled;
+
+  /*--- Minimize the residual over the recycled subspace, x += U*C'*r, r -= C*C'*r. ---*/
+
+  /*--- Projections onto C (plus the squared norm), allocated once per solve. ---*/
+  vector<ScalarType> proj(k+1);
+
+  if (classicalGS && k > 0) {
+    W[0].multiDot(C, k, proj.data());
+    x.multiAxpy(proj.data(), U, k);
+    for (auto j = 0ul; j < k; ++j) proj[j] = -proj[j];
+    beta = sqrt(W[0].multiAxpySquaredNorm(proj.data(), C, k));
+  }
+  else {
+    for (auto j = 0ul; j < k; ++j) {
+      const ScalarType proj = C[j].dot(W[0]);
+      x += proj * U[j];
+      W[0] -= proj * C[j];
+    }
+    if (k > 0) beta = W[0].norm();
+  }
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("GCRODR", tol, beta);
+    WriteHistory(i, beta/norm0);
+  }
+
+  if (beta < tol*norm0) {
+    if ((monitoring) && (master)) WriteFinalResidual("GCRODR", i, beta/norm0);
+    residual = beta/norm0;
+    return 0;
+  }
+
+  W[0] /= beta;
+  g[0] = beta;
+
+  /*---  Loop over all search directions, the Arnoldi process is applied to (I-C*C')*A*M^-1. ---*/
+
+  for (i = 0; i < m; i++) {
+
+    if (beta < tol*norm0) break;
+
+    if (flexible) {
+      precond(W[i], Z[i]);
+      mat_vec(Z[i], W[i+1]);
+    }
+    else {
+      mat_vec(W[i], W[i+1]);
+    }
+
+    if (classicalGS && k > 0) {
+      W[i+1].multiDot(C, k, proj.data());
+      for (auto j = 0ul; j < k; ++j) {
+        B(j,i) = proj[j];
+        proj[j] = -proj[j];
+      }
+      W[i+1].multiAxpy(proj.data(), C, k);
+    }
+    else {
+      for (auto j = 0ul; j < k; ++j) {
+        B(j,i) = C[j].dot(W[i+1]);
+        W[i+1] -= B(j,i) * C[j];
+      }
+    }
+
+    if (classicalGS) ClassicalGramSchmidt(i, H, W, gsWork.data());
+    else ModGramSchmidt(i, H, W);
+
+    for (unsigned long l = 0; l <= i+1; l++) Hbar(l,i) = H(l,i);
+
+    for (unsigned long l = 0; l < i; l++)
+      ApplyGivens(sn[l], cs[l], H[l][i], H[l+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+
+    beta = fabs(g[i+1]);
+
+    if (((monitoring) && (master)) && ((i+1) % monitorFreq == 0))
+      WriteHistory(i+1, beta/norm0);
+  }
+
+  /*---  Solve the least-squares system and update the solution, x += Z*y - U*B*y, since A*Z = C*B + W*Hbar. ---*/
+
+  SolveReduced(i, H, g, y);
+
+  const auto& basis = flexible? Z : W;
+
+  x.multiAxpy(y.data(), basis, i);
+
+  vector<ScalarType> By(k, 0.0);
+  for (auto j = 0ul; j < k; ++j) {
+    for (unsigned long l = 0; l < i; l++) By[j] -= B(j,l) * y[l];
+  }
+  x.multiAxpy(By.data(), U, k);
+
+  /*--- Select the subspace to recycle in the next solve. ---*/
+
+  if (i > 0 && recycleSize > 0) UpdateRecycledSubspace(i, Hbar, B, basis, recycleSize);
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("GCRODR", i, beta/norm0);
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol*10) {
+        if (master) {
+          WriteWarning(beta, res, tol);
+        }
+      }
+    }
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::UpdateRecycledSubspace(unsigned long n, const su2matrix<ScalarType>& Hbar,
+                                                   const su2matrix<ScalarType>& B, const vector<CSysVector<ScalarType> >& basis,
+                                                   unsigned long maxSize) {
+  /*--- The small dense problems are solved redundantly by all threads (like the reduced system of FGMRES),
+   *    in passive double precision since only the subspace matters, not its derivatives. ---*/
+
+  const auto k = nRecycled;
+  const auto nCols = k + n;
+  auto nNew = min(maxSize, nCols);
+
+  /*--- Augmented Hessenberg, G = [I, B; 0, Hbar], A*[U, Z] = [C, W] * G. ---*/
+
+  su2passivematrix G(nCols+1, nCols);
+  G = 0.0;
+  for (auto j = 0ul; j < k; ++j) {
+    G(j,j) = 1.0;
+    for (auto l = 0ul; l < n; ++l) G(j,k+l) = SU2_TYPE::GetValue(B(j,l));
+  }
+  for (auto l = 0ul; l <= n; ++l)
+    for (auto c = 0ul; c < n; ++c) G(k+l,k+c) = SU2_TYPE::GetValue(Hbar(l,c));
+
+  /*--- Harmonic Ritz vectors, G'*G*p = theta*G'*T*p, with T = [C, W]'*[Uhat, W] = [C'*Uhat, 0; W'*Uhat, I; 0]
+   *    (the Krylov vectors are orthonormal and orthogonal to C). Without preconditioning Uhat = U. In the first
+   *    solve T is the identity on top of a row of zeros, but in general the recycled vectors are not orthonormal.
+   *    The invariant subspace of the smallest |theta| is the dominant one of (G'*G)^-1 * G'*T, found by subspace
+   *    iteration, which gives a real basis for it even if the eigenvalues are complex. ---*/
+
+  const bool flexible = (&basis != &W);
+  const auto& Uh = flexible? Uhat : U;
+
+  su2passivematrix T(nCols+1, nCols);
+  T = 0.0;
+  vector<ScalarType> dots(max(k, n+1) + 1);
+  for (auto j = 0ul; j < k; ++j) {
+    Uh[j].multiDot(C, k, dots.data());
+    for (auto a = 0ul; a < k; ++a) T(a,j) = SU2_TYPE::GetValue(dots[a]);
+    Uh[j].multiDot(W, n+1, dots.data());
+    for (auto l = 0ul; l <= n; ++l) T(k+l,j) = SU2_TYPE::GetValue(dots[l]);
+  }
+  for (auto l = 0ul; l < n; ++l) T(k+l,k+l) = 1.0;
+
+  su2passivematrix GtG(nCols, nCols);
+  passivedouble trace = 0.0;
+  for (auto a = 0ul; a < nCols; ++a) {
+    for (auto c = 0ul; c < nCols; ++c) {
+      passivedouble sum = 0.0;
+      for (auto r = 0ul; r <= nCols; ++r) sum += G(r,a) * G(r,c);
+      GtG(a,c) = sum;
+    }
+    trace += GtG(a,a);
+  }
+  /*--- Small shift for robustness, G has full rank unless the Arnoldi process broke down. ---*/
+  for (auto a = 0ul; a < nCols; ++a) GtG(a,a) += 1e-14 * trace / nCols;
+
+  CBlasStructure::inverse(nCols, GtG);
+
+  su2passivematrix GtT(nCols, nCols), K(nCols, nCols);
+  for (auto a = 0ul; a < nCols; ++a) {
+    for (auto c = 0ul; c < nCols; ++c) {
+      passivedouble sum = 0.0;
+      for (auto r = 0ul; r <= nCols; ++r) sum += G(r,a) * T(r,c);
+      GtT(a,c) = sum;
+    }
+  }
+  for (auto a = 0ul; a < nCols; ++a) {
+    for (auto c = 0ul; c < nCols; ++c) {
+      passivedouble sum = 0.0;
+      for (auto r = 0ul; r < nCols; ++r) sum += GtG(a,r) * GtT(r,c);
+      K(a,c) = sum;
+    }
+  }
+
+  /*--- Orthonormalize the columns of a small matrix in place, returns the number of independent columns. ---*/
+  auto orthonormalize = [](su2passivematrix& mat, unsigned long nRows, unsigned long nVecs, su2passivematrix* R) {
+    for (auto j = 0ul; j < nVecs; ++j) {
+      for (auto l = 0ul; l < j; ++l) {
+        passivedouble proj = 0.0;
+        for (auto r = 0ul; r < nRows; ++r) proj += mat(r,l) * mat(r,j);
+        for (auto r = 0ul; r < nRows; ++r) mat(r,j) -= proj * mat(r,l);
+        if (R) (*R)(l,j) = proj;
+      }
+      passivedouble nrm = 0.0;
+      for (auto r = 0ul; r < nRows; ++r) nrm += pow(mat(r,j), 2);
+      nrm = sqrt(nrm);
+      if (nrm < 1e-12) return j;
+      for (auto r = 0ul; r < nRows; ++r) mat(r,j) /= nrm;
+      if (R) (*R)(j,j) = nrm;
+    }
+    return nVecs;
+  };
+
+  /*--- Deterministic start (all threads and ranks must compute the same subspace). ---*/
+  su2passivematrix P(nCols, nNew), KP(nCols, nNew);
+  for (auto a = 0ul; a < nCols; ++a)
+    for (auto j = 0ul; j < nNew; ++j) P(a,j) = cos(1.0 + a * (j + 1.0));
+  nNew = orthonormalize(P, nCols, nNew, nullptr);
+
+  for (int iter = 0; iter < 50 && nNew > 0; ++iter) {
+    for (auto a = 0ul; a < nCols; ++a) {
+      for (auto j = 0ul; j < nNew; ++j) {
+        passivedouble sum = 0.0;
+        for (auto c = 0ul; c < nCols; ++c) sum += K(a,c) * P(c,j);
+        KP(a,j) = sum;
+      }
+    }
+    swap(P, KP);
+    nNew = orthonormalize(P, nCols, nNew, nullptr);
+  }
+
+  /*--- New image C = [C, W] * Q, where G*P = Q*R, and new subspace U = [U, Z] * P * R^-1. ---*/
+
+  su2passivematrix Q(nCols+1, nNew), R(nNew, nNew);
+  R = 0.0;
+  for (auto r = 0ul; r <= nCols; ++r) {
+    for (auto j = 0ul; j < nNew; ++j) {
+      passivedouble sum = 0.0;
+      for (auto c = 0ul; c < nCols; ++c) sum += G(r,c) * P(c,j);
+      Q(r,j) = sum;
+    }
+  }
+  nNew = orthonormalize(Q, nCols+1, nNew, &R);
+
+  for (auto j = 0ul; j < nNew; ++j) {
+    for (auto a = 0ul; a < nCols; ++a) {
+      for (auto l = 0ul; l < j; ++l) P(a,j) -= P(a,l) * R(l,j);
+      P(a,j) /= R(j,j);
+    }
+  }
+
+  for (auto j = 0ul; j < nNew; ++j) {
+    U_new[j] = ScalarType(0.0);
+    for (auto a = 0ul; a < nCols; ++a) {
+      const auto& s = (a < k)? U[a] : basis[a-k];
+      U_new[j] += ScalarType(P(a,j)) * s;
+    }
+    C_new[j] = ScalarType(0.0);
+    for (auto a = 0ul; a <= nCols; ++a) {
+      const auto& w = (a < k)? C[a] : W[a-k];
+      C_new[j] += ScalarType(Q(a,j)) * w;
+    }
+    if (flexible) {
+      Uhat_new[j] = ScalarType(0.0);
+      for (auto a = 0ul; a < nCols; ++a) {
+        const auto& s = (a < k)? Uhat[a] : W[a-k];
+        Uhat_new[j] += ScalarType(P(a,j)) * s;
+      }
+    }
+    else {
+      /*--- Without preconditioning Uhat = U, kept in case a later solve is preconditioned. ---*/
+      Uhat_new[j] = U_new[j];
+    }
+  }
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    swap(U, U_new);
+    swap(C, C_new);
+    swap(Uhat, Uhat_new);
+    nRecycled = nNew;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                        const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -807,6 +1546,111 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::AsyncSmoother_LinSolver(const CSysMatrix<ScalarType> & Jacobian,
+                                                             const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                             const CMatrixVectorProduct<ScalarType> & mat_vec,
+                                                             const CPreconditioner<ScalarType> & precond, ScalarType tol,
+                                                             unsigned long m, ScalarType & residual, bool monitoring,
+                                                             CGeometry *geometry, const CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  const auto nSweeps = config->GetLinear_Solver_Smoother_Async_Sweeps();
+  const ScalarType omega = SU2_TYPE::GetValue(config->GetLinear_Solver_Smoother_Relaxation());
+  unsigned long i = 0;
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Same vectors as the generic smoother, z keeps the last solution that reduced the residual. ---*/
+
+  if (!smooth_ready) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      A_x.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      r.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+      z.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      smooth_ready = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  if (!xIsZero) {
+    mat_vec(x, A_x);
+    r = b - A_x;
+  } else {
+    r = b;
+  }
+
+  /*--- The residual is always computed since it is what decides if the asynchronous iterations are working. ---*/
+
+  ScalarType norm_r = r.norm();
+  ScalarType norm0 = (tol_type == LinearToleranceType::RELATIVE)? norm_r : b.norm();
+
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::AsyncSmoother_LinSolver(): system solved by initial guess." << endl;
+    return 0;
+  }
+
+  if ((monitoring) && (master)) {
+    WriteHeader("Async Smoother", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  bool async = true;
+
+  for (i=0; i<m; i++) {
+
+    if (async) {
+      z = x;
+      Jacobian.ComputeAsyncRelaxation(b, x, nSweeps, omega, geometry, config);
+
+      mat_vec(x, A_x);
+      r = b - A_x;
+      const ScalarType norm_new = r.norm();
+
+      if (norm_new < norm_r) {
+        norm_r = norm_new;
+      } else {
+        /*--- The chaotic iterations are not contracting (e.g. the matrix is far from diagonally dominant,
+         *    or the threads are too out of step), undo the iteration and use the deterministic smoother,
+         *    with barriers, for the remaining iterations. The check is also true for NaN. ---*/
+        async = false;
+        x = z;
+        mat_vec(x, A_x);
+        r = b - A_x;
+        if ((monitoring) && (master)) cout << "CSysSolve::AsyncSmoother_LinSolver(): residual did not decrease, "
+                                                 "switching to the synchronous smoother." << endl;
+        continue;
+      }
+    } else {
+      /*--- Same as Smoother_LinSolver. ---*/
+      precond(r, z);
+      mat_vec(z, A_x);
+      x += omega * z;
+      r -= omega * A_x;
+      norm_r = r.norm();
+    }
+
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (master)) && ((i+1) % monitorFreq == 0))
+      WriteHistory(i+1, norm_r/norm0);
+  }
+
+  if ((monitoring) && (master) && (config->GetComm_Level() == COMM_FULL)) {
+    WriteFinalResidual("Async Smoother", i, norm_r/norm0);
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
@@ -880,6 +1724,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
+  /*--- The matrix is assumed to have changed since the last call, the recycled subspace (GCRO-DR) is kept
+   *    but its image needs to be recomputed. The image is valid for the iterative refinement steps. ---*/
+  SU2_OMP_SAFE_GLOBAL_ACCESS(recycledImageValid = false;)
+
+  Jacobian.UpdateSELLValues();
+
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
   const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(KindPrecond);
@@ -895,30 +1745,105 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   unsigned long IterLinSol = 0;
   ScalarType residual = 0.0;
 
-  switch (KindSolver) {
-    case BCGSTAB:
-      IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case FGMRES:
-      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case RESTARTED_FGMRES:
-      IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case CONJUGATE_GRADIENT:
-      IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case SMOOTHER:
-      IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
-      break;
-    case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-      IterLinSol = 1;
-      residual = 1e-20;
-      break;
-    default:
-      SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+  auto solveSystem = [&](const VectorType& b, VectorType& x, ScalarType tol, unsigned long maxIter, ScalarType& res) {
+    unsigned long iter = 0;
+    switch (KindSolver) {
+      case BCGSTAB:
+        iter = BCGSTAB_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case FGMRES:
+        iter = FGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case RESTARTED_FGMRES:
+        iter = RFGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case PIPELINED_FGMRES:
+        iter = PFGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case GCRODR:
+        iter = GCRODR_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case CONJUGATE_GRADIENT:
+        iter = CG_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case SMOOTHER:
+        if (config->GetLinear_Solver_Smoother_Async_Sweeps() > 0)
+          iter = AsyncSmoother_LinSolver(Jacobian, b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput,
+                                         geometry, config);
+        else
+          iter = Smoother_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case SPARSE_LDLT: case SPARSE_LU:
+        /*--- The preconditioner is the factorization (see CConfig), FGMRES takes care of stale
+         *    factorizations and of the coupling between ranks, otherwise it converges in one iteration. ---*/
+        iter = FGMRES_LinSolver(b, x, mat_vec, *precond, tol, maxIter, res, ScreenOutput, config);
+        break;
+      case PASTIX_LDLT : case PASTIX_LU:
+        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        Jacobian.ComputePastixPreconditioner(b, x, geometry, config);
+        iter = 1;
+        res = 1e-20;
+        break;
+      default:
+        SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
+    }
+    return iter;
+  };
+
+  /*--- Iterative refinement is only useful when the matrix (and therefore the Krylov solver)
+   *    has lower precision than the residual and solution vectors. ---*/
+
+  const unsigned long RefineIter = (lin_sol_mode == LINEAR_SOLVER_MODE::STANDARD)? config->GetLinear_Solver_Refinement_Iter() : 0;
+  const bool Refine = (RefineIter > 0) && (sizeof(ScalarType) < sizeof(passivedouble));
+
+  if (!Refine) {
+    IterLinSol = solveSystem(*LinSysRes_ptr, *LinSysSol_ptr, SolverTol, MaxIter, residual);
+  }
+  else {
+    /*--- Outer loop in the precision of LinSysSol, the corrections are computed in the precision of
+     *    the matrix from the full precision residual, which allows the inner solver to reach tolerances
+     *    that would otherwise be limited by round-off, i.e. A*e = A*x - b, x = x - e. ---*/
+
+    const bool xIsZeroOrig = xIsZero;
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      /*--- Allocated on the first solve, or if the size of the system changes. ---*/
+      if (LinSysRes_refine.GetLocSize() != LinSysRes.GetLocSize())
+        LinSysRes_refine.Initialize(LinSysRes.GetNBlk(), LinSysRes.GetNBlkDomain(), LinSysRes.GetNVar(), nullptr);
+      xIsZero = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    passivedouble normRef = SU2_TYPE::GetValue(LinSysRes.norm());
+    passivedouble normRes = 0.0;
+
+    for (auto iRefine = 0ul; ; ++iRefine) {
+
+      /*--- Full precision residual. ---*/
+      CSysMatrixComms::Initiate(LinSysSol, geometry, config);
+      CSysMatrixComms::Complete(LinSysSol, geometry, config);
+      Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysRes_refine);
+      normRes = SU2_TYPE::GetValue(LinSysRes_refine.norm());
+
+      if (iRefine == 0 && tol_type == LinearToleranceType::RELATIVE) normRef = normRes;
+
+      if (normRes <= SolverTol*normRef || normRes < eps || iRefine == RefineIter || IterLinSol >= MaxIter) break;
+
+      /*--- Correction, the inner tolerance is limited by the precision of the matrix. ---*/
+      LinSysRes_tmp.PassiveCopy(LinSysRes_refine);
+      LinSysSol_tmp.SetValZero();
+
+      const ScalarType innerTol = max<ScalarType>(SolverTol*normRef/normRes, 100*eps);
+      ScalarType innerRes = 0.0;
+      IterLinSol += solveSystem(LinSysRes_tmp, LinSysSol_tmp, innerTol, MaxIter-IterLinSol, innerRes);
+
+      LinSysRes_refine.PassiveCopy(LinSysSol_tmp);
+      LinSysSol -= LinSysRes_refine;
+    }
+
+    SU2_OMP_SAFE_GLOBAL_ACCESS(xIsZero = xIsZeroOrig;)
+
+    residual = normRes / max<passivedouble>(normRef, eps);
   }
 
   SU2_OMP_MASTER
@@ -928,7 +1853,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   }
   END_SU2_OMP_MASTER
 
-  HandleTemporariesOut(LinSysSol);
+  /*--- With refinement the solution was updated directly. ---*/
+  if (!Refine) HandleTemporariesOut(LinSysSol);
 
   delete precond;
 
@@ -943,18 +1869,30 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
     /*--- Build preconditioner for the transposed Jacobian ---*/
 
-    if (RequiresTranspose) Jacobian.TransposeInPlace();
+    if (RequiresTranspose) {
+      Jacobian.TransposeInPlace();
+      SU2_OMP_SAFE_GLOBAL_ACCESS(recycledImageValid = false;)
+    }
 
     switch(KindPrecond) {
       case ILU:
         if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
         break;
+      case AMG:
+        if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+        break;
       case JACOBI:
-      case LINELET:
         if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
         break;
+      case LINELET: case LINELET_ILU:
+        if (RequiresTranspose) Jacobian.BuildLineletPreconditioner(geometry, config);
+        break;
       case LU_SGS:
-        /*--- Nothing to build. ---*/
+        /*--- Only the compressed blocks, if used. ---*/
+        if (RequiresTranspose) Jacobian.BuildLU_SGSPreconditioner();
+        break;
+      case SPARSE_LU_P: case SPARSE_LDLT_P:
+        if (RequiresTranspose) Jacobian.BuildSparseDirectPreconditioner(config, KindPrecond);
         break;
       case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
         /*--- It was already built. ---*/
@@ -1038,12 +1976,18 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-  /*--- If there was no call to solve first the preconditioner needs to be built here. ---*/
+  /*--- If there was no call to solve first the preconditioner needs to be built here, and the image of
+   *    the recycled subspace (GCRO-DR) recomputed. Otherwise the matrix is the same as in the previous
+   *    call (i.e. repeated adjoint iterations) and the image is reused. ---*/
   if (directCall) {
     Jacobian.TransposeInPlace();
     precond->Build();
+    SU2_OMP_SAFE_GLOBAL_ACCESS(recycledImageValid = false;)
   }
 
+  /*--- The matrix may have been transposed since the last call to Solve. ---*/
+  Jacobian.UpdateSELLValues();
+
   auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
   /*--- Solve the system ---*/
@@ -1060,6 +2004,12 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case RESTARTED_FGMRES:
       IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      break;
+    case GCRODR:
+      IterLinSol = GCRODR_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      break;
     case BCGSTAB:
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
       break;
@@ -1069,6 +2019,9 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case SMOOTHER:
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case SPARSE_LDLT: case SPARSE_LU:
+      IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, residual, ScreenOutput, config);
+      break;
     case PASTIX_LDLT : case PASTIX_LU:
       if (directCall) Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
       Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
@@ -27,6 +27,7 @@
  */
 
 #include "../include/wall_model.hpp"
+#include "../include/linear_algebra/blas_structure.hpp"
 #include "../../SU2_CFD/include/fluid/CFluidModel.hpp"
 
 /* Prototypes for Lapack functions, if MKL or LAPACK is used. */
@@ -35,6 +36,36 @@ extern "C" void dgtsv_(int*, int*, passivedouble*, passivedouble*,
                        passivedouble*, passivedouble*, int*, int*);
 #endif
 
+namespace {
+/*!
+ * \brief Solve a tridiagonal system with Lapack if available, otherwise with the Thomas algorithm.
+ * \param[in] lower - Sub diagonal (n-1 values), destroyed on exit.
+ * \param[in] diagonal - Main diagonal (n values), destroyed on exit.
+ * \param[in] upper - Super diagonal (n-1 values), destroyed on exit.
+ * \param[in,out] rhs - Right hand side on entry, solution on exit.
+ */
+void SolveTridiagonal(vector<su2double>& lower, vector<su2double>& diagonal,
+                      vector<su2double>& upper, vector<su2double>& rhs) {
+
+  int n = diagonal.size();
+
+#if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  int info, nrhs = 1;
+
+  dgtsv_(&n,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&n, &info);
+  if (info != 0)
+    SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
+#else
+  /* The Thomas algorithm uses the row index for the sub and super diagonals. */
+  vector<su2double> sub(n, 0.0), super(n, 0.0);
+  for (int i = 1; i < n; ++i) sub[i] = lower[i-1];
+  for (int i = 0; i < n-1; ++i) super[i] = upper[i];
+
+  CBlasStructure::tdma(sub, diagonal, super, rhs);
+#endif
+}
+}
+
 CWallModel::CWallModel(CConfig *config) {
 
   /* Get the laminar and turbulent Prandtl number from config. */
@@ -58,6 +89,23 @@ void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                             su2double       &ViscosityWall,
                                             su2double       &kOverCvWall) {}
 
+void CWallModel::WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                                const su2double tExchange,
+                                                const su2double velExchange,
+                                                const su2double muExchange,
+                                                const su2double pExchange,
+                                                const su2double Wall_HeatFlux,
+                                                const bool      HeatFlux_Prescribed,
+                                                const su2double Wall_Temperature,
+                                                const bool      Temperature_Prescribed,
+                                                CFluidModel     *FluidModel,
+                                                su2double       &tauWall,
+                                                su2double       &qWall,
+                                                su2double       &ViscosityWall,
+                                                su2double       &kOverCvWall) const {
+  SU2_MPI::Error("The wall model is not available for the finite volume solvers.", CURRENT_FUNCTION);
+}
+
 CWallModel1DEQ::CWallModel1DEQ(CConfig      *config,
                                const string &Marker_Tag)
   :  CWallModel(config) {
@@ -113,10 +161,56 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 su2double &ViscosityWall,
                                                 su2double &kOverCvWall) {
 
-
   /* Set tau wall to initial guess
    */
   tauWall = 0.5;
+
+  SolveWallModel(1.0, tExchange, velExchange, muExchange, pExchange, HeatFlux_Prescribed, TWall,
+                 tauWall, qWall, ViscosityWall, kOverCvWall);
+}
+
+void CWallModel1DEQ::WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                                    const su2double tExchange,
+                                                    const su2double velExchange,
+                                                    const su2double muExchange,
+                                                    const su2double pExchange,
+                                                    const su2double Wall_HeatFlux,
+                                                    const bool      HeatFlux_Prescribed,
+                                                    const su2double TWall,
+                                                    const bool      Temperature_Prescribed,
+                                                    CFluidModel    *FluidModel,
+                                                    su2double &tauWall,
+                                                    su2double &qWall,
+                                                    su2double &ViscosityWall,
+                                                    su2double &kOverCvWall) const {
+
+  /* Start from the previous wall shear stress, if there is one.
+   */
+  if (tauWall <= 0.0) tauWall = 0.5;
+
+  SolveWallModel(hExchange/h_wm, tExchange, velExchange, muExchange, pExchange, HeatFlux_Prescribed, TWall,
+                 tauWall, qWall, ViscosityWall, kOverCvWall);
+}
+
+void CWallModel1DEQ::SolveWallModel(const su2double scale,
+                                    const su2double tExchange,
+                                    const su2double velExchange,
+                                    const su2double muExchange,
+                                    const su2double pExchange,
+                                    const bool      HeatFlux_Prescribed,
+                                    const su2double TWall,
+                                    su2double &tauWall,
+                                    su2double &qWall,
+                                    su2double &ViscosityWall,
+                                    su2double &kOverCvWall) const {
+
+  /* Wall model grid for the exchange height, the normalized grid is
+     scaled, which is cheap compared to the iterations below.
+   */
+  vector<su2double> ycv(y_cv), yfa(y_fa);
+  for (auto& y : ycv) y *= scale;
+  for (auto& y : yfa) y *= scale;
+
   qWall = 0.0;
   ViscosityWall = 0.0;
   kOverCvWall = 0.0;
@@ -176,14 +270,14 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
       rho = pExchange / (R*T[i]);
       nu = mu_fa[i] / rho;
       utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
+      y_plus = yfa[i] * utau / nu;
       D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * karman * y_fa[i] * utau * D;
+      mut = rho * karman * yfa[i] * utau * D;
       mu_fa[i] += mut;
     }
 
     /* Momentum matrix
-     The solution vector is u at y_cv
+     The solution vector is u at ycv
      */
     lower.assign(numPoints-1,0.0);
     upper.assign(numPoints-1,0.0);
@@ -198,29 +292,21 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     /* Internal cvs
      */
     for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  mu_fa[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = mu_fa[i] / (y_cv[i] -  y_cv[i - 1] );
+      upper[i]  =  mu_fa[i + 1] / (ycv[i + 1] -  ycv[i] );
+      lower[i-1]  = mu_fa[i] / (ycv[i] -  ycv[i - 1] );
       diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
     }
 
     /* Wall BC
      */
-    upper[0] = mu_fa[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + mu_fa[0]/(y_cv[0]-y_fa[0]) );
+    upper[0] = mu_fa[1]/(ycv[1] - ycv[0]);
+    diagonal[0] = -1.0 * (upper[0] + mu_fa[0]/(ycv[0]-yfa[0]) );
     rhs[0] = 0.0;
 
     /* Solve the matrix problem to get the velocity field
        - rhs returns the solution
     */
-#if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    int info, nrhs = 1;
-
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
-#else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
-#endif
+    SolveTridiagonal(lower, diagonal, upper, rhs);
 
     u = rhs;
 
@@ -233,20 +319,20 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     }
     /* Update tauWall
      */
-    tauWall = mu_fa[0] * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
+    tauWall = mu_fa[0] * (u[0] - 0.0)/(ycv[0]-yfa[0]);
     for(unsigned short i=1; i < nfa; ++i){
       rho = pExchange / (R*T[i]);
       nu = mu_fa[i] / rho;
       utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
+      y_plus = yfa[i] * utau / nu;
       D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * karman * y_fa[i] * utau * D;
+      mut = rho * karman * yfa[i] * utau * D;
       mu_fa[i] += mut;
       tmp[i] += mut/Pr_turb;
     }
 
     /* Energy matrix
-     The Solution vector is Enthalpy at y_cv
+     The Solution vector is Enthalpy at ycv
      */
     lower.assign(numPoints-1,0.0);
     upper.assign(numPoints-1,0.0);
@@ -256,8 +342,8 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     /* Internal cvs
      */
     for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  tmp[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = tmp[i] / (y_cv[i] -  y_cv[i - 1] );
+      upper[i]  =  tmp[i + 1] / (ycv[i + 1] -  ycv[i] );
+      lower[i-1]  = tmp[i] / (ycv[i] -  ycv[i - 1] );
       diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
     }
 
@@ -267,9 +353,9 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
 
     /* Wall BC
      */
-    upper[0] = tmp[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + tmp[0]/(y_cv[0]-y_fa[0]) );
-    aux_rhs = tmp[0]/(y_cv[0]-y_fa[0]);
+    upper[0] = tmp[1]/(ycv[1] - ycv[0]);
+    diagonal[0] = -1.0 * (upper[0] + tmp[0]/(ycv[0]-yfa[0]) );
+    aux_rhs = tmp[0]/(ycv[0]-yfa[0]);
 
     /* RHS of the Energy equation
        - Compute flux -- (mu + mu_t) * u * du/dy --
@@ -279,7 +365,7 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
      */
     tmp[0] = 0. ;
     for (unsigned short i=1; i < numPoints; ++i){
-      tmp[i] = 0.5* (mu_fa[i]) * (u[i] + u[i-1]) * (u[i] -u[i-1])/(y_cv[i] -  y_cv[i - 1] )  ;
+      tmp[i] = 0.5* (mu_fa[i]) * (u[i] + u[i-1]) * (u[i] -u[i-1])/(ycv[i] -  ycv[i - 1] )  ;
     }
     for (unsigned short i=0; i < (numPoints - 1); ++i){
       rhs[i] = -tmp[i+1] + tmp[i];
@@ -295,13 +381,7 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
 
     /* Solve the matrix problem to get the Enthalpy field
      */
-#if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
-#else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
-#endif
+    SolveTridiagonal(lower, diagonal, upper, rhs);
 
     /* Get Temperature from enthalpy
       - Temperature will be at face
@@ -318,8 +398,8 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
 
     /* These quantities will be returned.
      */
-    tauWall = mu_lam * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
-    qWall = mu_lam * (c_p / Pr_lam) * -(T[1] - T[0]) / (y_fa[1]-y_fa[0]);
+    tauWall = mu_lam * (u[0] - 0.0)/(ycv[0]-yfa[0]);
+    qWall = mu_lam * (c_p / Pr_lam) * -(T[1] - T[0]) / (yfa[1]-yfa[0]);
     ViscosityWall = mu_lam;
     //kOverCvWall = c_p / c_v * (mu[0]/Pr_lam + muTurb[0]/Pr_turb);
     kOverCvWall = c_p / c_v * (mu_lam/Pr_lam);
@@ -327,7 +407,7 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     /* Final check of the Y+
      */
     rho = pExchange / (R * T[0]);
-    if (y_cv[0] * sqrt(tauWall/rho) / (mu_lam/rho) > 1.0)
+    if (ycv[0] * sqrt(tauWall/rho) / (mu_lam/rho) > 1.0)
       SU2_MPI::Error("Y+ greater than one: Increase the number of points or growth ratio.", CURRENT_FUNCTION);
 
     /* Define a norm
@@ -364,6 +444,45 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
                                                   su2double       &ViscosityWall,
                                                   su2double       &kOverCvWall) {
 
+  /* Start from the default guess of the friction velocity. */
+  tauWall = 0.0;
+
+  SolveLogLaw(h_wm, tExchange, velExchange, pExchange, Wall_HeatFlux, Wall_Temperature, Temperature_Prescribed,
+              FluidModel, tauWall, qWall, ViscosityWall, kOverCvWall);
+}
+
+void CWallModelLogLaw::WallShearStressAndHeatFlux_FVM(const su2double hExchange,
+                                                      const su2double tExchange,
+                                                      const su2double velExchange,
+                                                      const su2double muExchange,
+                                                      const su2double pExchange,
+                                                      const su2double Wall_HeatFlux,
+                                                      const bool      HeatFlux_Prescribed,
+                                                      const su2double Wall_Temperature,
+                                                      const bool      Temperature_Prescribed,
+                                                      CFluidModel     *FluidModel,
+                                                      su2double       &tauWall,
+                                                      su2double       &qWall,
+                                                      su2double       &ViscosityWall,
+                                                      su2double       &kOverCvWall) const {
+
+  SolveLogLaw(hExchange, tExchange, velExchange, pExchange, Wall_HeatFlux, Wall_Temperature, Temperature_Prescribed,
+              FluidModel, tauWall, qWall, ViscosityWall, kOverCvWall);
+}
+
+void CWallModelLogLaw::SolveLogLaw(const su2double hExchange,
+                                   const su2double tExchange,
+                                   const su2double velExchange,
+                                   const su2double pExchange,
+                                   const su2double Wall_HeatFlux,
+                                   const su2double Wall_Temperature,
+                                   const bool      Temperature_Prescribed,
+                                   CFluidModel     *FluidModel,
+                                   su2double       &tauWall,
+                                   su2double       &qWall,
+                                   su2double       &ViscosityWall,
+                                   su2double       &kOverCvWall) const {
+
   /* Set the wall temperature, depending whether or not the temperature
      was prescribed and initialize the fluid model. */
   const su2double TWall = Temperature_Prescribed ? Wall_Temperature : tExchange;
@@ -377,8 +496,8 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
   const su2double c_v      = FluidModel->GetCv();
   const su2double nu_wall  = mu_wall / rho_wall;
 
-  /* Initial guess of the friction velocity. */
-  su2double u_tau = max(0.01*velExchange, 1.e-5);
+  /* Initial guess of the friction velocity, the previous value if tauWall is positive. */
+  su2double u_tau = (tauWall > 0.0) ? sqrt(tauWall/rho_wall) : max(0.01*velExchange, 1.e-5);
 
   /* Set parameters for control of the Newton iteration. */
   bool converged = false;
@@ -391,7 +510,7 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
     if (iter == max_iter) converged = true;
 
     const su2double u_tau0 = u_tau;
-    const su2double y_plus = u_tau0*h_wm/nu_wall;
+    const su2double y_plus = u_tau0*hExchange/nu_wall;
 
     /* Reichardt boundary layer analytical law
        fprime is the differentiation of the Reichardt law with repect to u_tau.
@@ -399,10 +518,10 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
     const su2double fval = velExchange/u_tau0 - ((C - log(karman)/karman)*(1.0 - exp(-y_plus/11.0)
                          - (y_plus/11.0)*exp(-0.33*y_plus))) - log(karman*y_plus + 1.0)/karman;
     const su2double fprime = -velExchange/pow(u_tau0,2.0)
-                           + (- C + log(karman)/karman)*(-(1.0/11.0)*h_wm*exp(-0.33*y_plus)/nu_wall
-                           +                              (1.0/11.0)*h_wm*exp(-(1.0/11.0)*y_plus)/nu_wall
-                           +                              (1.0/33.0)*u_tau0*pow(h_wm,2.0)*exp(-0.33*y_plus)/pow(nu_wall, 2.0))
-                           - 1.0*h_wm/(nu_wall*(karman*y_plus + 1.0));
+                           + (- C + log(karman)/karman)*(-(1.0/11.0)*hExchange*exp(-0.33*y_plus)/nu_wall
+                           +                              (1.0/11.0)*hExchange*exp(-(1.0/11.0)*y_plus)/nu_wall
+                           +                              (1.0/33.0)*u_tau0*pow(hExchange,2.0)*exp(-0.33*y_plus)/pow(nu_wall, 2.0))
+                           - 1.0*hExchange/(nu_wall*(karman*y_plus + 1.0));
 
     /* Newton method
      */
@@ -419,7 +538,7 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
   if (Temperature_Prescribed){
     /* The Kader's law will be used to approximate the variations of the temperature inside the boundary layer.
      */
-    const su2double y_plus = u_tau*h_wm/nu_wall;
+    const su2double y_plus = u_tau*hExchange/nu_wall;
     const su2double lhs = - ((tExchange - TWall) * rho_wall * c_p * u_tau);
     const su2double Gamma = - (0.01 * (Pr_lam * pow(y_plus,4.0))/(1.0 + 5.0*y_plus*pow(Pr_lam,3.0)));
     const su2double rhs_1 = Pr_lam * y_plus * exp(Gamma);
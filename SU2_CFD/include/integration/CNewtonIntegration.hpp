@@ -43,6 +43,74 @@
 #define END_CNEWTON_PARFOR
 #endif
 
+/*!
+ * \class CPreconditionerLagging
+ * \ingroup Drivers
+ * \brief Decides when the preconditioner of CNewtonIntegration is rebuilt (NEWTON_KRYLOV_PRECOND_LAG).
+ * \note The convergence rates are only measured in Krylov (FGMRES) solves, solves where the preconditioner
+ *       is the linear solver (startup period) reset the statistics, so that the reference rate is always
+ *       the one of the first Krylov solve after a rebuild.
+ */
+class CPreconditionerLagging {
+private:
+  unsigned short maxAge = 1;        /*!< \brief Maximum number of solves with the same preconditioner. */
+  unsigned short maxLinIters = 0;   /*!< \brief Rebuild if the last solve needed more iterations (0 = off). */
+  passivedouble rateFactor = 0.0;   /*!< \brief Rebuild if the rate drops below this fraction of the reference. */
+  unsigned short age = 0;           /*!< \brief Number of solves since the last rebuild (0 = never built). */
+  unsigned long lastLinIters = 0;   /*!< \brief Iterations of the last solve. */
+  passivedouble lastRate = 0.0;     /*!< \brief log10 of the residual drop per iteration of the last solve. */
+  passivedouble refRate = 0.0;      /*!< \brief Rate of the first solve after the last rebuild. */
+
+public:
+  /*!
+   * \brief Whether a preconditioner can be lagged, i.e. everything it uses is computed by its Build method.
+   * \note LU_SGS (compressed blocks), the linelets, and AMG (coarse levels) combine data computed when they are
+   *       built with the current matrix, lagging them would apply an inconsistent operator.
+   */
+  static bool CanLag(ENUM_LINEAR_SOLVER_PREC kind) {
+    return (kind != LU_SGS) && (kind != LINELET) && (kind != LINELET_ILU) && (kind != AMG);
+  }
+
+  /*!
+   * \brief Set the parameters of the policy.
+   * \param[in] kind - Type of preconditioner, the ones that cannot be lagged are rebuilt for every solve.
+   */
+  void Setup(ENUM_LINEAR_SOLVER_PREC kind, unsigned short maxAge_, unsigned short maxLinIters_,
+             passivedouble rateFactor_) {
+    maxAge = CanLag(kind) ? std::max<unsigned short>(1, maxAge_) : 1;
+    maxLinIters = maxLinIters_;
+    rateFactor = rateFactor_;
+  }
+
+  /*!
+   * \brief Whether the preconditioner must be rebuilt before the next solve.
+   */
+  bool IsStale() const {
+    if (age == 0 || age >= maxAge) return true;
+    if (maxLinIters > 0 && lastLinIters > maxLinIters) return true;
+    /*--- The rates are log10 of the residual drop per iteration (negative), the closer to 0 the worse. ---*/
+    return (rateFactor > 0.0) && (lastRate > rateFactor * refRate);
+  }
+
+  /*!
+   * \brief Update the statistics after a solve.
+   * \param[in] rebuilt - If the preconditioner was rebuilt before the solve.
+   * \param[in] krylov - If the solve was a Krylov solve (false for the startup period).
+   * \param[in] linIters - Number of iterations of the solve.
+   * \param[in] linResidual - Relative residual at the end of the solve.
+   */
+  void Update(bool rebuilt, bool krylov, unsigned long linIters, passivedouble linResidual) {
+    if (!krylov) {
+      age = 0;
+      return;
+    }
+    age = rebuilt ? 1 : age + 1;
+    lastLinIters = linIters;
+    lastRate = (linIters > 0 && linResidual > 0.0) ? log10(linResidual) / linIters : 0.0;
+    if (rebuilt) refRate = lastRate;
+  }
+};
+
 /*!
  * \class CNewtonIntegration
  * \ingroup Drivers
@@ -63,10 +131,12 @@ public:
 #endif
 
 private:
-  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built. ---*/
-  enum class ResEvalType {EXPLICIT, DEFAULT};
+  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built,
+   * frozen for lightweight products that do not update gradients, limiters, and sensors. ---*/
+  enum class ResEvalType {EXPLICIT, FROZEN, DEFAULT};
 
   bool setup = false;
+  bool frozenProducts = false;
   Scalar finDiffStepND = 0.0;
   Scalar finDiffStep = 0.0; /*!< \brief Based on RMS(solution), used in matrix-free products. */
   unsigned long omp_chunk_size; /*!< \brief Chunk size used in light point loops. */
@@ -90,6 +160,11 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- The factorization of the preconditioner can be reused (lagged) for a number of
+   * iterations, it is rebuilt earlier if the linear solver needs too many iterations or
+   * if its convergence rate degrades too much relative to the rate after the rebuild. ---*/
+  CPreconditionerLagging precondLagging;
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -710,6 +710,12 @@ public:
    */
   virtual void SetCrossDiff(su2double val_CDkw_i) {/* empty */};
 
+  /*!
+   * \brief Set the length scale of the hybrid RANS/LES modes of the SST-based models.
+   * \param[in] val_lengthScale_i - Value of the DES length scale at point i.
+   */
+  virtual void SetDES_LengthScale(su2double val_lengthScale_i) {/* empty */};
+
   /*!
    * \brief Set the value of the effective intermittency for the LM model.
    * \param[in] intermittency_eff_i - Value of the effective intermittency at point i.
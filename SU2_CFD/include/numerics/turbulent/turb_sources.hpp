@@ -596,6 +596,8 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
   const su2double kAmb, omegaAmb;
 
   su2double F1_i, F2_i, CDkw_i;
+  su2double lengthScale_i = 0.0; /*!< \brief Length scale of the hybrid RANS/LES modes. */
+  const bool hybridRANSLES;
   su2double Residual[2];
   su2double* Jacobian_i[2];
   su2double Jacobian_Buffer[4];  /// Static storage for the Jacobian (which needs to be pointer for return type).
@@ -676,7 +678,8 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
         alfa_2(constants[9]),
         prod_lim_const(constants[10]),
         kAmb(val_kine_Inf),
-        omegaAmb(val_omega_Inf) {
+        omegaAmb(val_omega_Inf),
+        hybridRANSLES(config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
     /*--- "Allocate" the Jacobian using the static buffer. ---*/
     Jacobian_i[0] = Jacobian_Buffer;
     Jacobian_i[1] = Jacobian_Buffer + 2;
@@ -707,6 +710,14 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
     CDkw_i = val_CDkw_i;
   }
 
+  /*!
+   * \brief Set the length scale of the hybrid RANS/LES modes.
+   * \param[in] val_lengthScale_i - Value of the DES length scale at point i.
+   */
+  inline void SetDES_LengthScale(su2double val_lengthScale_i) override {
+    lengthScale_i = val_lengthScale_i;
+  }
+
   /*!
    * \brief Residual for source term integration.
    * \param[in] config - Definition of the particular problem.
@@ -722,6 +733,7 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
     AD::SetPreaccIn(F1_i);
     AD::SetPreaccIn(F2_i);
     AD::SetPreaccIn(CDkw_i);
+    AD::SetPreaccIn(lengthScale_i);
     AD::SetPreaccIn(PrimVar_Grad_i, nDim + idx.Velocity(), nDim);
     AD::SetPreaccIn(Vorticity_i, 3);
     AD::SetPreaccIn(V_i[idx.Density()], V_i[idx.LaminarViscosity()], V_i[idx.EddyViscosity()]);
@@ -825,7 +837,12 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
 
       /*--- Dissipation ---*/
 
-      su2double dk = beta_star * Density_i * ScalarVar_i[1] * ScalarVar_i[0];
+      /*--- Hybrid RANS/LES, the dissipation of k is rho * k^(3/2) / l_DES, i.e. the RANS dissipation
+       *    scaled by the ratio of the RANS (k^(1/2) / (beta_star * omega)) and DES length scales. ---*/
+      const su2double F_DES = hybridRANSLES ?
+          sqrt(ScalarVar_i[0]) / (beta_star * ScalarVar_i[1] * max(lengthScale_i, EPS)) : 1.0;
+
+      su2double dk = F_DES * beta_star * Density_i * ScalarVar_i[1] * ScalarVar_i[0];
       su2double dw = beta_blended * Density_i * ScalarVar_i[1] * ScalarVar_i[1];
 
       /*--- LM model coupling with production and dissipation term for k transport equation---*/
@@ -854,8 +871,8 @@ class CSourcePieceWise_TurbSST final : public CNumerics {
 
       /*--- Implicit part ---*/
 
-      Jacobian_i[0][0] = -beta_star * ScalarVar_i[1] * Volume;
-      Jacobian_i[0][1] = -beta_star * ScalarVar_i[0] * Volume;
+      Jacobian_i[0][0] = -F_DES * beta_star * ScalarVar_i[1] * Volume;
+      Jacobian_i[0][1] = -F_DES * beta_star * ScalarVar_i[0] * Volume;
       Jacobian_i[1][0] = 0.0;
       Jacobian_i[1][1] = -2.0 * beta_blended * ScalarVar_i[1] * Volume;
     }
@@ -887,6 +904,8 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
   const su2double kAmb, omegaAmb;
 
   su2double F1_i, F2_i, CDkw_i;
+  su2double lengthScale_i = 0.0; /*!< \brief Length scale of the hybrid RANS/LES modes. */
+  const bool hybridRANSLES;
   su2double Residual[2];
   su2double* Jacobian_i[2];
   su2double Jacobian_Buffer[4];  /// Static storage for the Jacobian (which needs to be pointer for return type).
@@ -967,7 +986,8 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
         alfa_2(constants[9]),
         prod_lim_const(constants[10]),
         kAmb(val_kine_Inf),
-        omegaAmb(val_omega_Inf) {
+        omegaAmb(val_omega_Inf),
+        hybridRANSLES(config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
     /*--- "Allocate" the Jacobian using the static buffer. ---*/
     Jacobian_i[0] = Jacobian_Buffer;
     Jacobian_i[1] = Jacobian_Buffer + 2;
@@ -998,6 +1018,14 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
     CDkw_i = val_CDkw_i;
   }
 
+  /*!
+   * \brief Set the length scale of the hybrid RANS/LES modes.
+   * \param[in] val_lengthScale_i - Value of the DES length scale at point i.
+   */
+  inline void SetDES_LengthScale(su2double val_lengthScale_i) override {
+    lengthScale_i = val_lengthScale_i;
+  }
+
   /*!
    * \brief Residual for source term integration.
    * \param[in] config - Definition of the particular problem.
@@ -1013,6 +1041,7 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
     AD::SetPreaccIn(F1_i);
     AD::SetPreaccIn(F2_i);
     AD::SetPreaccIn(CDkw_i);
+    AD::SetPreaccIn(lengthScale_i);
     AD::SetPreaccIn(PrimVar_Grad_i, nDim + idx.Velocity(), nDim);
     AD::SetPreaccIn(Vorticity_i, 3);
     AD::SetPreaccIn(V_i[idx.Density()], V_i[idx.LaminarViscosity()], V_i[idx.EddyViscosity()]);
@@ -1084,7 +1113,12 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
 
       /*--- Dissipation ---*/
 
-      su2double dk = beta_star * Density_i * ScalarVar_i[1] * ScalarVar_i[0];
+      /*--- Hybrid RANS/LES, the dissipation of k is rho * k^(3/2) / l_DES, i.e. the RANS dissipation
+       *    scaled by the ratio of the RANS (k^(1/2) / (beta_star * omega)) and DES length scales. ---*/
+      const su2double F_DES = hybridRANSLES ?
+          sqrt(ScalarVar_i[0]) / (beta_star * ScalarVar_i[1] * max(lengthScale_i, EPS)) : 1.0;
+
+      su2double dk = F_DES * beta_star * Density_i * ScalarVar_i[1] * ScalarVar_i[0];
       su2double dw = beta_blended * Density_i * ScalarVar_i[1] * ScalarVar_i[1];
 
       /*--- LM model coupling with production and dissipation term for k transport equation---*/
@@ -1113,8 +1147,8 @@ class CSourcePieceWise_TurbKW final : public CNumerics {
 
       /*--- Implicit part ---*/
 
-      Jacobian_i[0][0] = -beta_star * ScalarVar_i[1] * Volume;
-      Jacobian_i[0][1] = -beta_star * ScalarVar_i[0] * Volume;
+      Jacobian_i[0][0] = -F_DES * beta_star * ScalarVar_i[1] * Volume;
+      Jacobian_i[0][1] = -F_DES * beta_star * ScalarVar_i[0] * Volume;
       Jacobian_i[1][0] = 0.0;
       Jacobian_i[1][1] = -2.0 * beta_blended * ScalarVar_i[1] * Volume;
     }
@@ -29,8 +29,15 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/turb_fluxes.hpp"
+#include "scalar/species_fluxes.hpp"
+#include "scalar/turb_sources.hpp"
+#include "../solvers/CSolver.hpp"
 
 namespace {
 
@@ -44,6 +51,17 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -58,6 +76,22 @@ CNumericsSIMD* createUpwindGeneralNumerics(const CConfig& config, int iMesh, con
   return nullptr;
 }
 
+/*!
+ * \brief Upwind factory implementation for incompressible flow.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createUpwindIncNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_Upwind_Flow()) {
+    case UPWIND::FDS:
+      obj = new CFDSIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Centered factory implementation.
  */
@@ -92,6 +126,15 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
 
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) return nullptr;
+
+    if (config.GetViscous())
+      return createUpwindIncNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+    else
+      return createUpwindIncNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+  }
+
   switch (config.GetKind_ConvNumScheme_Flow()) {
     case SPACE_UPWIND:
       if (config.GetViscous()) {
@@ -126,6 +169,100 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Create a scalar convection-diffusion scheme.
+ */
+template<class PrimVarType, class Model>
+CNumericsSIMD* newScalarScheme(const CConfig& config, const Model& model, const CFlowVariable& flowVars,
+                               const su2activevector* massFluxes) {
+  return new CScalarEdgeScheme<PrimVarType, Model>(config, model, flowVars, massFluxes);
+}
+
+/*!
+ * \brief Scalar factory implementation.
+ */
+template<class PrimVarType>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, int nVar, int scalarSolver, const CFlowVariable& flowVars,
+                                    const su2activevector* massFluxes, const su2double* constants) {
+  using P = PrimVarType;
+
+  if (scalarSolver == TURB_SOL) {
+    switch (config.GetKind_Turb_Model()) {
+      case TURB_MODEL::SA:
+        if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+          return newScalarScheme<P>(config, CSADiffusion<true>(), flowVars, massFluxes);
+        return newScalarScheme<P>(config, CSADiffusion<false>(), flowVars, massFluxes);
+      case TURB_MODEL::SST:
+      case TURB_MODEL::KW:
+        return newScalarScheme<P>(config, CKOmegaDiffusion(constants), flowVars, massFluxes);
+      default:
+        break;
+    }
+  }
+  else if (scalarSolver == SPECIES_SOL) {
+    /*--- The number of species is a template parameter, other sizes use the non-vectorized numerics. ---*/
+    switch (nVar) {
+      case 1: return newScalarScheme<P>(config, CSpeciesDiffusion<1>(config), flowVars, massFluxes);
+      case 2: return newScalarScheme<P>(config, CSpeciesDiffusion<2>(config), flowVars, massFluxes);
+      case 3: return newScalarScheme<P>(config, CSpeciesDiffusion<3>(config), flowVars, massFluxes);
+      case 4: return newScalarScheme<P>(config, CSpeciesDiffusion<4>(config), flowVars, massFluxes);
+      default: break;
+    }
+  }
+  return nullptr;
+}
+
+/*!
+ * \brief SA source factory implementation, instantiates the ft2 variants.
+ */
+template<class PrimVarType, SA_OPTIONS Version>
+CSourceSIMD* newSASource(const CConfig& config, const CFlowVariable& flowVars) {
+  if (config.GetSAParsedOptions().ft2)
+    return new CSASourceScheme<PrimVarType, Version, true>(config, flowVars);
+  return new CSASourceScheme<PrimVarType, Version, false>(config, flowVars);
+}
+
+/*!
+ * \brief Turbulence source factory implementation.
+ */
+template<class PrimVarType>
+CSourceSIMD* createTurbSource(const CConfig& config, const CSolver* turbSolver, const CFlowVariable& flowVars) {
+  using P = PrimVarType;
+  const bool hybrid = (config.GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA: {
+      const auto options = config.GetSAParsedOptions();
+      if (options.comp || options.bc || hybrid) break;
+      switch (options.version) {
+        case SA_OPTIONS::NONE: return newSASource<P, SA_OPTIONS::NONE>(config, flowVars);
+        case SA_OPTIONS::NEG: return newSASource<P, SA_OPTIONS::NEG>(config, flowVars);
+        case SA_OPTIONS::EDW: return newSASource<P, SA_OPTIONS::EDW>(config, flowVars);
+        default: break;
+      }
+      break;
+    }
+    case TURB_MODEL::SST: {
+      const auto options = config.GetSSTParsedOptions();
+      if (options.production == SST_OPTIONS::UQ || config.GetAxisymmetric()) break;
+      return new CKOmegaSourceScheme<P>(turbSolver->GetConstants(), turbSolver->GetTke_Inf(),
+                                        turbSolver->GetOmega_Inf(), options.version == SST_OPTIONS::V1994,
+                                        options.production, options.sust, hybrid, flowVars);
+    }
+    case TURB_MODEL::KW: {
+      if (config.GetAxisymmetric()) break;
+      /*--- Same as CSourcePieceWise_TurbKW, which uses the default options. ---*/
+      const KW_ParsedOptions options;
+      return new CKOmegaSourceScheme<P>(turbSolver->GetConstants(), turbSolver->GetTke_Inf(),
+                                        turbSolver->GetOmega_Inf(), options.version == KW_OPTIONS::V1988,
+                                        SST_OPTIONS::NONE, false, hybrid, flowVars);
+    }
+    default:
+      break;
+  }
+  return nullptr;
+}
+
 } // namespace
 
 /*!
@@ -145,3 +282,59 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, int nVar, int scalarSolver,
+                                                   const CSolver* const* solvers) {
+  if (!config.GetUseVectorization() || config.GetNEMOProblem() || !solvers[FLOW_SOL] || !solvers[scalarSolver])
+    return nullptr;
+
+  const bool bounded = (scalarSolver == TURB_SOL) ? config.GetBounded_Turb() : config.GetBounded_Species();
+  const auto* massFluxes = bounded ? solvers[FLOW_SOL]->GetEdgeMassFluxes() : nullptr;
+  if (bounded && !massFluxes) return nullptr;
+
+  const auto* constants = solvers[scalarSolver]->GetConstants();
+  const bool komega = (config.GetKind_Turb_Model() == TURB_MODEL::SST) || (config.GetKind_Turb_Model() == TURB_MODEL::KW);
+  if (scalarSolver == TURB_SOL && komega && !constants) return nullptr;
+
+  const auto& flowVars = *su2staticcast_p<const CFlowVariable*>(solvers[FLOW_SOL]->GetNodes());
+  const bool incompressible = (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
+
+  /*--- The primitives are read up to the eddy viscosity. ---*/
+  if (nDim == 2) {
+    if (incompressible)
+      return createScalarNumerics<CIncompressiblePrimitives<2,9> >(config, nVar, scalarSolver, flowVars, massFluxes, constants);
+    return createScalarNumerics<CCompressiblePrimitives<2,9> >(config, nVar, scalarSolver, flowVars, massFluxes, constants);
+  }
+  if (nDim == 3) {
+    if (incompressible)
+      return createScalarNumerics<CIncompressiblePrimitives<3,10> >(config, nVar, scalarSolver, flowVars, massFluxes, constants);
+    return createScalarNumerics<CCompressiblePrimitives<3,10> >(config, nVar, scalarSolver, flowVars, massFluxes, constants);
+  }
+  return nullptr;
+}
+
+CSourceSIMD* CSourceSIMD::CreateTurbSource(const CConfig& config, int nDim, const CSolver* const* solvers) {
+  if (!config.GetUseVectorization() || config.GetNEMOProblem() || !solvers[FLOW_SOL] || !solvers[TURB_SOL])
+    return nullptr;
+
+  /*--- The coupling with the transition models is not vectorized. ---*/
+  if (config.GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) return nullptr;
+
+  const auto* turbSolver = solvers[TURB_SOL];
+  const bool komega = (config.GetKind_Turb_Model() == TURB_MODEL::SST) || (config.GetKind_Turb_Model() == TURB_MODEL::KW);
+  if (komega && !turbSolver->GetConstants()) return nullptr;
+
+  const auto& flowVars = *su2staticcast_p<const CFlowVariable*>(solvers[FLOW_SOL]->GetNodes());
+  const bool incompressible = (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE);
+
+  /*--- The primitives are read up to the eddy viscosity. ---*/
+  if (nDim == 2) {
+    if (incompressible) return createTurbSource<CIncompressiblePrimitives<2,9> >(config, turbSolver, flowVars);
+    return createTurbSource<CCompressiblePrimitives<2,9> >(config, turbSolver, flowVars);
+  }
+  if (nDim == 3) {
+    if (incompressible) return createTurbSource<CIncompressiblePrimitives<3,10> >(config, turbSolver, flowVars);
+    return createTurbSource<CCompressiblePrimitives<3,10> >(config, turbSolver, flowVars);
+  }
+  return nullptr;
+}
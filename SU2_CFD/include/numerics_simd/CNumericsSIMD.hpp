@@ -49,6 +49,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CSolver;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -97,4 +98,58 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the convection-diffusion fluxes of scalar solvers.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] nVar - Number of scalar variables.
+   * \param[in] scalarSolver - Position of the scalar solver in the container (TURB_SOL or SPECIES_SOL).
+   * \param[in] solvers - Solver container, the flow solver provides the primitives and the mass fluxes.
+   * \return nullptr if vectorization is not requested (USE_VECTORIZATION), or if the model or
+   *         the options in use are not supported.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, int nVar, int scalarSolver,
+                                             const CSolver* const* solvers);
+
+};
+
+/*!
+ * \class CSourceSIMD
+ * \ingroup SourceDiscr
+ * \brief Base class to define the interface of pointwise source terms, evaluated for groups of points.
+ */
+class CSourceSIMD {
+public:
+  /*!
+   * \brief Interface for the source term computation.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (which are subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal blocks).
+   * \note The update mask is used to handle "remainder" points (nPointDomain mod simdSize).
+   */
+  virtual void ComputeResidual(Int iPoint,
+                               const CConfig& config,
+                               const CGeometry& geometry,
+                               const CVariable& solution,
+                               Double updateMask,
+                               CSysVector<su2double>& vector,
+                               SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CSourceSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the production, destruction and cross-diffusion of the turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] solvers - Solver container, the flow solver provides the primitives and their gradients.
+   * \return nullptr if vectorization is not requested (USE_VECTORIZATION), or if the model or
+   *         the options in use are not supported.
+   */
+  static CSourceSIMD* CreateTurbSource(const CConfig& config, int nDim, const CSolver* const* solvers);
+
 };
@@ -0,0 +1,522 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM+up(2) and SLAU(2) convective schemes.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Derivatives of a face quantity w.r.t. the conservative variables of one side of the face,
+ * given the derivatives w.r.t. velocity, pressure, density, and enthalpy (in that order), ideal gas.
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE VectorDbl<nDim+2> primitiveToConservativeDerivatives(Double gamma,
+                                                                  const PrimVarType& V,
+                                                                  const VectorDbl<nDim+3>& dX_dV) {
+  const Double oneOnRho = 1 / V.density();
+  const Double sqVel = squaredNorm<nDim>(V.velocity());
+  const Double dH_dRho = 0.5*(gamma-2)*sqVel - gamma*V.pressure()/((gamma-1)*V.density());
+  const Double dX_dp = dX_dV(nDim);
+  const Double dX_dH = dX_dV(nDim+2);
+
+  VectorDbl<nDim+2> dX_dU;
+  dX_dU(0) = 0.5*(gamma-1)*sqVel*dX_dp + dX_dV(nDim+1) + dH_dRho*oneOnRho*dX_dH;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dX_dU(0) -= V.velocity(iDim)*oneOnRho*dX_dV(iDim);
+    dX_dU(iDim+1) = oneOnRho*dX_dV(iDim) - (gamma-1)*V.velocity(iDim)*(dX_dp + oneOnRho*dX_dH);
+  }
+  dX_dU(nDim+1) = (gamma-1)*dX_dp + gamma*oneOnRho*dX_dH;
+  return dX_dU;
+}
+
+/*!
+ * \class CAUSMBase
+ * \ingroup ConvDiscr
+ * \brief Base class for schemes in the AUSM+up and SLAU family, i.e. with fluxes of the form
+ * F = A (0.5 mdot (psi_i+psi_j) - 0.5 |mdot| (psi_i-psi_j) + N p), psi = [1, u, H].
+ * Derived classes implement the face mass flux (mdot) and pressure (p) in a const
+ * "massAndPressureFluxes" method, which must only depend on the variables passed to it.
+ * \note See CRoeBase for the role of Base. The Jacobians are either approximated by
+ * the Roe ones, or computed by differentiating mdot and p numerically (accurate Jacobians).
+ */
+template<class Derived, class Base>
+class CAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+  const bool accurateJacobian;
+  const su2double finDiffStep = 1e-4;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    accurateJacobian(config.GetUse_Accurate_Jacobians()) {
+    if (config.GetDynamic_Grid() && (SU2_MPI::GetRank() == MASTER_NODE))
+      cout << "WARNING: Grid velocities are NOT yet considered in AUSM-type schemes." << endl;
+  }
+
+  /*!
+   * \brief Scaling of the pressure dissipation, derived classes can hide this method.
+   */
+  FORCEINLINE Double dissipationCoefficient(Int, Int, const CEulerVariable&) const { return 1.0; }
+
+  /*!
+   * \brief Jacobians approximated by those of the Roe scheme.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void approximateJacobians(const CPair<PrimVarType>& V,
+                                        const VectorDbl<nDim>& normal,
+                                        Double area,
+                                        const VectorDbl<nDim>& unitNormal,
+                                        MatrixDbl<nVar>& jac_i,
+                                        MatrixDbl<nVar>& jac_j) const {
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    const auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    const auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                                    roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), energy_i, normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), energy_j, normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        jac_i(iVar,jVar) += 0.5 * projModJacTensor * area;
+        jac_j(iVar,jVar) -= 0.5 * projModJacTensor * area;
+      }
+    }
+  }
+
+  /*!
+   * \brief Jacobians from the derivatives of mdot and p w.r.t. the primitive variables
+   * (forward finite differences), assuming phi = |mdot|.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobians(const CPair<PrimVarType>& V,
+                                     const VectorDbl<nDim>& normal,
+                                     Double area,
+                                     const VectorDbl<nDim>& unitNormal,
+                                     Double dissipation,
+                                     Double mdot,
+                                     Double pressure,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+
+    /*--- Perturb velocity, pressure, density, and enthalpy (1 to nDim+3 in the primitives). ---*/
+
+    VectorDbl<nDim+3> dmdot_dVi, dmdot_dVj, dpres_dVi, dpres_dVj;
+    auto Vp = V;
+
+    for (size_t iVar = 0; iVar < nDim+3; ++iVar) {
+      Double mdot_p, pressure_p;
+
+      const Double eps_i = finDiffStep * fmax(1.0, abs(V.i.all(iVar+1)));
+      Vp.i.all(iVar+1) += eps_i;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVi(iVar) = (mdot_p - mdot) / eps_i;
+      dpres_dVi(iVar) = (pressure_p - pressure) / eps_i;
+      Vp.i.all(iVar+1) = V.i.all(iVar+1);
+
+      const Double eps_j = finDiffStep * fmax(1.0, abs(V.j.all(iVar+1)));
+      Vp.j.all(iVar+1) += eps_j;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dVj(iVar) = (mdot_p - mdot) / eps_j;
+      dpres_dVj(iVar) = (pressure_p - pressure) / eps_j;
+      Vp.j.all(iVar+1) = V.j.all(iVar+1);
+    }
+
+    /*--- Chain rule to obtain the derivatives w.r.t. the conservatives. ---*/
+
+    const auto dmdot_dUi = primitiveToConservativeDerivatives<nDim>(gamma, V.i, dmdot_dVi);
+    const auto dmdot_dUj = primitiveToConservativeDerivatives<nDim>(gamma, V.j, dmdot_dVj);
+    const auto dpres_dUi = primitiveToConservativeDerivatives<nDim>(gamma, V.i, dpres_dVi);
+    const auto dpres_dUj = primitiveToConservativeDerivatives<nDim>(gamma, V.j, dpres_dVj);
+
+    /*--- Upwind side, psi_hat = area * psi_upwind. ---*/
+
+    const Double upw_i = mdot > 0.0;
+    const Double upw_j = 1 - upw_i;
+    const Double mdotHat = area * mdot * (upw_i / V.i.density() + upw_j / V.j.density());
+
+    VectorDbl<nVar> psiHat;
+    psiHat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psiHat(iDim+1) = area * (upw_i * V.i.velocity(iDim) + upw_j * V.j.velocity(iDim));
+    }
+    psiHat(nVar-1) = area * (upw_i * V.i.enthalpy() + upw_j * V.j.enthalpy());
+
+    /*--- Contributions from the mass flux and pressure derivatives. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psiHat(iVar) * dmdot_dUi(jVar);
+        jac_j(iVar,jVar) = psiHat(iVar) * dmdot_dUj(jVar);
+      }
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dUi(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dUj(jVar);
+      }
+    }
+
+    /*--- Contributions from the derivatives of psi (only on the upwind side). ---*/
+
+    auto psiTerms = [&](const Double& weight, const PrimVarType& Vk, MatrixDbl<nVar>& jac) {
+      const Double scale = weight * mdotHat;
+      const Double dH_dRho = 0.5*(gamma-2)*squaredNorm<nDim>(Vk.velocity()) -
+                             gamma*Vk.pressure()/((gamma-1)*Vk.density());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac(iDim+1,0) -= scale * Vk.velocity(iDim);
+        jac(iDim+1,iDim+1) += scale;
+        jac(nVar-1,iDim+1) -= scale * (gamma-1) * Vk.velocity(iDim);
+      }
+      jac(nVar-1,0) += scale * dH_dRho;
+      jac(nVar-1,nVar-1) += scale * gamma;
+    };
+    psiTerms(upw_i, V.i, jac_i);
+    psiTerms(upw_j, V.j, jac_j);
+  }
+
+public:
+  /*!
+   * \brief Implementation of the base AUSM flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Mass and pressure fluxes, computed in derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    const Double dissipation = derived->dissipationCoefficient(iPoint, jPoint, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    /*--- Assemble the flux. ---*/
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5 * mdot * (V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                             0.5 * absMdot * (V.i.velocity(iDim) - V.j.velocity(iDim)) +
+                             unitNormal(iDim) * pressure);
+    }
+    flux(nVar-1) = area * (0.5 * mdot * (V.i.enthalpy() + V.j.enthalpy()) +
+                           0.5 * absMdot * (V.i.enthalpy() - V.j.enthalpy()));
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (accurateJacobian) {
+        accurateJacobians(V, normal, area, unitNormal, dissipation, mdot, pressure, jac_i, jac_j);
+      } else {
+        approximateJacobians(V, normal, area, unitNormal, jac_i, jac_j);
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up and AUSM+up2 schemes (Liou 2006, Kitamura & Shima 2013).
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CAUSMBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+  const bool up2;
+  const su2double Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()),
+    up2(config.GetKind_Upwind_Flow() == UPWIND::AUSMPLUSUP2) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up(2) requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    /*--- Projected velocities. ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = pow(astarL,2) / fmax(astarL, projVel_i);
+    const Double ahatR = pow(astarR,2) / fmax(astarR, -projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right Mach numbers, and split Mach and pressure functions. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0 * (-4 + 5*fa*fa);
+    const passivedouble beta = 1.0/8.0;
+
+    const Double subsonicL = abs(mL) <= 1.0;
+    const Double p1L = 0.25*pow(mL+1,2);
+    const Double p2L = pow(mL*mL-1,2);
+    const Double mLP = subsonicL * (p1L + beta*p2L) + (1-subsonicL) * 0.5*(mL + abs(mL));
+    const Double betaLP = subsonicL * (p1L*(2-mL) + alpha*mL*p2L) + (1-subsonicL) * (mL > 0.0);
+
+    const Double subsonicR = abs(mR) <= 1.0;
+    const Double p1R = 0.25*pow(mR-1,2);
+    const Double p2R = pow(mR*mR-1,2);
+    const Double mRM = subsonicR * (-p1R - beta*p2R) + (1-subsonicR) * 0.5*(mR - abs(mR));
+    const Double betaRM = subsonicR * (p1R*(2+mR) - alpha*mR*p2R) + (1-subsonicR) * (mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa) * fmax(1-sigma*MFsq, 0.0) * (V.j.pressure()-V.i.pressure()) / (rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+
+    /*--- Pressure flux, with velocity diffusion term (up) or modified (up2). ---*/
+
+    if (!up2) {
+      const Double Pu = -Ku*fa*betaLP*betaRM*2*rhoF*aF*(projVel_j-projVel_i);
+      pressure = betaLP*V.i.pressure() + betaRM*V.j.pressure() + Pu;
+    }
+    else {
+      const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(betaLP-betaRM)*(V.i.pressure()-V.j.pressure()) +
+                 sqrt(sqVel)*(betaLP+betaRM-1)*rhoF*aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU and SLAU2 schemes (Shima & Kitamura 2011, Kitamura & Shima 2013).
+ */
+template<class Decorator>
+class CSLAUScheme : public CAUSMBase<CSLAUScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMBase<CSLAUScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const bool slau2;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    slau2(config.GetKind_Upwind_Flow() == UPWIND::SLAU2),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Low dissipation coefficient (same as for Roe).
+   */
+  FORCEINLINE Double dissipationCoefficient(Int iPoint, Int jPoint, const CEulerVariable& solution) const {
+    return roeDissipation(iPoint, jPoint, typeDissip, solution);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    /*--- Projected velocities and speed of sound. ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double sqVelMean = sqrt(0.5*(sqVel_i + sqVel_j));
+    const Double machTilde = fmin(1.0, sqVelMean / aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double absVel_i = abs(projVel_i);
+    const Double absVel_j = abs(projVel_j);
+    const Double vnMag = (V.i.density()*absVel_i + V.j.density()*absVel_j) / (V.i.density() + V.j.density());
+    const Double vnMagL = (1-fRho)*vnMag + fRho*absVel_i;
+    const Double vnMagR = (1-fRho)*vnMag + fRho*absVel_j;
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density()*(projVel_i+vnMagL) + V.j.density()*(projVel_j-vnMagR) -
+                  (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subsonicL = abs(mL) < 1.0;
+    const Double betaL = subsonicL * 0.25*(2-mL)*pow(mL+1,2) + (1-subsonicL) * (mL >= 0.0);
+
+    const Double subsonicR = abs(mR) < 1.0;
+    const Double betaR = subsonicR * 0.25*(2+mR)*pow(mR-1,2) + (1-subsonicR) * (mR < 0.0);
+
+    const Double sumPressure = V.i.pressure() + V.j.pressure();
+
+    pressure = 0.5*sumPressure + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!slau2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*sumPressure;
+    }
+    else {
+      pressure += dissipation*sqVelMean*(betaL+betaR-1)*aF*0.5*(V.i.density()+V.j.density());
+    }
+  }
+};
@@ -0,0 +1,451 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting scheme for incompressible flow (preconditioned Roe).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Retrieve incompressible primitive variables for points i/j, reconstructing them if needed.
+ * \note Only the first nVarRecon variables (pressure, velocity, temperature, density, beta) are
+ * reconstructed, the remaining ones are copied. The pressure is the dynamic pressure (it can
+ * be negative), therefore only temperature and density are checked for non-physical values,
+ * and only if the energy equation is solved.
+ */
+template<size_t nVarRecon, class PrimVarType, size_t nDim, class VariableType>
+FORCEINLINE CPair<PrimVarType> reconstructIncPrimitives(Int iEdge, Int iPoint, Int jPoint,
+                                                        bool muscl, LIMITER limiterType, bool checkRecon,
+                                                        const CPair<PrimVarType>& V1st,
+                                                        const VectorDbl<nDim>& vector_ij,
+                                                        const VariableType& solution) {
+  using ReconVarType = CIncompressiblePrimitives<nDim,nVarRecon>;
+  static_assert(ReconVarType::nVar <= PrimVarType::nVar,"");
+
+  CPair<PrimVarType> V = V1st;
+  if (!muscl) return V;
+
+  const auto& gradients = solution.GetGradient_Reconstruction();
+  const auto& limiters = solution.GetLimiter_Primitive();
+
+  CPair<ReconVarType> VRecon;
+
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    VRecon.i.all(iVar) = V1st.i.all(iVar);
+    VRecon.j.all(iVar) = V1st.j.all(iVar);
+  }
+
+  switch (limiterType) {
+  case LIMITER::NONE:
+    musclUnlimited(iPoint, vector_ij, 0.5, gradients, VRecon.i.all);
+    musclUnlimited(jPoint, vector_ij,-0.5, gradients, VRecon.j.all);
+    break;
+  case LIMITER::VAN_ALBADA_EDGE:
+    musclEdgeLimited(iPoint, jPoint, vector_ij, gradients, VRecon);
+    break;
+  default:
+    musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, VRecon.i.all);
+    musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, VRecon.j.all);
+    break;
+  }
+
+  Double bad_recon = 0.0;
+  if (checkRecon) {
+    /*--- Detect a non-physical reconstruction based on negative temperature or density. ---*/
+    bad_recon = fmax(fmin(VRecon.i.temperature(), VRecon.j.temperature()) < 0.0,
+                     fmin(VRecon.i.density(), VRecon.j.density()) < 0.0);
+    /*--- Handle SIMD dimensions 1 by 1. ---*/
+    for (size_t k = 0; k < Double::Size; ++k) {
+      bad_recon[k] = solution.UpdateNonPhysicalEdgeCounter(iEdge[k], bad_recon[k]);
+    }
+  }
+
+  /*--- Revert to first order if the state is non-physical. ---*/
+  for (size_t iVar = 0; iVar < ReconVarType::nVar; ++iVar) {
+    V.i.all(iVar) = bad_recon * V1st.i.all(iVar) + (1-bad_recon) * VRecon.i.all(iVar);
+    V.j.all(iVar) = bad_recon * V1st.j.all(iVar) + (1-bad_recon) * VRecon.j.all(iVar);
+  }
+  return V;
+}
+
+/*!
+ * \brief Convective projected (onto normal) flux (incompressible flow).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE VectorDbl<nDim+2> inviscidIncProjFlux(const PrimVarType& V,
+                                                  const VectorDbl<nDim>& normal) {
+  const Double mdot = V.density() * dot<nDim>(V.velocity(), normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*V.velocity(iDim) + normal(iDim)*V.pressure();
+  }
+  flux(nDim+1) = mdot * V.cp() * V.temperature();
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the convective flux w.r.t. the primitive variables (incompressible flow).
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> inviscidIncProjJac(const PrimVarType& V,
+                                                 Double dRhodT,
+                                                 const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  MatrixDbl<nDim+2> jac;
+
+  const Double projVel = dot<nDim>(V.velocity(), normal);
+  const Double qOnBeta = projVel / V.betaInc2();
+  const Double enthalpy = V.cp() * V.temperature();
+
+  jac(0,0) = scale * qOnBeta;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(0,jDim+1) = scale * normal(jDim) * V.density();
+  }
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(iDim+1,0) = scale * (normal(iDim) + V.velocity(iDim)*qOnBeta);
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * normal(jDim) * V.density() * V.velocity(iDim);
+    }
+    jac(iDim+1,iDim+1) += scale * V.density() * projVel;
+    jac(iDim+1,nDim+1) = scale * dRhodT * V.velocity(iDim) * projVel;
+  }
+
+  jac(nDim+1,0) = scale * enthalpy * qOnBeta;
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    jac(nDim+1,jDim+1) = scale * enthalpy * normal(jDim) * V.density();
+  }
+  jac(nDim+1,nDim+1) = scale * V.cp() * (V.temperature()*dRhodT + V.density()) * projVel;
+
+  return jac;
+}
+
+/*!
+ * \brief Compute and return the (low speed) preconditioning matrix, dU/dV.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(Double density, const VectorDbl<nDim>& velocity,
+                                                Double betaInc2, Double cp, Double temperature,
+                                                Double dRhodT) {
+  MatrixDbl<nDim+2> precon;
+
+  precon(0,0) = 1 / betaInc2;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = velocity(iDim) / betaInc2;
+  }
+  precon(nDim+1,0) = cp * temperature / betaInc2;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precon(0,jDim+1) = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      precon(iDim+1,jDim+1) = 0.0;
+    }
+    precon(jDim+1,jDim+1) = density;
+    precon(nDim+1,jDim+1) = 0.0;
+  }
+
+  precon(0,nDim+1) = dRhodT;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,nDim+1) = velocity(iDim) * dRhodT;
+  }
+  precon(nDim+1,nDim+1) = cp * (dRhodT*temperature + density);
+
+  return precon;
+}
+
+/*!
+ * \brief Compute and return |A_precon| = P x |Lambda| x inv(P), where P diagonalizes
+ * the matrix inv(Precon) x dF/dV and Lambda is the diagonal matrix of its eigenvalues.
+ * \note Same as CNumerics::GetPreconditionedProjJac.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density, const VectorDbl<nDim+2>& lambda,
+                                                       Double betaInc2, const VectorDbl<nDim>& normal) {
+  MatrixDbl<nDim+2> precA;
+
+  const Double sqrtBeta = sqrt(betaInc2);
+  const Double sumLambda = lambda(nDim) + lambda(nDim+1);
+  const Double diffLambda = lambda(nDim+1) - lambda(nDim);
+
+  precA(0,0) = 0.5 * sumLambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precA(iDim+1,0) = normal(iDim) * diffLambda / (2*sqrtBeta*density);
+  }
+  precA(nDim+1,0) = 0.0;
+
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    precA(0,jDim+1) = 0.5 * sqrtBeta * normal(jDim) * density * diffLambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      if (iDim == jDim) {
+        precA(iDim+1,jDim+1) = 0.5 * sumLambda * normal(iDim) * normal(iDim);
+        for (size_t kDim = 0; kDim < nDim; ++kDim) {
+          if (kDim != iDim) precA(iDim+1,jDim+1) += 2 * lambda(0) * normal(kDim) * normal(kDim);
+        }
+      }
+      else {
+        precA(iDim+1,jDim+1) = 0.5 * normal(iDim) * normal(jDim) * (sumLambda - 2*lambda(0));
+      }
+    }
+    precA(nDim+1,jDim+1) = 0.0;
+  }
+
+  for (size_t iVar = 0; iVar < nDim+1; ++iVar) {
+    precA(iVar,nDim+1) = 0.0;
+  }
+  precA(nDim+1,nDim+1) = lambda(nDim-1);
+
+  return precA;
+}
+
+/*!
+ * \class CFDSIncScheme
+ * \ingroup ConvDiscr
+ * \brief Flux difference splitting (preconditioned Roe) scheme for incompressible flow,
+ * the vectorized counterpart of CUpwFDSInc_Flow. The dissipation and the Jacobians are
+ * w.r.t. the primitive variables (pressure, velocity, temperature).
+ * A base class implementing "viscousTerms" is accepted as template parameter.
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+  const bool variableDensity;
+  const bool energy;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    variableDensity(config.GetKind_DensityModel() == INC_DENSITYMODEL::VARIABLE),
+    energy(config.GetEnergy_Equation()) {
+  }
+
+  /*!
+   * \brief Implementation of the FDS flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal, precNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+      /*--- The eigenvectors of the preconditioned system are singular for zero components. ---*/
+      const Double small = abs(unitNormal(iDim)) < EPS;
+      precNormal(iDim) = small * EPS + (1-small) * unitNormal(iDim);
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructIncPrimitives<nPrimVarGrad>(iEdge, iPoint, jPoint, muscl, typeLimiter,
+                                                    energy, V1st, vector_ij, solution);
+
+    /*--- Mean variables. ---*/
+
+    const Double density = 0.5 * (V.i.density() + V.j.density());
+    const Double betaInc2 = 0.5 * (V.i.betaInc2() + V.j.betaInc2());
+    const Double cp = 0.5 * (V.i.cp() + V.j.cp());
+    const Double temperature = 0.5 * (V.i.temperature() + V.j.temperature());
+    VectorDbl<nDim> velocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velocity(iDim) = 0.5 * (V.i.velocity(iDim) + V.j.velocity(iDim));
+    }
+    Double projVel = dot(velocity, normal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+      projVel -= projGridVel;
+    }
+
+    /*--- Artificial sound speed based on the eigenvalues of the preconditioned system. ---*/
+
+    const Double soundSpeed = sqrt(betaInc2) * area;
+
+    /*--- Derivative of the equation of state (ideal gas law for now). ---*/
+
+    Double dRhodT = 0.0, dRhodT_i = 0.0, dRhodT_j = 0.0;
+    if (variableDensity) {
+      dRhodT = -density / temperature;
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+    }
+
+    /*--- Absolute value of the eigenvalues of the preconditioned system. ---*/
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(projVel);
+    }
+    lambda(nDim) = abs(projVel - soundSpeed);
+    lambda(nDim+1) = abs(projVel + soundSpeed);
+
+    /*--- Precon x |A_precon|. ---*/
+
+    const auto precon = incPreconditioner(density, velocity, betaInc2, cp, temperature, dRhodT);
+    const auto precA = incPreconditionedProjJac(density, lambda, betaInc2, precNormal);
+
+    /*--- Inviscid fluxes and Jacobians. ---*/
+
+    auto flux_i = inviscidIncProjFlux(V.i, normal);
+    auto flux_j = inviscidIncProjFlux(V.j, normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidIncProjJac(V.i, dRhodT_i, normal, 0.5);
+      jac_j = inviscidIncProjJac(V.j, dRhodT_j, normal, 0.5);
+    }
+
+    /*--- Difference of primitive variables at jPoint and iPoint. ---*/
+
+    VectorDbl<nVar> deltaV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      deltaV(iVar) = V.j.all(iVar) - V.i.all(iVar);
+    }
+
+    /*--- Dissipation terms. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double dDdV = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dDdV += precon(iVar,kVar) * precA(kVar,jVar);
+        }
+        dDdV *= 0.5;
+
+        flux(iVar) -= dDdV * deltaV(jVar);
+
+        if (implicit) {
+          jac_i(iVar,jVar) += dDdV;
+          jac_j(iVar,jVar) -= dDdV;
+        }
+      }
+    }
+
+    /*--- Correct for grid motion. ---*/
+
+    if (dynamicGrid) {
+      const Double halfGridVel = 0.5 * projGridVel;
+      flux(0) -= halfGridVel * (V.i.density() + V.j.density());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        flux(iDim+1) -= halfGridVel * (V.i.density()*V.i.velocity(iDim) + V.j.density()*V.j.velocity(iDim));
+      }
+      flux(nDim+1) -= halfGridVel * (V.i.density()*V.i.cp()*V.i.temperature() +
+                                     V.j.density()*V.j.cp()*V.j.temperature());
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= halfGridVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= halfGridVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= halfGridVel * V.i.density() * V.i.cp();
+        jac_j(nDim+1,nDim+1) -= halfGridVel * V.j.density() * V.j.cp();
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Decouple the energy equation if it is not solved. ---*/
+
+    if (!energy) {
+      flux(nDim+1) = 0.0;
+      if (implicit) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac_i(iVar,nDim+1) = 0.0;
+          jac_j(iVar,nDim+1) = 0.0;
+          jac_i(nDim+1,iVar) = 0.0;
+          jac_j(nDim+1,iVar) = 0.0;
+        }
+      }
+    }
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
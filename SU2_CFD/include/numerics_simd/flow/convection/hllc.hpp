@@ -0,0 +1,327 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Jacobian of the HLLC star flux w.r.t. the conservatives of one side (k) of the face.
+ * \param[in] V - Primitives of side k.
+ * \param[in] sign - 1 for i, -1 for j.
+ * \param[in] waveSpeed - sL for i, sR for j.
+ * \param[in] dpStarScale - Factor to obtain dpStar from dSm.
+ * \param[in] upwind - 1 if the star state is that of side k, 0 otherwise.
+ * \param[in] sM - Speed of the contact surface.
+ * \param[in] rhoDiff - Denominator of sM.
+ * \param[in] omega - 1 / (s - sM) of the star state side.
+ * \param[in] starState - Conservative variables of the star state.
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE MatrixDbl<nDim+2> hllcStarJacobian(Double gamma,
+                                               const PrimVarType& V,
+                                               passivedouble sign,
+                                               Double waveSpeed,
+                                               Double dpStarScale,
+                                               Double upwind,
+                                               Double sM,
+                                               Double rhoDiff,
+                                               Double omega,
+                                               Double pStar,
+                                               const VectorDbl<nDim+2>& starState,
+                                               const VectorDbl<nDim>& unitNormal) {
+  constexpr size_t nVar = nDim+2;
+  const Double projVel = dot(V.velocity(), unitNormal);
+  const Double omegaSM = omega * sM;
+  const Double eStarPlusPStar = starState(nVar-1) + pStar;
+
+  /*--- Pressure derivatives. ---*/
+
+  VectorDbl<nVar> dPI_dU;
+  dPI_dU(0) = 0.5 * (gamma-1) * squaredNorm<nDim>(V.velocity());
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dPI_dU(iDim+1) = -(gamma-1) * V.velocity(iDim);
+  }
+  dPI_dU(nVar-1) = gamma-1;
+
+  /*--- Derivatives of the contact speed, star pressure, and star energy. ---*/
+
+  VectorDbl<nVar> dSm_dU, dpStar_dU, dEStar_dU, drhoStar_dU;
+  dSm_dU(0) = (-projVel*projVel + sM*waveSpeed + dPI_dU(0)) * sign / rhoDiff;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dSm_dU(iDim+1) = (unitNormal(iDim)*(2*projVel - waveSpeed - sM) + dPI_dU(iDim+1)) * sign / rhoDiff;
+  }
+  dSm_dU(nVar-1) = dPI_dU(nVar-1) * sign / rhoDiff;
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    dpStar_dU(iVar) = dpStarScale * dSm_dU(iVar);
+    dEStar_dU(iVar) = omega * (sM * dpStar_dU(iVar) + eStarPlusPStar * dSm_dU(iVar));
+    drhoStar_dU(iVar) = omega * starState(0) * dSm_dU(iVar);
+  }
+
+  /*--- Terms that only exist on the side of the star state. ---*/
+
+  const Double upwOmega = upwind * omega;
+  dEStar_dU(0) += upwOmega * projVel * (V.enthalpy() - dPI_dU(0));
+  drhoStar_dU(0) += upwOmega * waveSpeed;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dEStar_dU(iDim+1) += upwOmega * (-unitNormal(iDim)*V.enthalpy() - projVel*dPI_dU(iDim+1));
+    drhoStar_dU(iDim+1) -= upwOmega * unitNormal(iDim);
+  }
+  dEStar_dU(nVar-1) += upwOmega * (waveSpeed - projVel - projVel*dPI_dU(nVar-1));
+
+  /*--- Assemble. ---*/
+
+  MatrixDbl<nVar> jac;
+  const Double upwOmegaSM = upwind * omegaSM;
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac(0,iVar) = sM * drhoStar_dU(iVar) + starState(0) * dSm_dU(iVar);
+  }
+  for (size_t jDim = 0; jDim < nDim; ++jDim) {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac(jDim+1,iVar) = (omegaSM + 1) * (unitNormal(jDim)*dpStar_dU(iVar) + starState(jDim+1)*dSm_dU(iVar)) -
+                         upwOmegaSM * dPI_dU(iVar) * unitNormal(jDim);
+    }
+    jac(jDim+1,0) += upwOmegaSM * V.velocity(jDim) * projVel;
+    jac(jDim+1,jDim+1) += upwOmegaSM * (waveSpeed - projVel);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(jDim+1,iDim+1) -= upwOmegaSM * V.velocity(jDim) * unitNormal(iDim);
+    }
+  }
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac(nVar-1,iVar) = sM * (dEStar_dU(iVar) + dpStar_dU(iVar)) + eStarPlusPStar * dSm_dU(iVar);
+  }
+  return jac;
+}
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (Toro et al. 1994, Batten et al. 1997), ideal gas.
+ * \note The branches of the scalar implementation (CUpwHLLC_Flow) are evaluated for the
+ * upwind side of the contact surface, and blended for supersonic/subsonic faces.
+ * See CRoeBase for the role of Base.
+ */
+template<class Base>
+class CHLLCScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+
+    /*--- Speed of sound and projected velocities (relative to the grid). ---*/
+
+    Double soundSpeed_i = sqrt((V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity())) * (gamma-1));
+    Double soundSpeed_j = sqrt((V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity())) * (gamma-1));
+
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      soundSpeed_i -= projGridVel;
+      soundSpeed_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averaged variables. ---*/
+
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSoundSpeed = roeAvg.speedSound - projGridVel;
+
+    /*--- Wave speeds, speed of the contact surface, and pressure of the star states. ---*/
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    const Double rhoDiff = V.j.density()*(sR - projVel_j) - V.i.density()*(sL - projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL - projVel_i) +
+                       V.j.density()*projVel_j*(sR - projVel_j)) / rhoDiff;
+
+    const Double pStar = V.j.density()*(projVel_j - sR)*(projVel_j - sM) + V.j.pressure();
+
+    /*--- Select the upwind side (a) of the contact surface, and whether the face is supersonic. ---*/
+
+    const Double upw_i = sM > 0.0;
+    const Double upw_j = 1 - upw_i;
+    const Double supersonic = upw_i * (sL > 0.0) + upw_j * (sR < 0.0);
+
+    const Double s_a = upw_i * sL + upw_j * sR;
+    const Double projVel_a = upw_i * projVel_i + upw_j * projVel_j;
+    const Double density_a = upw_i * V.i.density() + upw_j * V.j.density();
+    const Double pressure_a = upw_i * V.i.pressure() + upw_j * V.j.pressure();
+    const Double energy_a = upw_i * energy_i + upw_j * energy_j;
+    const Double enthalpy_a = upw_i * V.i.enthalpy() + upw_j * V.j.enthalpy();
+
+    /*--- Star state of the upwind side. ---*/
+
+    const Double omega = 1 / (s_a - sM);
+    const Double rhoStar = (s_a - projVel_a) * omega;
+    const Double oneOnDeltaS = 1 / (s_a - projVel_a);
+
+    VectorDbl<nVar> starState;
+    starState(0) = rhoStar * density_a;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double velocity_a = upw_i * V.i.velocity(iDim) + upw_j * V.j.velocity(iDim);
+      starState(iDim+1) = rhoStar * (density_a*velocity_a + (pStar - pressure_a)*oneOnDeltaS*unitNormal(iDim));
+    }
+    starState(nVar-1) = rhoStar * (density_a*energy_a - (pressure_a*projVel_a - pStar*sM)*oneOnDeltaS);
+
+    /*--- Blend the fluxes of the upwind state and of the star state. ---*/
+
+    VectorDbl<nVar> flux;
+    const Double massFlux_a = density_a * projVel_a;
+    flux(0) = supersonic * massFlux_a + (1-supersonic) * sM * starState(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double velocity_a = upw_i * V.i.velocity(iDim) + upw_j * V.j.velocity(iDim);
+      flux(iDim+1) = supersonic * (massFlux_a*velocity_a + pressure_a*unitNormal(iDim)) +
+                     (1-supersonic) * (sM*starState(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nVar-1) = supersonic * enthalpy_a * massFlux_a +
+                   (1-supersonic) * (sM*(starState(nVar-1) + pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians, scaled by kappa as in the scalar implementation. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const auto jacStar_i = hllcStarJacobian<nDim>(gamma, V.i, 1, sL, V.i.density()*(sR - projVel_j),
+                                                    upw_i, sM, rhoDiff, omega, pStar, starState, unitNormal);
+      const auto jacStar_j = hllcStarJacobian<nDim>(gamma, V.j, -1, sR, V.j.density()*(sL - projVel_i),
+                                                    upw_j, sM, rhoDiff, omega, pStar, starState, unitNormal);
+
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), energy_i, unitNormal, 1.0);
+      jac_j = inviscidProjJac(gamma, V.j.velocity(), energy_j, unitNormal, 1.0);
+
+      const Double scale = kappa * area;
+      const Double supersonic_i = scale * supersonic * upw_i;
+      const Double supersonic_j = scale * supersonic * upw_j;
+      const Double subsonic = scale * (1-supersonic);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) = supersonic_i * jac_i(iVar,jVar) + subsonic * jacStar_i(iVar,jVar);
+          jac_j(iVar,jVar) = supersonic_j * jac_j(iVar,jVar) + subsonic * jacStar_j(iVar,jVar);
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
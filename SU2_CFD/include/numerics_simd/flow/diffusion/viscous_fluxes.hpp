@@ -31,6 +31,7 @@
 #include "../../util.hpp"
 #include "../variables.hpp"
 #include "common.hpp"
+#include "../../../variables/CIncNSVariable.hpp"
 
 /*!
  * \class CNoViscousFlux
@@ -371,3 +372,146 @@ public:
     return dEdU;
   }
 };
+
+/*!
+ * \class CIncompressibleViscousFlux
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add viscous fluxes (incompressible flow), vectorized
+ * counterpart of CAvgGradInc_Flow. The Jacobians are w.r.t. the primitive variables
+ * (pressure, velocity, temperature), consistent with the preconditioned convective schemes.
+ */
+template<size_t NDIM>
+class CIncompressibleViscousFlux : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nPrimVar = NDIM+7;
+  static constexpr size_t nPrimVarGrad = nDim+2;
+
+  const bool correct;
+  const bool useSA_QCR;
+  const bool wallFun;
+  const bool uq;
+  const bool uq_permute;
+  const size_t uq_eigval_comp;
+  const su2double uq_delta_b;
+  const su2double uq_urlx;
+
+  const CVariable* turbVars;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  template<class... Ts>
+  CIncompressibleViscousFlux(const CConfig& config, int iMesh,
+                             const CVariable* turbVars_, Ts&...) :
+    correct(iMesh == MESH_0),
+    useSA_QCR(config.GetSAParsedOptions().qcr2000),
+    wallFun(config.GetWall_Functions()),
+    uq(config.GetSSTParsedOptions().uq),
+    uq_permute(config.GetUQ_Permute()),
+    uq_eigval_comp(config.GetEig_Val_Comp()),
+    uq_delta_b(config.GetUQ_Delta_B()),
+    uq_urlx(config.GetUQ_URLX()),
+    turbVars(turbVars_) {
+  }
+
+  /*!
+   * \brief Add viscous contributions to flux and jacobians.
+   */
+  template<class PrimVarType, size_t nVar>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const PrimVarType& avgV,
+                                const CPair<PrimVarType>& V,
+                                const CVariable& solution_,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CGeometry& geometry,
+                                const CConfig& config,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    static_assert(PrimVarType::nVar >= nPrimVar,"");
+    static_assert(nVar == nPrimVarGrad,"");
+
+    const auto& solution = static_cast<const CIncNSVariable&>(solution_);
+    const auto& gradient = solution.GetGradient_Primitive();
+
+    /*--- Compute distance and handle zero without "ifs" by making it large. ---*/
+
+    auto dist2_ij = squaredNorm(vector_ij);
+    Double mask = dist2_ij < EPS*EPS;
+    dist2_ij += mask / (EPS*EPS);
+
+    /*--- Compute the corrected mean gradient (pressure, velocity, temperature). ---*/
+
+    auto avgGrad = averageGradient<nPrimVarGrad,nDim>(iPoint, jPoint, gradient);
+    if(correct) correctGradient(V, vector_ij, dist2_ij, avgGrad);
+
+    /*--- Stress tensor. ---*/
+
+    auto tau = stressTensor(avgV.laminarVisc() + (uq? Double(0.0) : avgV.eddyVisc()), avgGrad);
+    if(useSA_QCR) addQCR(avgGrad, tau);
+    if(uq) {
+      Double turb_ke = 0.5*(gatherVariables(iPoint, turbVars->GetSolution()) +
+                            gatherVariables(jPoint, turbVars->GetSolution()));
+      addPerturbedRSM(avgV, avgGrad, turb_ke, tau,
+                      uq_eigval_comp, uq_permute, uq_delta_b, uq_urlx);
+    }
+
+    if(wallFun) addTauWall(iPoint, jPoint, solution.GetTau_Wall(), unitNormal, tau);
+
+    /*--- Projected flux, the conductivity already includes the turbulent part. ---*/
+
+    const Double cond = avgV.thermalCond();
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) -= area * dot(tau[iDim], unitNormal);
+    }
+    flux(nDim+1) -= area * cond * dot(avgGrad[nDim+1], unitNormal);
+
+    if (!implicit) return;
+
+    /*--- Flux Jacobians (QCR and wall functions are not accounted for). ---*/
+
+    const Double xi = (avgV.laminarVisc() + avgV.eddyVisc()) / sqrt(dist2_ij);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        const Double dtau = -area * xi * unitNormal(iDim) * unitNormal(jDim) / 3.0;
+        jac_i(iDim+1,jDim+1) -= dtau;
+        jac_j(iDim+1,jDim+1) += dtau;
+      }
+      jac_i(iDim+1,iDim+1) += area * xi;
+      jac_j(iDim+1,iDim+1) -= area * xi;
+    }
+
+    /*--- Temperature equation. ---*/
+
+    const Double dqdT = area * cond * dot(vector_ij, unitNormal) / dist2_ij;
+    jac_i(nDim+1,nDim+1) += dqdT;
+    jac_j(nDim+1,nDim+1) -= dqdT;
+  }
+
+  /*!
+   * \overload Average primitives if not provided yet.
+   */
+  template<class PrimVarType, class... Ts>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const CPair<PrimVarType>& V,
+                                Ts&... args) const {
+    PrimVarType avgV;
+    for (size_t iVar = 0; iVar < PrimVarType::nVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+
+    /*--- Continue calculation. ---*/
+    viscousTerms(iEdge, iPoint, jPoint, avgV, V, args...);
+  }
+};
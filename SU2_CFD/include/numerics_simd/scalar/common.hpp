@@ -0,0 +1,273 @@
+/*!
+ * \file common.hpp
+ * \brief Common convection-diffusion edge scheme of the scalar transport equations.
+ * \author P. Gomes
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../flow/variables.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../variables/CFlowVariable.hpp"
+
+/*!
+ * \brief Type to store the variables of a scalar transport solver (turbulence, species).
+ */
+template<size_t nVar_>
+struct CScalarVariables {
+  static constexpr size_t nVar = nVar_;
+  VectorDbl<nVar> all;
+};
+
+/*!
+ * \brief Diagonal entry of a block.
+ * \note The containers of a single variable (e.g. SA) only have vector accessors, hence the flat indexing
+ *       used here and in the functions below.
+ */
+template<size_t nVar>
+FORCEINLINE Double& diagonal(MatrixDbl<nVar>& block, size_t iVar) { return block.data()[iVar*(nVar+1)]; }
+
+/*!
+ * \brief Reconstruction of the scalars, with optional point-based limiter.
+ */
+template<size_t nVar, size_t nDim, class Gradient_t, class Limiter_t>
+FORCEINLINE void musclScalars(Int iPoint,
+                              const VectorDbl<nDim>& vector_ij,
+                              Double scale,
+                              const Gradient_t& gradient,
+                              const Limiter_t* limiter,
+                              VectorDbl<nVar>& vars) {
+  const auto grad = gatherVariables<nVar,nDim>(iPoint, gradient);
+  VectorDbl<nVar> lim;
+  if (limiter) lim = gatherVariables<nVar>(iPoint, *limiter);
+  else lim = Double(1.0);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double proj = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      proj += grad.data()[iVar*nDim+iDim] * vector_ij(iDim);
+    }
+    vars(iVar) += lim(iVar) * scale * proj;
+  }
+}
+
+/*!
+ * \brief Projection of the average gradient on the normal, corrected with the directional derivative,
+ *        see CNumerics::ComputeProjectedGradient.
+ */
+template<size_t nVar, size_t nDim, class Gradient_t, class ScalarVarType>
+FORCEINLINE VectorDbl<nVar> projectedGradient(Int iPoint, Int jPoint,
+                                              const Gradient_t& gradient,
+                                              const CPair<ScalarVarType>& U,
+                                              const VectorDbl<nDim>& vector_ij,
+                                              const VectorDbl<nDim>& normal,
+                                              Double proj_vector_ij) {
+  const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+  const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+
+  VectorDbl<nVar> projGrad;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double projNormal = 0.0, projEdge = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      const Double meanGrad = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+      projNormal += meanGrad * normal(iDim);
+      projEdge += meanGrad * vector_ij(iDim);
+    }
+    projGrad(iVar) = projNormal - (projEdge - (U.j.all(iVar) - U.i.all(iVar))) * proj_vector_ij;
+  }
+  return projGrad;
+}
+
+/*!
+ * \class CScalarEdgeScheme
+ * \ingroup ConvDiscr
+ * \brief Scalar upwind convection plus diffusion (averaged and corrected gradient) of transported scalars.
+ * \note Vectorized version of the CUpwScalar and CAvgGrad_Scalar classes, the model specific parts of the
+ *       diffusion flux (and whether the convected quantity is multiplied by density) are in the Model class.
+ *       The primitive variables (i.e. the velocity) are read from the flow variables, in bounded scalar
+ *       mode the edge mass fluxes of the flow solver are used instead.
+ */
+template<class PrimVarType, class Model>
+class CScalarEdgeScheme : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = PrimVarType::nDim;
+  static constexpr size_t nVar = Model::nVar;
+  static constexpr size_t nPrimVar = PrimVarType::nVar;
+  /*--- Velocity and density are the only reconstructed flow variables that are needed. ---*/
+  static constexpr size_t nPrimVarRecon = nDim+3;
+
+  const Model model;
+  const CFlowVariable& flowVars;
+  const su2activevector* edgeMassFluxes;
+  const bool dynamicGrid;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and the flow variables.
+   * \param[in] config - Problem definitions.
+   * \param[in] model_ - Model specific part of the fluxes.
+   * \param[in] flowVars_ - Variables of the flow solver.
+   * \param[in] edgeMassFluxes_ - Mass fluxes of the flow solver, only for bounded scalar.
+   */
+  CScalarEdgeScheme(const CConfig& config, const Model& model_, const CFlowVariable& flowVars_,
+                    const su2activevector* edgeMassFluxes_) :
+    model(model_),
+    flowVars(flowVars_),
+    edgeMassFluxes(edgeMassFluxes_),
+    dynamicGrid(config.GetDynamic_Grid()) {
+  }
+
+  /*!
+   * \brief Implementation of the edge flux.
+   * \note The solver specific options (MUSCL, limiter, time integration) are read from the
+   *       config on each call, they are set in CFluidIteration before calling the solver.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+    const bool musclFlow = muscl && !edgeMassFluxes && config.GetMUSCL_Flow() &&
+                           (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+    const bool limiterFlow = (config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                             (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE);
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const Double dist2_ij = fmax(squaredNorm(vector_ij), EPS);
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow and scalar variables without reconstruction. ---*/
+
+    CPair<PrimVarType> V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, flowVars.GetPrimitive());
+
+    CPair<CScalarVariables<nVar> > U;
+    U.i.all = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    U.j.all = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstructed velocity and density. ---*/
+
+    CPair<VectorDbl<nPrimVarRecon> > flowRecon;
+    for (size_t iVar = 0; iVar < nPrimVarRecon; ++iVar) {
+      flowRecon.i(iVar) = V.i.all(iVar);
+      flowRecon.j(iVar) = V.j.all(iVar);
+    }
+    if (musclFlow) {
+      const auto& gradients = flowVars.GetGradient_Reconstruction();
+      if (limiterFlow) {
+        const auto& limiters = flowVars.GetLimiter_Primitive();
+        musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, flowRecon.i);
+        musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, flowRecon.j);
+      } else {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, flowRecon.i);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, flowRecon.j);
+      }
+    }
+    const auto density_i = flowRecon.i(nDim+2);
+    const auto density_j = flowRecon.j(nDim+2);
+
+    /*--- Reconstructed scalars. ---*/
+
+    auto UR = U;
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+      const auto* limiters = limiter ? &solution.GetLimiter() : nullptr;
+      musclScalars(iPoint, vector_ij, 0.5, gradients, limiters, UR.i.all);
+      musclScalars(jPoint, vector_ij,-0.5, gradients, limiters, UR.j.all);
+    }
+
+    /*--- Upwind convection, a0 and a1 are the "outgoing" and "incoming" fluxes. ---*/
+
+    Double a0, a1;
+    if (edgeMassFluxes) {
+      const Double massFlux = gatherVariables(iEdge, *edgeMassFluxes);
+      a0 = fmax(0.0, massFlux) / density_i;
+      a1 = fmin(0.0, massFlux) / density_j;
+    } else {
+      Double projVel = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        projVel += 0.5 * (flowRecon.i(iDim+1) + flowRecon.j(iDim+1)) * normal(iDim);
+      }
+      if (dynamicGrid) {
+        const auto& gridVel = geometry.nodes->GetGridVel();
+        projVel -= 0.5 * (dot(gatherVariables<nDim>(iPoint, gridVel), normal) +
+                          dot(gatherVariables<nDim>(jPoint, gridVel), normal));
+      }
+      a0 = fmax(0.0, projVel);
+      a1 = fmin(0.0, projVel);
+    }
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    jac_i = Double(0.0);
+    jac_j = Double(0.0);
+
+    const Double rho_i = Model::conservative ? density_i : Double(1.0);
+    const Double rho_j = Model::conservative ? density_j : Double(1.0);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * rho_i * UR.i.all(iVar) + a1 * rho_j * UR.j.all(iVar);
+      diagonal(jac_i, iVar) = a0;
+      diagonal(jac_j, iVar) = a1;
+    }
+
+    /*--- Diffusion, projection of the corrected average gradient. ---*/
+
+    const Double proj_vector_ij = dot(vector_ij, normal) / dist2_ij;
+    const auto projGrad = projectedGradient<nVar>(iPoint, jPoint, solution.GetGradient(), U,
+                                                  vector_ij, normal, proj_vector_ij);
+
+    /*--- The model subtracts the diffusion flux and its Jacobians (TSL approximation). ---*/
+    model.viscousFlux(iPoint, jPoint, solution, V, U, projGrad, proj_vector_ij, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,81 @@
+/*!
+ * \file species_fluxes.hpp
+ * \brief Model specific parts of the vectorized species transport edge fluxes.
+ * \author P. Gomes
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CSpeciesVariable.hpp"
+
+/*!
+ * \brief Diffusion of species mass fractions, see CAvgGrad_Species.
+ * \tparam nVar_ - Number of transported species.
+ */
+template<size_t nVar_>
+struct CSpeciesDiffusion {
+  static constexpr size_t nVar = nVar_;
+  static constexpr bool conservative = true;
+
+  bool turbulence;
+  su2double Sc_t;
+
+  /*!
+   * \brief Constructor, store the turbulent Schmidt number if there is a turbulence model.
+   */
+  explicit CSpeciesDiffusion(const CConfig& config) :
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    Sc_t(config.GetSchmidt_Number_Turbulent()) {}
+
+  template<class PrimVarType, class ScalarVarType>
+  FORCEINLINE void viscousFlux(Int iPoint, Int jPoint, const CVariable& solution,
+                               const CPair<PrimVarType>& V,
+                               const CPair<ScalarVarType>&,
+                               const VectorDbl<nVar>& projGrad,
+                               Double proj_vector_ij,
+                               VectorDbl<nVar>& flux,
+                               MatrixDbl<nVar>& jac_i,
+                               MatrixDbl<nVar>& jac_j) const {
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+    const auto diffCoeff_i = gatherVariables<nVar>(iPoint, diffusivity);
+    const auto diffCoeff_j = gatherVariables<nVar>(jPoint, diffusivity);
+
+    Double diffusivityTurb = 0.0;
+    if (turbulence) diffusivityTurb = 0.5 * (V.i.eddyVisc() + V.j.eddyVisc()) / Sc_t;
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density();
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density();
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diffusivityLam = 0.5 * (V.i.density() * diffCoeff_i(iVar) + V.j.density() * diffCoeff_j(iVar));
+      const Double diff = diffusivityLam + diffusivityTurb;
+
+      flux(iVar) -= diff * projGrad(iVar);
+      diagonal(jac_i, iVar) += diff * proj_on_rho_i;
+      diagonal(jac_j, iVar) -= diff * proj_on_rho_j;
+    }
+  }
+};
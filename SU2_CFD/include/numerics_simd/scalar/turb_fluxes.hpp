@@ -0,0 +1,126 @@
+/*!
+ * \file turb_fluxes.hpp
+ * \brief Model specific parts of the vectorized turbulence edge fluxes.
+ * \author P. Gomes
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \brief Diffusion of the Spalart-Allmaras variable, see CAvgGrad_TurbSA and CAvgGrad_TurbSA_Neg.
+ * \tparam NegativeSA - Use the modified diffusion coefficient of the negative SA model.
+ */
+template<bool NegativeSA>
+struct CSADiffusion {
+  static constexpr size_t nVar = 1;
+  static constexpr bool conservative = false;
+
+  template<class PrimVarType, class ScalarVarType>
+  FORCEINLINE void viscousFlux(Int, Int, const CVariable&,
+                               const CPair<PrimVarType>& V,
+                               const CPair<ScalarVarType>& U,
+                               const VectorDbl<nVar>& projGrad,
+                               Double proj_vector_ij,
+                               VectorDbl<nVar>& flux,
+                               MatrixDbl<nVar>& jac_i,
+                               MatrixDbl<nVar>& jac_j) const {
+    const su2double sigma = 2.0/3.0;
+    const su2double cn1 = 16.0;
+
+    const Double nu_i = V.i.laminarVisc() / V.i.density();
+    const Double nu_j = V.j.laminarVisc() / V.j.density();
+    const Double nu_ij = 0.5 * (nu_i + nu_j);
+    const Double nu_tilde_ij = 0.5 * (U.i.all(0) + U.j.all(0));
+
+    Double fn = 1.0;
+    if (NegativeSA) {
+      /*--- Xi is clipped such that fn = 1 when nu_tilde is positive. ---*/
+      const Double Xi3 = pow(fmin(nu_tilde_ij, 0.0) / nu_ij, 3);
+      fn = (cn1 + Xi3) / (cn1 - Xi3);
+    }
+    const Double nu_e = nu_ij + fn * nu_tilde_ij;
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+    diagonal(jac_i, 0) -= (0.5 * projGrad(0) - nu_e * proj_vector_ij) / sigma;
+    diagonal(jac_j, 0) -= (0.5 * projGrad(0) + nu_e * proj_vector_ij) / sigma;
+  }
+};
+
+/*!
+ * \brief Diffusion of k and omega with blended coefficients, see CAvgGrad_TurbSST and CAvgGrad_TurbKW.
+ * \note Both models are solved by CTurbSSTSolver, which provides the first blending function.
+ */
+struct CKOmegaDiffusion {
+  static constexpr size_t nVar = 2;
+  static constexpr bool conservative = true;
+
+  su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  /*!
+   * \brief Constructor, the constants are those of the solver (CSolver::GetConstants).
+   */
+  explicit CKOmegaDiffusion(const su2double* constants) :
+    sigma_k1(constants[0]), sigma_k2(constants[1]), sigma_om1(constants[2]), sigma_om2(constants[3]) {}
+
+  template<class PrimVarType, class ScalarVarType>
+  FORCEINLINE void viscousFlux(Int iPoint, Int jPoint, const CVariable& solution,
+                               const CPair<PrimVarType>& V,
+                               const CPair<ScalarVarType>&,
+                               const VectorDbl<nVar>& projGrad,
+                               Double proj_vector_ij,
+                               VectorDbl<nVar>& flux,
+                               MatrixDbl<nVar>& jac_i,
+                               MatrixDbl<nVar>& jac_j) const {
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    /*--- Blended constants for the viscous terms. ---*/
+    const Double sigma_kine_i = F1_i*sigma_k1 + (1.0 - F1_i)*sigma_k2;
+    const Double sigma_kine_j = F1_j*sigma_k1 + (1.0 - F1_j)*sigma_k2;
+    const Double sigma_omega_i = F1_i*sigma_om1 + (1.0 - F1_i)*sigma_om2;
+    const Double sigma_omega_j = F1_j*sigma_om1 + (1.0 - F1_j)*sigma_om2;
+
+    /*--- Mean effective dynamic viscosities. ---*/
+    const Double diff_kine = 0.5 * (V.i.laminarVisc() + sigma_kine_i * V.i.eddyVisc() +
+                                    V.j.laminarVisc() + sigma_kine_j * V.j.eddyVisc());
+    const Double diff_omega = 0.5 * (V.i.laminarVisc() + sigma_omega_i * V.i.eddyVisc() +
+                                     V.j.laminarVisc() + sigma_omega_j * V.j.eddyVisc());
+
+    flux(0) -= diff_kine * projGrad(0);
+    flux(1) -= diff_omega * projGrad(1);
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density();
+    diagonal(jac_i, 0) += diff_kine * proj_on_rho_i;
+    diagonal(jac_i, 1) += diff_omega * proj_on_rho_i;
+
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density();
+    diagonal(jac_j, 0) -= diff_kine * proj_on_rho_j;
+    diagonal(jac_j, 1) -= diff_omega * proj_on_rho_j;
+  }
+};
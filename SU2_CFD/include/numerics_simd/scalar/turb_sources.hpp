@@ -0,0 +1,402 @@
+/*!
+ * \file turb_sources.hpp
+ * \brief Vectorized pointwise source terms of the turbulence models.
+ * \author P. Gomes
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \brief Subtract the sources from the residual and their Jacobians from the diagonal blocks.
+ */
+template<size_t nVar>
+FORCEINLINE void updatePointSystem(Int iPoint,
+                                   bool implicit,
+                                   Double updateMask,
+                                   const VectorDbl<nVar>& residual,
+                                   const MatrixDbl<nVar>& jacobian,
+                                   CSysVector<su2double>& vector,
+                                   SparseMatrixType& matrix) {
+  vector.SubtractBlock(iPoint, residual, updateMask);
+  if (implicit) {
+    auto wasActive = AD::BeginPassive();
+    matrix.SubtractBlock2Diag(iPoint, jacobian, updateMask);
+    AD::EndPassive(wasActive);
+  }
+}
+
+/*!
+ * \class CSASourceScheme
+ * \ingroup SourceDiscr
+ * \brief Production, destruction and cross-production of the Spalart-Allmaras model, see CSourceBase_TurbSA.
+ * \tparam PrimVarType - Compressible or incompressible primitive variables.
+ * \tparam Version - Baseline (NONE), negative (NEG), or Edwards (EDW) variant.
+ * \tparam Ft2 - Whether to use the ft2 term.
+ * \note The branches of the scalar implementation are emulated with "blend".
+ *       The compressibility correction and the transition models are not implemented.
+ */
+template<class PrimVarType, SA_OPTIONS Version, bool Ft2>
+class CSASourceScheme final : public CSourceSIMD {
+private:
+  static constexpr size_t nDim = PrimVarType::nDim;
+  static constexpr size_t nPrimVar = PrimVarType::nVar;
+
+  /*--- Constants of the model, see CSAVariables. ---*/
+  const su2double cv1_3 = pow(7.1, 3);
+  const su2double k2 = pow(0.41, 2);
+  const su2double cb1 = 0.1355;
+  const su2double cw2 = 0.3;
+  const su2double ct3 = 1.2;
+  const su2double ct4 = 0.5;
+  const su2double cw3_6 = pow(2, 6);
+  const su2double sigma = 2.0 / 3.0;
+  const su2double cb2 = 0.622;
+  const su2double cb2_sigma = cb2 / sigma;
+  const su2double cw1 = cb1 / k2 + (1 + cb2) / sigma;
+  const su2double cr1 = 0.5;
+
+  const bool rotation;
+  const CFlowVariable& flowVars;
+
+public:
+  /*!
+   * \brief Constructor, store the options and the flow variables.
+   * \param[in] config - Problem definitions.
+   * \param[in] flowVars_ - Variables of the flow solver.
+   */
+  CSASourceScheme(const CConfig& config, const CFlowVariable& flowVars_) :
+    rotation(config.GetSAParsedOptions().rot),
+    flowVars(flowVars_) {
+  }
+
+  /*!
+   * \brief Implementation of the source terms.
+   */
+  void ComputeResidual(Int iPoint,
+                       const CConfig& config,
+                       const CGeometry& geometry,
+                       const CVariable& solution,
+                       Double updateMask,
+                       CSysVector<su2double>& vector,
+                       SparseMatrixType& matrix) const final {
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    PrimVarType V;
+    V.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    const Double nue = gatherVariables<1>(iPoint, solution.GetSolution())(0);
+    const auto gradNue = gatherVariables<1,nDim>(iPoint, solution.GetGradient());
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double roughness = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+
+    /*--- Wall roughness is accounted for by modifying the wall distance, d_new = d + 0.03 k_s. ---*/
+    const Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) + 0.03 * roughness;
+
+    /*--- Sources are only computed away from walls, the distance is clipped to keep the discarded lanes finite. ---*/
+    const Double active = dist > 1e-10;
+    const Double dist_i = fmax(dist, 1e-10);
+
+    /*--- Vorticity, or strain rate for the Edwards variant, with rotation correction. ---*/
+
+    Double Omega;
+    if (Version == SA_OPTIONS::EDW) {
+      const auto gradV = gatherVariables<nDim+1,nDim>(iPoint, flowVars.GetGradient_Primitive());
+      Double Sbar = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          Sbar += (gradV(iDim+1,jDim) + gradV(jDim+1,iDim)) * gradV(iDim+1,jDim);
+        }
+      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        Sbar -= (2.0 / 3.0) * pow(gradV(iDim+1,iDim), 2);
+      }
+      Omega = sqrt(fmax(Sbar, 0.0));
+    } else {
+      Omega = sqrt(squaredNorm<3>(gatherVariables<3>(iPoint, flowVars.GetVorticity())));
+    }
+    if (rotation) {
+      const Double strainMag = gatherVariables(iPoint, flowVars.GetStrainMag());
+      Omega += 2.0 * fmin(0.0, strainMag - Omega);
+    }
+    const Double S = Omega;
+
+    /*--- Auxiliary functions. ---*/
+
+    const Double dist_i_2 = pow(dist_i, 2);
+    const Double nu = V.laminarVisc() / V.density();
+    const Double inv_k2_d2 = 1.0 / (k2 * dist_i_2);
+
+    const Double Ji = nue / nu + cr1 * (roughness / (dist_i + EPS));
+    const Double d_Ji = 1.0 / nu;
+    const Double Ji_2 = pow(Ji, 2);
+    const Double Ji_3 = Ji_2 * Ji;
+
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    const Double d_fv1 = 3.0 * Ji_2 * cv1_3 / (nu * pow(Ji_3 + cv1_3, 2));
+    const Double fv2 = 1.0 - nue / (nu + nue * fv1);
+    const Double d_fv2 = -(1.0 / nu - Ji_2 * d_fv1) / pow(1.0 + Ji * fv1, 2);
+
+    Double ft2 = 0.0, d_ft2 = 0.0;
+    if (Ft2) {
+      ft2 = ct3 * exp(-ct4 * Ji_2);
+      d_ft2 = -2.0 * ct4 * Ji * ft2 * d_Ji;
+    }
+
+    /*--- Modified vorticity. ---*/
+
+    Double Shat, d_Shat;
+    if (Version == SA_OPTIONS::EDW) {
+      Shat = fmax(S * ((1.0 / fmax(Ji, 1e-16)) + fv1), 1e-16);
+      Shat = fmax(Shat, 1e-10);
+      /*--- Ji^-2 is clipped like Ji above, otherwise Ji = S = 0 gives NaN. ---*/
+      d_Shat = blend(Shat > 1e-10, -S / (fmax(Ji_2, 1e-32) * nu) + S * d_fv1, 0.0);
+    } else {
+      Shat = fmax(S + nue * fv2 * inv_k2_d2, 1e-10);
+      d_Shat = blend(Shat > 1e-10, (fv2 + nue * d_fv2) * inv_k2_d2, 0.0);
+      if (Version == SA_OPTIONS::NEG) {
+        const Double positive = nue > 0.0;
+        Shat = blend(positive, Shat, 1e-10);
+        d_Shat = blend(positive, d_Shat, 0.0);
+      }
+    }
+    const Double inv_Shat = 1.0 / Shat;
+
+    /*--- Function r. ---*/
+
+    Double r = fmin(nue * inv_Shat * inv_k2_d2, 10.0);
+    Double d_r = (Shat - nue * d_Shat) * pow(inv_Shat, 2) * inv_k2_d2;
+    if (Version == SA_OPTIONS::EDW) {
+      const su2double tanh_1 = tanh(1.0);
+      r = tanh(r) / tanh_1;
+      d_r = (1.0 - pow(tanh(r), 2)) * d_r / tanh_1;
+    } else {
+      d_r = blend(r < 10.0, d_r, 0.0);
+    }
+
+    const Double g = r + cw2 * (pow(r, 6) - r);
+    const Double g_6 = pow(g, 6);
+    const Double glim = pow((1 + cw3_6) / (g_6 + cw3_6), 1.0 / 6.0);
+    const Double fw = g * glim;
+
+    const Double d_g = d_r * (1.0 + cw2 * (6.0 * pow(r, 5) - 1.0));
+    const Double d_fw = d_g * glim * (1.0 - g_6 / (g_6 + cw3_6));
+
+    /*--- Production, destruction, cross-production, and the Jacobian of the first two. ---*/
+
+    Double production = cb1 * (1.0 - ft2) * Shat * nue;
+    Double jacobian = cb1 * (-Shat * nue * d_ft2 + (1.0 - ft2) * (nue * d_Shat + Shat));
+
+    const su2double cb1_k2 = cb1 / k2;
+    const Double factor = cw1 * fw - cb1_k2 * ft2;
+    Double destruction = factor * pow(nue, 2) / dist_i_2;
+    jacobian -= ((cw1 * d_fw - cb1_k2 * d_ft2) * pow(nue, 2) + factor * 2.0 * nue) / dist_i_2;
+
+    if (Version == SA_OPTIONS::NEG) {
+      /*--- Negative nu tilde, the destruction becomes a production (hence its sign). ---*/
+      const Double positive = nue > 0.0;
+      const Double dP_dnu = cb1 * (1.0 - ct3) * S;
+      const Double dD_dnu = -cw1 * nue / dist_i_2;
+      production = blend(positive, production, dP_dnu * nue);
+      destruction = blend(positive, destruction, dD_dnu * nue);
+      jacobian = blend(positive, jacobian, dP_dnu - 2.0 * dD_dnu);
+    }
+
+    const Double crossProduction = cb2_sigma * squaredNorm<nDim>(gradNue.data());
+
+    VectorDbl<1> residual;
+    MatrixDbl<1> jac;
+    residual(0) = blend(active, (production - destruction + crossProduction) * volume, 0.0);
+    diagonal(jac, 0) = blend(active, jacobian * volume, 0.0);
+
+    stopPreacc(residual);
+
+    updatePointSystem(iPoint, implicit, updateMask, residual, jac, vector, matrix);
+  }
+};
+
+/*!
+ * \class CKOmegaSourceScheme
+ * \ingroup SourceDiscr
+ * \brief Production, dissipation and cross-diffusion of the SST and Wilcox k-omega models,
+ *        see CSourcePieceWise_TurbSST and CSourcePieceWise_TurbKW.
+ * \tparam PrimVarType - Compressible or incompressible primitive variables.
+ * \tparam PrimVarType - Compressible or incompressible primitive variables.
+ * \note Both models are solved by CTurbSSTSolver, which provides the blending functions. The
+ *       uncertainty quantification, axisymmetric, and transition terms are not implemented.
+ */
+template<class PrimVarType>
+class CKOmegaSourceScheme final : public CSourceSIMD {
+private:
+  static constexpr size_t nDim = PrimVarType::nDim;
+  static constexpr size_t nPrimVar = PrimVarType::nVar;
+  static constexpr size_t nVar = 2;
+
+  const su2double beta_1, beta_2, beta_star, a1, alfa_1, alfa_2, prod_lim_const;
+  const su2double kAmb, omegaAmb;
+
+  const bool version1994;       /*!< \brief SST-V1994m or k-omega V1988, production with divergence terms. */
+  const SST_OPTIONS production; /*!< \brief Modification of the production (vorticity or Kato-Launder). */
+  const bool sustaining;        /*!< \brief SST with sustaining terms. */
+  const bool hybridRANSLES;     /*!< \brief Dissipation of k based on the DES length scale. */
+  const CFlowVariable& flowVars;
+
+public:
+  /*!
+   * \brief Constructor, store the constants, options and the flow variables.
+   * \param[in] constants - Model constants (CSolver::GetConstants).
+   * \param[in] kine_Inf - Freestream k, for sustaining terms.
+   * \param[in] omega_Inf - Freestream omega, for sustaining terms.
+   * \param[in] version1994_ - Use the V1994 (SST) or V1988 (k-omega) production.
+   * \param[in] production_ - Production modification (SST_OPTIONS::NONE, V, or KL).
+   * \param[in] sustaining_ - Use sustaining terms.
+   * \param[in] hybridRANSLES_ - Hybrid RANS/LES mode (SST_DDES or SST_IDDES).
+   * \param[in] flowVars_ - Variables of the flow solver.
+   */
+  CKOmegaSourceScheme(const su2double* constants, su2double kine_Inf, su2double omega_Inf, bool version1994_,
+                      SST_OPTIONS production_, bool sustaining_, bool hybridRANSLES_,
+                      const CFlowVariable& flowVars_) :
+    beta_1(constants[4]),
+    beta_2(constants[5]),
+    beta_star(constants[6]),
+    a1(constants[7]),
+    alfa_1(constants[8]),
+    alfa_2(constants[9]),
+    prod_lim_const(constants[10]),
+    kAmb(kine_Inf),
+    omegaAmb(omega_Inf),
+    version1994(version1994_),
+    production(production_),
+    sustaining(sustaining_),
+    hybridRANSLES(hybridRANSLES_),
+    flowVars(flowVars_) {
+  }
+
+  /*!
+   * \brief Implementation of the source terms.
+   */
+  void ComputeResidual(Int iPoint,
+                       const CConfig& config,
+                       const CGeometry& geometry,
+                       const CVariable& solution,
+                       Double updateMask,
+                       CSysVector<su2double>& vector,
+                       SparseMatrixType& matrix) const final {
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& turbVars = static_cast<const CTurbSSTVariable&>(solution);
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    PrimVarType V;
+    V.all = gatherVariables<nPrimVar>(iPoint, flowVars.GetPrimitive());
+    const auto U = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    const Double& k = U(0);
+    const Double& w = U(1);
+
+    const Double F1 = gatherVariables(iPoint, turbVars.GetF1blending());
+    const Double F2 = gatherVariables(iPoint, turbVars.GetF2blending());
+    const Double CDkw = gatherVariables(iPoint, turbVars.GetCrossDiff());
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance());
+    const Double strainMag = gatherVariables(iPoint, flowVars.GetStrainMag());
+    const Double vorticityMag = sqrt(squaredNorm<3>(gatherVariables<3>(iPoint, flowVars.GetVorticity())));
+
+    const Double& density = V.density();
+    const Double& eddyVisc = V.eddyVisc();
+
+    /*--- Blended constants. ---*/
+
+    const Double alfa_blended = F1 * alfa_1 + (1.0 - F1) * alfa_2;
+    const Double beta_blended = F1 * beta_1 + (1.0 - F1) * beta_2;
+
+    /*--- Production. ---*/
+
+    Double P_Base = strainMag;
+    if (production == SST_OPTIONS::V) P_Base = vorticityMag;
+    if (production == SST_OPTIONS::KL) P_Base = sqrt(strainMag * vorticityMag);
+
+    const Double prod_limit = prod_lim_const * beta_star * density * w * k;
+
+    Double P = eddyVisc * pow(P_Base, 2);
+    Double diverg = 0.0;
+    if (version1994) {
+      const auto gradV = gatherVariables<nDim+1,nDim>(iPoint, flowVars.GetGradient_Primitive());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) diverg += gradV(iDim+1,iDim);
+      P -= 2.0 / 3.0 * density * k * diverg;
+    }
+    Double pk = fmax(0.0, fmin(P, prod_limit));
+
+    Double pw;
+    if (version1994) {
+      const Double zeta = fmax(w, vorticityMag * F2 / a1);
+      pw = alfa_blended * density * fmax(pow(P_Base, 2) - 2.0 / 3.0 * zeta * diverg, 0.0);
+    } else {
+      pw = (alfa_blended * density / eddyVisc) * pk;
+    }
+
+    if (sustaining) {
+      pk = fmax(pk, beta_star * density * kAmb * omegaAmb);
+      pw = fmax(pw, beta_blended * density * pow(omegaAmb, 2));
+    }
+
+    /*--- Dissipation, for hybrid RANS/LES rho * k^(3/2) / l_DES. ---*/
+
+    Double F_DES = 1.0;
+    if (hybridRANSLES) {
+      const Double lengthScale = gatherVariables(iPoint, turbVars.GetDES_LengthScale());
+      F_DES = sqrt(k) / (beta_star * w * fmax(lengthScale, EPS));
+    }
+    const Double dk = F_DES * beta_star * density * w * k;
+    const Double dw = beta_blended * density * w * w;
+
+    /*--- Sources and Jacobian (only the dissipation is linearized), away from walls. ---*/
+
+    const Double active = dist > 1e-10;
+
+    VectorDbl<nVar> residual;
+    residual(0) = blend(active, (pk - dk) * volume, 0.0);
+    residual(1) = blend(active, (pw - dw + (1.0 - F1) * CDkw) * volume, 0.0);
+
+    MatrixDbl<nVar> jac;
+    jac(0,0) = blend(active, -F_DES * beta_star * w * volume, 0.0);
+    jac(0,1) = blend(active, -F_DES * beta_star * k * volume, 0.0);
+    jac(1,0) = 0.0;
+    jac(1,1) = blend(active, -2.0 * beta_blended * w * volume, 0.0);
+
+    stopPreacc(residual);
+
+    updatePointSystem(iPoint, implicit, updateMask, residual, jac, vector, matrix);
+  }
+};
@@ -133,6 +133,18 @@ FORCEINLINE VectorDbl<nDim> tangentProjection(const MatrixDbl<nDim>& tensor,
 template<size_t nDim>
 FORCEINLINE Double norm(const VectorDbl<nDim>& vector) { return sqrt(squaredNorm(vector)); }
 
+/*!
+ * \brief Lane-wise selection, "a" where the mask is not 0 and "b" elsewhere.
+ * \note Unlike the arithmetic blend (mask*a + (1-mask)*b) the discarded lanes
+ *       do not propagate Inf/NaN, use this to emulate branches of scalar code.
+ */
+FORCEINLINE Double blend(Double mask, Double a, Double b) {
+  Double res;
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (size_t k = 0; k < Double::Size; ++k) res[k] = (mask[k] != 0) ? a[k] : b[k];
+  return res;
+}
+
 #ifndef CODI_REVERSE_TYPE
 /*!
  * \brief Gather a single variable from index iPoint of a 1D container.
@@ -197,7 +209,8 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
     for (size_t j=0; j<nCols; ++j) {
       for (size_t k=0; k<Double::Size; ++k) {
         AD::SetPreaccIn(vars(iPoint[k],i,j));
-        x(i,j)[k] = vars(iPoint[k],i,j);
+        /*--- Flat indexing, matrices with one row only have vector accessors. ---*/
+        x.data()[i*nCols+j][k] = vars(iPoint[k],i,j);
       }
     }
   }
@@ -421,6 +421,21 @@ public:
                      unsigned short RunTime_EqSystem,
                      bool Output) override;
 
+  /*!
+   * \brief Update the primitive variables (and the undivided Laplacian for JST-type schemes) for
+   * a matrix-free product, the gradients, limiters, and sensors of the last preprocessing are kept.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void FrozenPreprocessing(CGeometry *geometry,
+                           CSolver **solver_container,
+                           CConfig *config,
+                           unsigned short iMesh,
+                           unsigned short RunTime_EqSystem) final;
+
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] config - Definition of the particular problem.
@@ -298,8 +298,8 @@ class CFVMFlowSolverBase : public CSolver {
       }
     }
 
-    /*--- Warning message about non-physical reconstructions. ---*/
-    if ((MGLevel == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
+    /*--- Warning message about non-physical reconstructions (not for matrix-free products). ---*/
+    if ((MGLevel == MESH_0) && (config->GetComm_Level() == COMM_FULL) && !nodes->GetFrozenNonPhysicalEdgeCounter()) {
       /*--- Add counter results for all threads. ---*/
       SU2_OMP_ATOMIC
       ErrorCounter += localCounter;
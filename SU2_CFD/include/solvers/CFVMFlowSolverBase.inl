@@ -1559,14 +1559,7 @@ template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
-  if (!edgeNumerics) {
-    if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
-        (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
-      SU2_MPI::Error("When using vectorization, the EDGE_COLORING_GROUP_SIZE must be divisible "
-                     "by the SIMD length (2, 4, or 8).", CURRENT_FUNCTION);
-    }
-    InstantiateEdgeNumerics(solvers, config);
-  }
+  if (!edgeNumerics) InstantiateEdgeNumerics(solvers, config);
 
   /*--- Non-physical counter. ---*/
   unsigned long counterLocal = 0;
@@ -1585,6 +1578,9 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
     SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for(auto k = 0ul; k < color.size; k += Double::Size) {
+      /*--- The tail of the color is not padded, masked lanes repeat its first edge (which
+       *    does not need to be contiguous, see CEdge::GetNode) and are not updated. The color
+       *    indices are accessed per lane since they are not an array without OpenMP. ---*/
       Int iEdge;
       Double mask;
       for (auto j = 0ul; j < Double::Size; ++j) {
@@ -1600,7 +1596,7 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
       }
       if (MGLevel == MESH_0) {
         for (auto j = 0ul; j < Double::Size; ++j)
-          counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+          counterLocal += (mask[j] != 0) && (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
       }
     }
     END_SU2_OMP_FOR
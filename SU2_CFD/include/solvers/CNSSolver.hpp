@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CEulerSolver.hpp"
+#include "../../../Common/include/wall_model.hpp"
 
 /*!
  * \class CNSSolver
@@ -43,6 +44,9 @@ private:
   vector<vector<su2double> > Buffet_Sensor; /*!< \brief Separation sensor for each boundary and vertex. */
   su2double Total_Buffet_Metric = 0.0;      /*!< \brief Integrated separation sensor for all the boundaries. */
 
+  vector<unique_ptr<CWallModel> > WallModel; /*!< \brief Wall model of each marker (EQUILIBRIUM_WALL_MODEL or LOGARITHMIC_WALL_MODEL). */
+  vector<vector<su2double> > WallModelHeight; /*!< \brief Distance to the wall of the exchange location (normal neighbor) of each vertex. */
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition.
@@ -123,6 +127,24 @@ private:
    */
   void SetTau_Wall_WF(CGeometry *geometry, CSolver** solver_container, const CConfig* config);
 
+  /*!
+   * \brief Store the distance to the wall of the exchange location of the vertices of the markers
+   *        that use a wall model. Only needs to be called again if the grid moves.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetWallModelExchange(const CGeometry *geometry);
+
+  /*!
+   * \brief Computes the wall shear stress (Tau_Wall) on a marker using its wall model (CWallModel),
+   *        with the exchange location at the first point off the wall. The iterations of the model
+   *        start from the friction velocity of the previous iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMarker - Marker index.
+   * \return The number of vertices for which y+ is too small and the model is not active.
+   */
+  unsigned long SetTau_Wall_WM(const CGeometry *geometry, const CConfig* config, unsigned short iMarker);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -33,6 +33,7 @@
 #include "../variables/CScalarVariable.hpp"
 #include "../variables/CFlowVariable.hpp"
 #include "../variables/CPrimitiveIndices.hpp"
+#include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CSolver.hpp"
 
 /*!
@@ -78,6 +79,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Vectorized convection-diffusion edge fluxes, if supported. */
+  bool edgeNumericsCreated = false;      /*!< \brief InstantiateEdgeNumerics was called. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -297,6 +301,29 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Create the vectorized edge numerics (edgeNumerics), if the solver supports them.
+   * \note Called by one thread, the scalar edge loop is used if edgeNumerics is not created.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous fluxes (and Jacobians) with the vectorized edge numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Apply the bounded scalar correction (divergence of the mass flux) in a point loop.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] edgeMassFluxes - Mass fluxes of the flow solver.
+   * \param[in] implicit - Update the Jacobian.
+   */
+  void BoundedScalarCorrection(const CGeometry* geometry, const su2activevector& edgeMassFluxes, bool implicit);
+
  private:
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
@@ -322,9 +349,11 @@ class CScalarSolver : public CSolver {
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability. Default value 1.0 set in ctor of CScalarVariable.
+   * \note Models may also modify the solution of the linear system (LinSysSol) in this pass.
+   * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
    */
-  virtual void ComputeUnderRelaxationFactor(const CConfig* config) {}
+  virtual void ComputeUnderRelaxationFactor(CSolver** solver_container, const CConfig* config) {}
 
  public:
   /*!
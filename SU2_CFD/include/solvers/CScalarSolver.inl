@@ -77,6 +77,7 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
 }
 
 template <class VariableType>
@@ -143,6 +144,22 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Apply scalar advection correction terms for bounded scalar problems ---*/
   const bool bounded_scalar = numerics->GetBoundedScalar();
 
+  /*--- Use the vectorized edge loop if the solver supports it. ---*/
+  if (!edgeNumericsCreated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      InstantiateEdgeNumerics(solver_container, config);
+      edgeNumericsCreated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  if (edgeNumerics) {
+    EdgeFluxResidual(geometry, config);
+    if (bounded_scalar) BoundedScalarCorrection(geometry, edgeMassFluxes, implicit);
+    return;
+  }
+
   /*--- Static arrays of MUSCL-reconstructed flow primitives and turbulence variables (thread safety). ---*/
   su2double solution_i[MAXNVAR] = {0.0}, flowPrimVar_i[MAXNVARFLOW] = {0.0};
   su2double solution_j[MAXNVAR] = {0.0}, flowPrimVar_j[MAXNVARFLOW] = {0.0};
@@ -310,25 +327,76 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
     if (implicit) Jacobian.SetDiagonalAsColumnSum();
 
     /*--- Bounded scalar correction that cannot be applied in the edge loop when using the ReducerStrategy. ---*/
-    if (bounded_scalar) {
-      SU2_OMP_FOR_STAT(omp_chunk_size)
-      for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
-        const auto* solution = nodes->GetSolution(iPoint);
-        su2double divergence = 0;
-
-        for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
-          const auto sign = (iPoint == geometry->edges->GetNode(iEdge,0)) ? 1 : -1;
-          const su2double EdgeMassFlux = sign * edgeMassFluxes[iEdge];
-          divergence += EdgeMassFlux;
-          LinSysRes.AddBlock(iPoint, solution, -EdgeMassFlux);
-        }
-        if (implicit) {
-          Jacobian.AddVal2Diag(iPoint, -divergence);
-        }
+    if (bounded_scalar) BoundedScalarCorrection(geometry, edgeMassFluxes, implicit);
+  }
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(CGeometry* geometry, const CConfig* config) {
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      /*--- The tail of the color is not padded, masked lanes repeat its first edge (which
+       *    does not need to be contiguous, see CEdge::GetNode) and are not updated. The color
+       *    indices are accessed per lane since they are not an array without OpenMP. ---*/
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
       }
-      END_SU2_OMP_FOR
     }
+    END_SU2_OMP_FOR
   }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+  }
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::BoundedScalarCorrection(const CGeometry* geometry,
+                                                          const su2activevector& edgeMassFluxes, bool implicit) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const auto* solution = nodes->GetSolution(iPoint);
+    su2double divergence = 0;
+
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+      const auto sign = (iPoint == geometry->edges->GetNode(iEdge,0)) ? 1 : -1;
+      const su2double EdgeMassFlux = sign * edgeMassFluxes[iEdge];
+      divergence += EdgeMassFlux;
+      LinSysRes.AddBlock(iPoint, solution, -EdgeMassFlux);
+    }
+    if (implicit) {
+      Jacobian.AddVal2Diag(iPoint, -divergence);
+    }
+  }
+  END_SU2_OMP_FOR
 }
 
 template <class VariableType>
@@ -484,7 +552,7 @@ void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry,
                                                             CConfig* config) {
   const bool compressible = (config->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
 
-  ComputeUnderRelaxationFactor(config);
+  ComputeUnderRelaxationFactor(solver_container, config);
 
   /*--- Update solution (system written in terms of increments) ---*/
 
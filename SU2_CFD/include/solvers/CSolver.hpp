@@ -752,6 +752,24 @@ public:
                                     unsigned short RunTime_EqSystem,
                                     bool Output) { }
 
+  /*!
+   * \brief Lightweight preprocessing for the residual evaluations of matrix-free Jacobian-vector products.
+   * Gradients, limiters, and sensors are frozen, only what the residual depends on directly is updated.
+   * \note By default this is the full preprocessing.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  inline virtual void FrozenPreprocessing(CGeometry *geometry,
+                                          CSolver **solver_container,
+                                          CConfig *config,
+                                          unsigned short iMesh,
+                                          unsigned short RunTime_EqSystem) {
+    Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1404,6 +1422,16 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CoupledImplicitIteration(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CConfig *config) { }
+
   /*!
    * \brief Adapt the CFL number based on the local under-relaxation parameters
    *        computed for each nonlinear iteration.
@@ -45,6 +45,11 @@ private:
 
   TransLMCorrelations TransCorrelations;
 
+  /*!
+   * \brief The transition model does not have vectorized numerics.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const*, const CConfig*) override {}
+
 public:
   /*!
    * \overload
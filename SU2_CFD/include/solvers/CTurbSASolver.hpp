@@ -41,16 +41,6 @@ class CTurbSASolver final : public CTurbSolver {
 private:
   su2double nu_tilde_Engine, nu_tilde_ActDisk;
 
-  /*!
-   * \brief A virtual member.
-   * \param[in] solver - Solver container
-   * \param[in] geometry - Geometrical definition.
-   * \param[in] config - Definition of the particular problem.
-   */
-  void SetDES_LengthScale(CSolver** solver,
-                          CGeometry *geometry,
-                          CConfig *config);
-
   /*!
    * \brief Compute nu tilde from the wall functions.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -68,9 +58,10 @@ private:
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability.
+   * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] config - Definition of the particular problem.
    */
-  void ComputeUnderRelaxationFactor(const CConfig *config) final;
+  void ComputeUnderRelaxationFactor(CSolver** solver_container, const CConfig *config) final;
 
 public:
   /*!
@@ -87,6 +78,12 @@ public:
    */
   ~CTurbSASolver() = default;
 
+  /*!
+   * \brief Derivatives of the eddy viscosity w.r.t. the turbulence variables (see CTurbSolver).
+   */
+  void EddyViscosityDerivatives(unsigned long iPoint, const CGeometry* geometry, const CVariable* flowNodes,
+                                const CConfig* config, su2double* dmuT) const override;
+
   /*!
    * \brief Restart residual and compute gradients.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -39,6 +39,7 @@ class CTurbSSTSolver final : public CTurbSolver {
 private:
   su2double constants[11] = {0.0}; /*!< \brief Constants for the model. */
   SST_ParsedOptions sstParsedOptions;
+  bool wilcoxKOmega = false;       /*!< \brief The solver is used for the k-omega model (KIND_TURB_MODEL= KW). */
 
   /*!
    * \brief Compute nu tilde from the wall functions.
@@ -54,6 +55,26 @@ private:
                      const CConfig *config,
                      unsigned short val_marker);
 
+  /*!
+   * \brief RANS length scale of the hybrid RANS/LES modes, sqrt(k) / (beta_star * omega).
+   */
+  Double DES_RANSLengthScale(Int iPoint, Double wallDistance) const override;
+
+  /*!
+   * \brief DES constant blended with F1 between the k-omega (0.78) and k-epsilon (0.61) values,
+   *        the k-omega value for KIND_TURB_MODEL= KW which has no k-epsilon branch.
+   */
+  Double DES_Constant(Int iPoint, su2double constDES) const override;
+
+  /*!
+   * \brief Limit the update of k and omega such that they remain positive (see CTurbSolver).
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline void ComputeUnderRelaxationFactor(CSolver** solver_container, const CConfig* config) override {
+    if (config->GetTurbPositivityUpdate()) ComputePositivityPreservingUpdate(solver_container, config);
+  }
+
 public:
   /*!
    * \brief Constructor.
@@ -68,6 +89,12 @@ public:
    */
   ~CTurbSSTSolver() = default;
 
+  /*!
+   * \brief Derivatives of the eddy viscosity w.r.t. the turbulence variables (see CTurbSolver).
+   */
+  void EddyViscosityDerivatives(unsigned long iPoint, const CGeometry* geometry, const CVariable* flowNodes,
+                                const CConfig* config, su2double* dmuT) const override;
+
   /*!
    * \brief Restart residual and compute gradients.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -42,6 +42,89 @@ protected:
 
   vector<su2activematrix> Inlet_TurbVars;  /*!< \brief Turbulence variables at inlet profiles */
 
+  CSourceSIMD* sourceNumerics = nullptr; /*!< \brief Vectorized pointwise source terms, if supported. */
+  bool sourceNumericsCreated = false;    /*!< \brief The creation of sourceNumerics was attempted. */
+
+  /*!
+   * \brief Create the vectorized convection-diffusion numerics of the turbulence model.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) override;
+
+  /*!
+   * \brief Compute the source terms (and Jacobians) of the model with the vectorized numerics, in
+   *        groups of contiguous points. The numerics are created on the first call.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if vectorization is not requested (USE_VECTORIZATION), or if the model or the
+   *         options in use are not supported (nothing is computed).
+   */
+  bool VectorizedSourceResidual(const CGeometry* geometry, const CSolver* const* solvers, const CConfig* config);
+
+  /*!
+   * \brief Compute the length scale of the hybrid RANS/LES models (DES, DDES, ZDES, EDDES, IDDES) in groups of
+   *        Double::Size domain points. The geometric parts (max and min lengths, and per direction distances to
+   *        the neighbors) are stored by the geometry, and only updated when the grid moves.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] cd1 - Constant of the shielding function, f_d = 1 - tanh((cd1 * r_d)^3).
+   */
+  void ComputeDES_LengthScale(const CGeometry* geometry, const CSolver* const* solvers, const CConfig* config,
+                              su2double cd1);
+
+  /*!
+   * \brief RANS length scale of the model, used by ComputeDES_LengthScale.
+   * \param[in] iPoint - Group of points.
+   * \param[in] wallDistance - Wall distance of the points.
+   * \return The wall distance by default.
+   */
+  virtual Double DES_RANSLengthScale(Int iPoint, Double wallDistance) const { return wallDistance; }
+
+  /*!
+   * \brief Constant multiplying the LES length scale, used by ComputeDES_LengthScale.
+   * \param[in] iPoint - Group of points.
+   * \param[in] constDES - Value of DES_CONST.
+   * \return DES_CONST by default.
+   */
+  virtual Double DES_Constant(Int iPoint, su2double constDES) const { return constDES; }
+
+  /*!
+   * \brief Positivity preserving update of the (strictly positive) turbulence variables, used by the
+   *        two-equation models when TURB_POSITIVITY_UPDATE= YES. Decreasing increments are mapped as if
+   *        the linear system had been solved for log(U), U_new = U exp(dU/U), which is the linear update to
+   *        first order but never crosses zero, so the clipping to the lower limits stops acting on the update.
+   * \note Increments are limited per point and variable, the under-relaxation of the point (and therefore the
+   *       CFL adaptation) is not affected.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputePositivityPreservingUpdate(CSolver** solver_container, const CConfig* config);
+
+  /*--- Coupled mean flow / turbulence implicit system (COUPLED_TURB_SOLVE). ---*/
+
+  static constexpr size_t MAXNVARCOUPLED = MAXNDIM + 2 + MAXNVAR; /*!< \brief Max number of variables of the coupled system. */
+  unsigned short nVarFlow = 0;             /*!< \brief Number of flow variables in the coupled system. */
+  CSysVector<su2double> CoupledLinSysSol;  /*!< \brief Solution of the coupled linear system. */
+  CSysVector<su2double> CoupledLinSysRes;  /*!< \brief Right hand side of the coupled linear system. */
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> CoupledJacobian; /*!< \brief Jacobian of the coupled system, blocks of nVarFlow+nVar. */
+  CSysSolve<su2mixedfloat>  CoupledSystem;   /*!< \brief Linear solver of the coupled system. */
+#else
+  CSysMatrix<su2double> CoupledJacobian;
+  CSysSolve<su2double>  CoupledSystem;
+#endif
+
+  /*!
+   * \brief Allocate the coupled mean flow / turbulence system, if COUPLED_TURB_SOLVE is used.
+   * \note Called by the constructors of the models after the turbulence Jacobian is initialized.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeCoupledSystem(CGeometry* geometry, const CConfig* config);
+
 public:
   /*!
    * \brief Destructor of the class.
@@ -55,6 +138,31 @@ public:
    */
   CTurbSolver(CGeometry* geometry, CConfig *config, bool conservative);
 
+  /*!
+   * \brief Solve the mean flow and turbulence implicit systems as one coupled linear system and update both
+   *        solutions. The segregated systems must have been assembled (PrepareImplicitIteration) by both solvers.
+   * \note The coupling blocks are the linearization of the first order convective fluxes of the turbulence
+   *       equations w.r.t. the velocity, and of the viscous fluxes of the flow equations w.r.t. the eddy viscosity.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CoupledImplicitIteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) final;
+
+  /*!
+   * \brief Derivatives of the eddy viscosity at a point w.r.t. the (transported) turbulence variables,
+   *        used for the coupling blocks of the flow equations. The default is no dependence.
+   * \param[in] iPoint - Point index.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] flowNodes - Variables of the flow solver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] dmuT - Derivatives, size nVar.
+   */
+  virtual void EddyViscosityDerivatives(unsigned long iPoint, const CGeometry* geometry, const CVariable* flowNodes,
+                                        const CConfig* config, su2double* dmuT) const {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) dmuT[iVar] = 0.0;
+  }
+
   /*!
    * \brief Impose via the residual the Euler wall boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -65,8 +65,24 @@ class CFlowVariable : public CVariable {
   CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, unsigned long nprimvar,
                 unsigned long nprimvargrad, const CConfig* config);
 
+ private:
+  bool FrozenNonPhysicalEdgeCounter = false;  /*!< \brief The counters are not updated (e.g. during matrix-free products). */
+
  public:
   mutable su2vector<int8_t> NonPhysicalEdgeCounter;  /*!< \brief Non-physical reconstruction counter for each edge. */
+
+  /*!
+   * \brief Freeze (or unfreeze) the non-physical edge counters, frozen counters are read but not updated.
+   * \note Not thread safe, call from a single thread and synchronize before the counters are used.
+   * \param[in] frozen - True to freeze the counters.
+   */
+  inline void SetFrozenNonPhysicalEdgeCounter(bool frozen) { FrozenNonPhysicalEdgeCounter = frozen; }
+
+  /*!
+   * \brief Get whether the non-physical edge counters are frozen.
+   */
+  inline bool GetFrozenNonPhysicalEdgeCounter() const { return FrozenNonPhysicalEdgeCounter; }
+
   /*!
    * \brief Updates the non-physical counter of an edge.
    * \param[in] iEdge - Edge index.
@@ -75,6 +91,10 @@ class CFlowVariable : public CVariable {
    */
   template <class T>
   inline T UpdateNonPhysicalEdgeCounter(unsigned long iEdge, const T& isNonPhys) const {
+    if (FrozenNonPhysicalEdgeCounter) {
+      /*--- Only revert to first order if the reconstruction is not usable. ---*/
+      return static_cast<T>((NonPhysicalEdgeCounter[iEdge] > 0) || (isNonPhys != 0));
+    }
     if (isNonPhys != 0) {
       /*--- Force 1st order for this edge for at least 20 iterations. ---*/
       NonPhysicalEdgeCounter[iEdge] = 21;
@@ -255,6 +275,11 @@ class CFlowVariable : public CVariable {
   inline su2double* GetVorticity(unsigned long iPoint) final { return Vorticity[iPoint]; }
   inline const su2double* GetVorticity(unsigned long iPoint) const final { return Vorticity[iPoint]; }
 
+  /*!
+   * \brief Get the vorticity of all points.
+   */
+  inline const MatrixType& GetVorticity() const { return Vorticity; }
+
   /*!
    * \brief Get the magnitude of rate of strain.
    * \param[in] iPoint - Point index.
@@ -267,4 +292,5 @@ class CFlowVariable : public CVariable {
    * \return Vector of magnitudes.
    */
   inline su2activevector& GetStrainMag() { return StrainMag; }
+  inline const su2activevector& GetStrainMag() const { return StrainMag; }
 };
@@ -195,7 +195,7 @@ public:
   /*!
    * \brief Set the new solution for Roe Dissipation.
    */
-  void SetRoe_Dissipation_FD(unsigned long iPoint, su2double wall_distance) override;
+  void SetRoe_Dissipation_FD(unsigned long iPoint, su2double wall_distance, su2double cd1) override;
 
   /*!
    * \brief Get the Roe Dissipation Coefficient.
@@ -44,6 +44,7 @@ protected:
   VectorType F1;
   VectorType F2;    /*!< \brief Menter blending function for blending of k-w and k-eps. */
   VectorType CDkw;  /*!< \brief Cross-diffusion. */
+  VectorType DES_LengthScale; /*!< \brief Length scale of the hybrid RANS/LES modes. */
   SST_ParsedOptions sstParsedOptions;
 public:
   /*!
@@ -78,13 +79,46 @@ public:
    */
   inline su2double GetF1blending(unsigned long iPoint) const override { return F1(iPoint); }
 
+  /*!
+   * \brief Get the first blending function of all points.
+   */
+  inline const VectorType& GetF1blending() const { return F1; }
+
   /*!
    * \brief Get the second blending function.
    */
   inline su2double GetF2blending(unsigned long iPoint) const override { return F2(iPoint); }
 
+  /*!
+   * \brief Get the second blending function of all points.
+   */
+  inline const VectorType& GetF2blending() const { return F2; }
+
   /*!
    * \brief Get the value of the cross diffusion of tke and omega.
    */
   inline su2double GetCrossDiff(unsigned long iPoint) const override { return CDkw(iPoint); }
+
+  /*!
+   * \brief Get the cross diffusion of all points.
+   */
+  inline const VectorType& GetCrossDiff() const { return CDkw; }
+
+  /*!
+   * \brief Get the DES length scale
+   * \param[in] iPoint - Point index.
+   * \return Value of the DES length Scale.
+   */
+  inline su2double GetDES_LengthScale(unsigned long iPoint) const override { return DES_LengthScale(iPoint); }
+
+  /*!
+   * \brief Get the DES length scale of all points.
+   */
+  inline const VectorType& GetDES_LengthScale() const { return DES_LengthScale; }
+
+  /*!
+   * \brief Set the DES Length Scale.
+   * \param[in] iPoint - Point index.
+   */
+  inline void SetDES_LengthScale(unsigned long iPoint, su2double val_des_lengthscale) override { DES_LengthScale(iPoint) = val_des_lengthscale; }
 };
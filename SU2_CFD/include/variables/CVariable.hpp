@@ -358,8 +358,10 @@ public:
   /*!
    * \brief A virtual member.
    * \param[in] iPoint - Point index.
+   * \param[in] val_wall_dist - Wall distance.
+   * \param[in] val_cd1 - Constant of the DDES shielding function (8 for SA, 20 for SST).
    */
-  inline virtual void SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall_dist) {}
+  inline virtual void SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall_dist, su2double val_cd1) {}
 
   /*!
    * \brief A virtual member.
@@ -716,6 +718,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -762,6 +765,7 @@ public:
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
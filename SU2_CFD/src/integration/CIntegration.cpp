@@ -205,7 +205,14 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
       solver_container[MainSolver]->ExplicitEuler_Iteration(geometry, solver_container, config);
       break;
     case (EULER_IMPLICIT):
-      solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
+      /*--- In coupled mode the flow and turbulence systems are only assembled here,
+       *    they are solved together by CTurbSolver::CoupledImplicitIteration. ---*/
+      if (config->GetCoupledTurbSolve() &&
+          (RunTime_EqSystem == RUNTIME_FLOW_SYS || RunTime_EqSystem == RUNTIME_TURB_SYS)) {
+        solver_container[MainSolver]->PrepareImplicitIteration(geometry, solver_container, config);
+      } else {
+        solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
+      }
       break;
   }
 
@@ -73,6 +73,11 @@ void CNewtonIntegration::Setup() {
   tolRelaxFactor = iparam[2];
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
+  frozenProducts = config->GetNewtonKrylovFrozenProducts();
+
+  const auto lagParam = config->GetNewtonKrylovPrecLagParam();
+  precondLagging.Setup(static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec()), lagParam[0],
+                       lagParam[1], SU2_TYPE::GetValue(config->GetNewtonKrylovPrecLagRateFactor()));
 
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
@@ -120,11 +125,17 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
 
   /*--- Save the default integration scheme, and force to explicit if required. ---*/
   auto TimeIntScheme = config->GetKind_TimeIntScheme();
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
   }
 
-  solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  /*--- The gradients, limiters, etc. of the unperturbed solution are consistent with the
+   * current residual, so they can be reused to evaluate products at a fraction of the cost. ---*/
+  if (type == ResEvalType::FROZEN) {
+    solvers[FLOW_SOL]->FrozenPreprocessing(geometry, solvers, config, MESH_0, RUNTIME_FLOW_SYS);
+  } else {
+    solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  }
 
   if (type == ResEvalType::DEFAULT) {
     solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
@@ -133,7 +144,7 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
   Space_Integration(geometry, solvers, numerics[FLOW_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
 
   /*--- Restore default. ---*/
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
   }
 
@@ -189,7 +200,12 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
 
-  if (preconditioner) preconditioner->Build();
+  /*--- During the startup period the preconditioner is the linear solver, it is always rebuilt. ---*/
+  const bool rebuildPrecond = startupPeriod || precondLagging.IsStale();
+
+  if (preconditioner && rebuildPrecond) preconditioner->Build();
+
+  solvers[FLOW_SOL]->Jacobian.UpdateSELLValues();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
@@ -247,6 +263,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
     solvers[FLOW_SOL]->SetIterLinSolver(iter);
     solvers[FLOW_SOL]->SetResLinSolver(eps);
+    precondLagging.Update(rebuildPrecond, !startupPeriod, iter, SU2_TYPE::GetValue(eps * toleranceFactor));
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
@@ -293,7 +310,7 @@ void CNewtonIntegration::MatrixFreeProduct(const CSysVector<Scalar>& u, CSysVect
 
   PerturbSolution(u, factor);
 
-  ComputeResiduals(ResEvalType::EXPLICIT);
+  ComputeResiduals(frozenProducts ? ResEvalType::FROZEN : ResEvalType::EXPLICIT);
 
   /*--- Finalize product. ---*/
   factor = 1.0 / factor;
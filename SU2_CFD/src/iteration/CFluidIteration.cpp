@@ -96,6 +96,19 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
     config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_TURB_SYS);
     integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
                                                                       RUNTIME_TURB_SYS, val_iZone, val_iInst);
+
+    /*--- The flow and turbulence systems were only assembled, solve them together and update the eddy viscosity. ---*/
+
+    if (config[val_iZone]->GetCoupledTurbSolve()) {
+      auto* geometry_fine = geometry[val_iZone][val_iInst][MESH_0];
+      auto** solvers_fine = solver[val_iZone][val_iInst][MESH_0];
+
+      SU2_OMP_PARALLEL_(if(solvers_fine[TURB_SOL]->GetHasHybridParallel())) {
+        solvers_fine[TURB_SOL]->CoupledImplicitIteration(geometry_fine, solvers_fine, config[val_iZone]);
+        solvers_fine[TURB_SOL]->Postprocessing(geometry_fine, solvers_fine, config[val_iZone], MESH_0);
+      }
+      END_SU2_OMP_PARALLEL
+    }
   }
 
   if (config[val_iZone]->GetKind_Species_Model() != SPECIES_MODEL::NONE){
@@ -57,7 +57,7 @@ void CFVMOutput::AddCommonFVMOutputs(const CConfig *config) {
     AddVolumeOutput(key.str(), name.str(), "MULTIGRID", "Coarse mesh");
   }
 
-  if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+  if (config->GetKind_Linear_Solver_Prec() == LINELET || config->GetKind_Linear_Solver_Prec() == LINELET_ILU) {
     AddVolumeOutput("LINELET", "Linelet", "LINELET", "Mesh lines built for the line implicit preconditioner");
   }
 }
@@ -81,7 +81,7 @@ void CFVMOutput::LoadCommonFVMOutputs(const CConfig* config, const CGeometry* ge
     }
   }
 
-  if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+  if (config->GetKind_Linear_Solver_Prec() == LINELET || config->GetKind_Linear_Solver_Prec() == LINELET_ILU) {
     SetVolumeOutputValue("LINELET", iPoint, geometry->GetLineletInfo(config).lineletColor[iPoint]);
   }
 }
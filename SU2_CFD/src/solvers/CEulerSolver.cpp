@@ -1545,7 +1545,13 @@ void CEulerSolver::CommonPreprocessing(CGeometry *geometry, CSolver **solver_con
 
   /*--- Set the primitive variables ---*/
 
-  ompMasterAssignBarrier(ErrorCounter, 0);
+  SU2_OMP_MASTER
+  {
+    ErrorCounter = 0;
+    nodes->SetFrozenNonPhysicalEdgeCounter(false);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
 
   SU2_OMP_ATOMIC
   ErrorCounter += SetPrimitive_Variables(solver_container, config);
@@ -1643,6 +1649,35 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   }
 }
 
+void CEulerSolver::FrozenPreprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                       unsigned short iMesh, unsigned short RunTime_EqSystem) {
+
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool center = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED);
+  const bool center_lapl = (iMesh == MESH_0) && (config->GetKind_Centered_Flow() == CENTERED::JST ||
+                                                 config->GetKind_Centered_Flow() == CENTERED::JST_MAT);
+
+  /*--- The switch to first order reconstruction is frozen too, the non-physical points
+   *    are not counted since this is not a new state of the solution. ---*/
+
+  SU2_OMP_MASTER
+  nodes->SetFrozenNonPhysicalEdgeCounter(true);
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SetPrimitive_Variables(solver_container, config);
+
+  /*--- The undivided Laplacian is linear in the solution, the sensor and the spectral radius are not updated. ---*/
+
+  if (center && center_lapl) SetUndivided_Laplacian(geometry, config);
+
+  if (!ReducerStrategy) {
+    LinSysRes.SetValZero();
+    if (implicit) Jacobian.SetValZero();
+    else {SU2_OMP_BARRIER}
+  }
+}
+
 unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
   /*--- Number of non-physical points, local to the thread, needs
@@ -1733,8 +1768,22 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                          (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool low_mach_corr = config->Low_Mach_Correction();
 
-  /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  /*--- Use vectorization if the scheme supports it. Roe is always vectorized, the
+   *    other schemes only when requested via USE_VECTORIZATION. ---*/
+  bool vectorized = false;
+  switch (config->GetKind_Upwind_Flow()) {
+    case UPWIND::ROE:
+      vectorized = ideal_gas && !low_mach_corr;
+      break;
+    case UPWIND::HLLC:
+    case UPWIND::AUSMPLUSUP: case UPWIND::AUSMPLUSUP2:
+    case UPWIND::SLAU: case UPWIND::SLAU2:
+      vectorized = ideal_gas && !low_mach_corr && config->GetUseVectorization();
+      break;
+    default:
+      break;
+  }
+  if (vectorized) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
@@ -35,6 +35,7 @@
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/fluid/CFluidScalar.hpp"
 #include "../../include/fluid/CFluidModel.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 
 CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh,
@@ -235,6 +236,24 @@ CIncEulerSolver::~CIncEulerSolver(void) {
   for(auto& model : FluidModel) delete model;
 }
 
+void CIncEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+
+  if (solver_container[TURB_SOL])
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel, solver_container[TURB_SOL]->GetNodes());
+  else
+    edgeNumerics = CNumericsSIMD::CreateNumerics(*config, nDim, MGLevel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme in use does not "
+                   "support vectorization.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CIncEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
   su2double Temperature_FreeStream = 0.0,  ModVel_FreeStream = 0.0,Energy_FreeStream = 0.0,
@@ -1157,6 +1176,14 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
 void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                       CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Use vectorization if requested and the scheme supports it. The mass fluxes
+   *    used by bounded scalar transport are only stored by the scalar implementation. ---*/
+  if (config->GetUseVectorization() && config->GetKind_Upwind_Flow() == UPWIND::FDS &&
+      !config->GetBounded_Scalar()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
@@ -48,6 +48,29 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   Buffet_Metric.resize(nMarker, 0.0);
   Surface_Buffet_Metric.resize(config->GetnMarker_Monitoring(), 0.0);
 
+  /*--- Wall models of the markers that use them (the grid of the model is built once). ---*/
+
+  WallModel.resize(nMarker);
+  WallModelHeight.resize(nMarker);
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (!config->GetViscous_Wall(iMarker)) continue;
+
+    const auto Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+
+    switch (config->GetWallFunction_Treatment(Marker_Tag)) {
+      case WALL_FUNCTIONS::EQUILIBRIUM_MODEL:
+        WallModel[iMarker] = unique_ptr<CWallModel>(new CWallModel1DEQ(config, Marker_Tag));
+        break;
+      case WALL_FUNCTIONS::LOGARITHMIC_MODEL:
+        WallModel[iMarker] = unique_ptr<CWallModel>(new CWallModelLogLaw(config, Marker_Tag));
+        break;
+      default:
+        break;
+    }
+    if (WallModel[iMarker]) WallModelHeight[iMarker].resize(nVertex[iMarker], 0.0);
+  }
+  SetWallModelExchange(geometry);
+
   /*--- Read farfield conditions from config ---*/
 
   Viscosity_Inf   = config->GetViscosity_FreeStreamND();
@@ -296,6 +319,10 @@ void CNSSolver::SetRoe_Dissipation(CGeometry *geometry, CConfig *config){
 
   const unsigned short kind_roe_dissipation = config->GetKind_RoeLowDiss();
 
+  /*--- The FD blending uses the shielding function of the DDES variant in use. ---*/
+  const auto kind_hybridRANSLES = config->GetKind_HybridRANSLES();
+  const su2double cd1 = (kind_hybridRANSLES == SST_DDES || kind_hybridRANSLES == SST_IDDES) ? 20.0 : 8.0;
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
 
@@ -303,7 +330,7 @@ void CNSSolver::SetRoe_Dissipation(CGeometry *geometry, CConfig *config){
 
       su2double wall_distance = geometry->nodes->GetWall_Distance(iPoint);
 
-      nodes->SetRoe_Dissipation_FD(iPoint, wall_distance);
+      nodes->SetRoe_Dissipation_FD(iPoint, wall_distance, cd1);
 
     } else if (kind_roe_dissipation == NTS || kind_roe_dissipation == NTS_DUCROS) {
 
@@ -809,10 +836,21 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
   const su2double kappa = config->GetwallModel_Kappa();
   const su2double B = config->GetwallModel_B();
 
+  /*--- The exchange locations of the wall models move with the grid. ---*/
+
+  if (dynamic_grid) SetWallModelExchange(geometry);
+
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
 
     if (!config->GetViscous_Wall(iMarker)) continue;
 
+    /*--- Markers with a wall model (equilibrium or logarithmic law). ---*/
+
+    if (WallModel[iMarker]) {
+      smallYPlusCounter += SetTau_Wall_WM(geometry, config, iMarker);
+      continue;
+    }
+
     /*--- Identify the boundary by string name ---*/
 
     const auto Marker_Tag = config->GetMarker_All_TagBound(iMarker);
@@ -930,6 +968,10 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
         continue;
       }
 
+      /*--- Warm start the Newton iterations from the friction velocity of the previous iteration. ---*/
+
+      if (UTau[iMarker][iVertex] > 0.0) U_Tau = UTau[iMarker][iVertex];
+
       /*--- Convergence criterium for the Newton solver, note that 1e-10 is too large ---*/
       const su2double tol = 1e-12;
       while (fabs(diff) > tol) {
@@ -1055,3 +1097,115 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
   }
 
 }
+
+void CNSSolver::SetWallModelExchange(const CGeometry *geometry) {
+
+  /*--- The exchange location of a vertex is its normal neighbor, store the distance to it
+   *    such that the (normalized) grid of the wall model can be scaled to each vertex. ---*/
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+
+    if (!WallModel[iMarker]) continue;
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+
+      su2double WallDist[MAXNDIM] = {0.0};
+      GeometryToolbox::Distance(nDim, geometry->nodes->GetCoord(iPoint),
+                                geometry->nodes->GetCoord(Point_Normal), WallDist);
+
+      WallModelHeight[iMarker][iVertex] = GeometryToolbox::Norm(int(MAXNDIM), WallDist);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+unsigned long CNSSolver::SetTau_Wall_WM(const CGeometry *geometry, const CConfig *config, unsigned short iMarker) {
+
+  const su2double Gas_Constant = config->GetGas_ConstantND();
+  const su2double kappa = config->GetwallModel_Kappa();
+  const su2double minYPlus = config->GetwallModel_MinYPlus();
+
+  const auto Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+  const bool HeatFlux_Prescribed = (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX);
+  const bool Temperature_Prescribed = (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL);
+
+  su2double q_w = 0.0;
+  if (HeatFlux_Prescribed) q_w = config->GetWall_HeatFlux(Marker_Tag) / config->GetHeat_Flux_Ref();
+
+  const CWallModel* wallModel = WallModel[iMarker].get();
+  CFluidModel* fluidModel = GetFluidModel();
+
+  unsigned long smallYPlusCounter = 0;
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+    /*--- Wall-parallel velocity at the exchange location. ---*/
+
+    const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+    const su2double Area = GeometryToolbox::Norm(nDim, Normal);
+
+    su2double UnitNormal[MAXNDIM] = {0.0}, Vel[MAXNDIM] = {0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      UnitNormal[iDim] = -Normal[iDim]/Area;
+      Vel[iDim] = nodes->GetVelocity(Point_Normal,iDim);
+    }
+    const su2double VelNormal = GeometryToolbox::DotProduct(int(MAXNDIM), Vel, UnitNormal);
+
+    su2double VelTang[MAXNDIM] = {0.0};
+    for (auto iDim = 0u; iDim < nDim; iDim++)
+      VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
+
+    const su2double VelTangMod = GeometryToolbox::Norm(int(MAXNDIM), VelTang);
+
+    const su2double hExchange = WallModelHeight[iMarker][iVertex];
+    const su2double T_Normal = nodes->GetTemperature(Point_Normal);
+    const su2double P_Normal = nodes->GetPressure(Point_Normal);
+    const su2double Lam_Visc_Normal = nodes->GetLaminarViscosity(Point_Normal);
+    const su2double T_Wall = nodes->GetTemperature(iPoint);
+
+    /*--- The pressure is constant across the boundary layer. ---*/
+
+    su2double Density_Wall = P_Normal / (Gas_Constant * T_Wall);
+
+    /*--- Warm start the model from the friction velocity of the previous iteration. ---*/
+
+    su2double tauWall = Density_Wall * pow(UTau[iMarker][iVertex], 2);
+    su2double qWall = 0.0, muWall = 0.0, kOverCvWall = 0.0;
+
+    wallModel->WallShearStressAndHeatFlux_FVM(hExchange, T_Normal, VelTangMod, Lam_Visc_Normal, P_Normal,
+                                              q_w, HeatFlux_Prescribed, T_Wall, Temperature_Prescribed,
+                                              fluidModel, tauWall, qWall, muWall, kOverCvWall);
+
+    const su2double U_Tau = sqrt(tauWall / Density_Wall);
+    const su2double Y_Plus = Density_Wall * U_Tau * hExchange / muWall;
+
+    YPlus[iMarker][iVertex] = Y_Plus;
+    UTau[iMarker][iVertex] = U_Tau;
+    EddyViscWall[iMarker][iVertex] = nodes->GetDensity(Point_Normal) * kappa * hExchange * U_Tau *
+                                     pow(1.0 - exp(-Y_Plus / 17.0), 2);
+
+    /*--- Automatic switch off when y+ < "limit", the wall shear stress is then
+     *    computed from the velocity gradient at the wall. ---*/
+
+    if (Y_Plus < minYPlus) {
+      smallYPlusCounter++;
+      nodes->SetTau_Wall(iPoint, -1.0);
+      continue;
+    }
+
+    nodes->SetTau_Wall(iPoint, tauWall);
+  }
+  END_SU2_OMP_FOR
+
+  return smallYPlusCounter;
+}
@@ -303,6 +303,10 @@ void CSpeciesSolver::Preprocessing(CGeometry* geometry, CSolver** solver_contain
   CommonPreprocessing(geometry, config, Output);
 }
 
+void CSpeciesSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, nVar, SPECIES_SOL, solvers);
+}
+
 void CSpeciesSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                       CNumerics* numerics, CConfig* config) {
   /*--- Define an object to set solver specific numerics contribution. ---*/
@@ -72,6 +72,7 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
+    InitializeCoupledSystem(geometry, config);
 
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
@@ -199,7 +200,7 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
     /*--- Compute the DES length scale ---*/
 
-    SetDES_LengthScale(solver_container, geometry, config);
+    ComputeDES_LengthScale(geometry, solver_container, config, 8.0);
 
   }
 
@@ -291,6 +292,35 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
   AD::EndNoSharedReading();
 }
 
+void CTurbSASolver::EddyViscosityDerivatives(unsigned long iPoint, const CGeometry* geometry, const CVariable* flowNodes,
+                                             const CConfig* config, su2double* dmuT) const {
+
+  /*--- Derivative of muT = rho * fv1 * nu_hat (see Postprocessing). ---*/
+
+  const su2double cv1_3 = 7.1*7.1*7.1, cR1 = 0.5, rough_const = 0.03;
+
+  const su2double rho = flowNodes->GetDensity(iPoint);
+  const su2double nu = flowNodes->GetLaminarViscosity(iPoint) / rho;
+  const su2double nu_hat = nodes->GetSolution(iPoint,0);
+  const su2double roughness = geometry->nodes->GetRoughnessHeight(iPoint);
+  const su2double dist = geometry->nodes->GetWall_Distance(iPoint) + rough_const * roughness;
+
+  if (config->GetSAParsedOptions().version == SA_OPTIONS::NEG && nu_hat < 0.0) {
+    dmuT[0] = 0.0;
+    return;
+  }
+
+  su2double Ji = nu_hat/nu;
+  if (roughness > 1.0e-10)
+    Ji += cR1*roughness/(dist+EPS);
+
+  const su2double Ji_3 = Ji*Ji*Ji;
+  const su2double fv1 = Ji_3/(Ji_3+cv1_3);
+  const su2double dfv1 = 3*Ji*Ji*cv1_3/pow(Ji_3+cv1_3, 2);
+
+  dmuT[0] = rho * (fv1 + nu_hat/nu * dfv1);
+}
+
 void CTurbSASolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                      CNumerics* numerics, CConfig* config) {
 
@@ -312,6 +342,29 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   const bool harmonic_balance = (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
   const bool transition_BC = config->GetSAParsedOptions().bc;
 
+  /*--- Harmonic balance sources are added first, the vectorized path below returns early. ---*/
+
+  if (harmonic_balance) {
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      su2double Volume = geometry->nodes->GetVolume(iPoint);
+
+      /*--- Access stored harmonic balance source term ---*/
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
+        LinSysRes(iPoint,iVar) += Source*Volume;
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Use the vectorized source terms if the model and options in use support them. ---*/
+
+  if (VectorizedSourceResidual(geometry, solver_container, config)) return;
+
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
 
   /*--- Pick one numerics object per thread. ---*/
@@ -402,23 +455,6 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   }
   END_SU2_OMP_FOR
 
-  if (harmonic_balance) {
-
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-
-      su2double Volume = geometry->nodes->GetVolume(iPoint);
-
-      /*--- Access stored harmonic balance source term ---*/
-
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        su2double Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
-        LinSysRes(iPoint,iVar) += Source*Volume;
-      }
-    }
-    END_SU2_OMP_FOR
-  }
-
   AD::EndNoSharedReading();
 
 }
@@ -1308,186 +1344,6 @@ void CTurbSASolver::SetTurbVars_WF(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
-void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config){
-
-  const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
-
-  const su2double constDES = config->GetConst_DES();
-
-  const su2double fw_star = 0.424, cv1_3 = pow(7.1, 3), k2 = pow(0.41, 2);
-  const su2double cb1   = 0.1355, ct3 = 1.2, ct4 = 0.5;
-  const su2double sigma = 2./3., cb2 = 0.622, f_max = 1.0, f_min = 0.1, a1 = 0.15, a2 = 0.3;
-
-  auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver[FLOW_SOL]->GetNodes());
-
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++){
-
-    const auto coord_i       = geometry->nodes->GetCoord(iPoint);
-    const auto nNeigh        = geometry->nodes->GetnPoint(iPoint);
-    const auto wallDistance  = geometry->nodes->GetWall_Distance(iPoint);
-    const auto velocityGrad  = flowNodes->GetVelocityGradient(iPoint);
-    const auto vorticity     = flowNodes->GetVorticity(iPoint);
-    const auto density       = flowNodes->GetDensity(iPoint);
-    const auto laminarViscosity = flowNodes->GetLaminarViscosity(iPoint);
-    const auto eddyViscosity    = nodes->GetmuT(iPoint);
-    const su2double kinematicViscosity     = laminarViscosity/density;
-    const su2double kinematicViscosityTurb = eddyViscosity/density;
-
-    su2double uijuij = 0.0;
-    for(auto iDim = 0u; iDim < nDim; iDim++){
-      for(auto jDim = 0u; jDim < nDim; jDim++){
-        uijuij += pow(velocityGrad[iDim][jDim], 2);
-      }
-    }
-    uijuij = sqrt(fabs(uijuij));
-    uijuij = max(uijuij,1e-10);
-
-    /*--- Low Reynolds number correction term ---*/
-
-    const su2double nu_hat = nodes->GetSolution(iPoint,0);
-    const su2double Ji   = nu_hat/kinematicViscosity;
-    const su2double Ji_2 = Ji * Ji;
-    const su2double Ji_3 = Ji*Ji*Ji;
-    const su2double fv1  = Ji_3/(Ji_3+cv1_3);
-    const su2double fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    const su2double ft2 = ct3*exp(-ct4*Ji_2);
-    const su2double cw1 = cb1/k2+(1.0+cb2)/sigma;
-
-    su2double psi_2 = (1.0 - (cb1/(cw1*k2*fw_star))*(ft2 + (1.0 - ft2)*fv2))/(fv1 * max(1.0e-10,1.0-ft2));
-    psi_2 = min(100.0,psi_2);
-
-    su2double lengthScale = 0.0;
-
-    switch(kindHybridRANSLES){
-      case SA_DES: {
-        /*--- Original Detached Eddy Simulation (DES97)
-        Spalart
-        1997
-        ---*/
-
-        const su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
-        const su2double distDES = constDES * maxDelta;
-        lengthScale = min(distDES,wallDistance);
-
-        break;
-      }
-      case SA_DDES: {
-        /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
-         Spalart et al.
-         Theoretical and Computational Fluid Dynamics - 2006
-         ---*/
-
-        const su2double maxDelta = geometry->nodes->GetMaxLength(iPoint);
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-
-        const su2double distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-
-        break;
-      }
-      case SA_ZDES: {
-        /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
-         Deck
-         Theoretical and Computational Fluid Dynamics - 2012
-         ---*/
-
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
-
-        su2double delta[MAXNDIM] = {}, ratioOmega[MAXNDIM] = {};
-
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            const su2double deltaAux = abs(coord_j[iDim] - coord_i[iDim]);
-            delta[iDim] = max(delta[iDim], deltaAux);
-          }
-        }
-
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
-
-        for (auto iDim = 0u; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-
-        su2double maxDelta = sqrt(pow(ratioOmega[0], 2)*delta[1]*delta[2] +
-                                  pow(ratioOmega[1], 2)*delta[0]*delta[2] +
-                                  pow(ratioOmega[2], 2)*delta[0]*delta[1]);
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-
-        if (f_d < 0.99){
-          maxDelta = deltaDDES;
-        }
-
-        const su2double distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-
-        break;
-      }
-      case SA_EDDES: {
-        /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
-         Shur et al.
-         Flow Turbulence Combust - 2015
-         ---*/
-
-        su2double vortexTiltingMeasure = nodes->GetVortex_Tilting(iPoint);
-
-        const su2double omega = GeometryToolbox::Norm(3, vorticity);
-
-        su2double ratioOmega[MAXNDIM] = {};
-
-        for (auto iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-
-        const su2double deltaDDES = geometry->nodes->GetMaxLength(iPoint);
-
-        su2double ln_max = 0.0;
-        for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
-          const auto coord_j = geometry->nodes->GetCoord(jPoint);
-          su2double delta[MAXNDIM] = {};
-          for (auto iDim = 0u; iDim < nDim; iDim++){
-            delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);
-          }
-          su2double ln[3];
-          ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
-          ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
-          ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
-          const su2double aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
-          ln_max = max(ln_max, aux_ln);
-          vortexTiltingMeasure += nodes->GetVortex_Tilting(jPoint);
-        }
-        vortexTiltingMeasure /= (nNeigh + 1);
-
-        const su2double f_kh = max(f_min,
-                                   min(f_max,
-                                       f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
-
-        const su2double r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        const su2double f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-
-        su2double maxDelta = (ln_max/sqrt(3.0)) * f_kh;
-        if (f_d < 0.999){
-          maxDelta = deltaDDES;
-        }
-
-        const su2double distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-
-        break;
-      }
-    }
-
-    nodes->SetDES_LengthScale(iPoint, lengthScale);
-
-  }
-  END_SU2_OMP_FOR
-}
-
 void CTurbSASolver::SetInletAtVertex(const su2double *val_inlet,
                                     unsigned short iMarker,
                                     unsigned long iVertex) {
@@ -1561,7 +1417,7 @@ void CTurbSASolver::SetUniformInlet(const CConfig* config, unsigned short iMarke
   }
 }
 
-void CTurbSASolver::ComputeUnderRelaxationFactor(const CConfig *config) {
+void CTurbSASolver::ComputeUnderRelaxationFactor(CSolver**, const CConfig *config) {
 
   /* Apply the turbulent under-relaxation to the SA variants. The
    SA_NEG model is more robust due to allowing for negative nu_tilde,
@@ -40,6 +40,7 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
   bool multizone = config->GetMultizone_Problem();
   sstParsedOptions = config->GetSSTParsedOptions();
+  wilcoxKOmega = (config->GetKind_Turb_Model() == TURB_MODEL::KW);
 
   /*--- Dimension of the problem --> dependent on the turbulence model. ---*/
 
@@ -74,6 +75,7 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     System.SetxIsZero(true);
+    InitializeCoupledSystem(geometry, config);
 
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
@@ -190,6 +192,13 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
 
   /*--- Upwind second order reconstruction and gradients ---*/
   CommonPreprocessing(geometry, config, Output);
+
+  /*--- Compute the DES length scale of the hybrid RANS/LES modes, the shielding function
+   *    uses the constant of the SST-based models. ---*/
+
+  if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+    ComputeDES_LengthScale(geometry, solver_container, config, 20.0);
+  }
 }
 
 void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
@@ -276,6 +285,77 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
   AD::EndNoSharedReading();
 }
 
+void CTurbSSTSolver::EddyViscosityDerivatives(unsigned long iPoint, const CGeometry* geometry, const CVariable* flowNodes,
+                                              const CConfig* config, su2double* dmuT) const {
+
+  /*--- Derivatives of muT = rho * a1 * k / max(a1 * omega, S * F2) (see Postprocessing) w.r.t. the
+   *    transported variables rho*k and rho*omega. ---*/
+
+  const su2double a1 = constants[7], beta_star = constants[6];
+
+  const su2double VorticityMag = max(GeometryToolbox::Norm(3, flowNodes->GetVorticity(iPoint)), 1e-12);
+  const su2double StrainMag = max(nodes->GetStrainMag(iPoint), 1e-12);
+  const su2double F2 = nodes->GetF2blending(iPoint);
+
+  const su2double kine = nodes->GetSolution(iPoint,0);
+  const su2double omega = nodes->GetSolution(iPoint,1);
+
+  const auto& eddy_visc_var = sstParsedOptions.version == SST_OPTIONS::V1994 ? VorticityMag : StrainMag;
+
+  if (kine <= 0.0) {
+    dmuT[0] = dmuT[1] = 0.0;
+    return;
+  }
+  if (a1 * omega >= eddy_visc_var * F2) {
+    dmuT[0] = 1.0 / omega;
+    dmuT[1] = -kine / pow(omega, 2);
+    return;
+  }
+
+  /*--- Strain limited, F2 = tanh(arg2^2) also depends on k and omega (see CTurbSSTVariable::SetBlendingFunc). ---*/
+
+  const su2double rho = flowNodes->GetDensity(iPoint);
+  const su2double mu = flowNodes->GetLaminarViscosity(iPoint);
+  const su2double dist = geometry->nodes->GetWall_Distance(iPoint);
+
+  const su2double arg2A = 2.0*sqrt(kine)/(beta_star*omega*dist+EPS*EPS);
+  const su2double arg2B = 500.0*mu / (rho*dist*dist*omega+EPS*EPS);
+  const su2double arg2 = max(arg2A, arg2B);
+
+  const su2double dF2_darg2 = 2.0 * arg2 * (1.0 - pow(F2, 2));
+  const su2double dF2_dk = (arg2A >= arg2B) ? dF2_darg2 * 0.5 * arg2 / kine : 0.0;
+  const su2double dF2_domega = -dF2_darg2 * arg2 / omega;
+
+  const su2double muT_rho = a1 * kine / (eddy_visc_var * F2);
+
+  dmuT[0] = a1 / (eddy_visc_var * F2) - muT_rho / F2 * dF2_dk;
+  dmuT[1] = -muT_rho / F2 * dF2_domega;
+}
+
+Double CTurbSSTSolver::DES_RANSLengthScale(Int iPoint, Double) const {
+
+  /*--- Turbulence length scale of the k-omega model, l = k^(1/2) / (beta_star * omega), see
+   *    Gritskevich et al., Flow Turbulence Combust - 2012. ---*/
+
+  const su2double beta_star = constants[6];
+
+  Double kine, omega;
+  for (auto k = 0ul; k < Double::Size; ++k) {
+    kine[k] = nodes->GetSolution(iPoint[k], 0);
+    omega[k] = nodes->GetSolution(iPoint[k], 1);
+  }
+  return sqrt(kine) / (beta_star * omega);
+}
+
+Double CTurbSSTSolver::DES_Constant(Int iPoint, su2double) const {
+
+  if (wilcoxKOmega) return 0.78;
+
+  Double F1;
+  for (auto k = 0ul; k < Double::Size; ++k) F1[k] = nodes->GetF1blending(iPoint[k]);
+  return 0.78 * F1 + 0.61 * (1.0 - F1);
+}
+
 void CTurbSSTSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                                      CNumerics* numerics, CConfig* config) {
 
@@ -293,6 +373,10 @@ void CTurbSSTSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
 void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Use the vectorized source terms if the model and options in use support them. ---*/
+
+  if (VectorizedSourceResidual(geometry, solver_container, config)) return;
+
   bool axisymmetric = config->GetAxisymmetric();
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -348,6 +432,10 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
 
     numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint));
 
+    /*--- Length scale of the hybrid RANS/LES modes ---*/
+
+    numerics->SetDES_LengthScale(nodes->GetDES_LengthScale(iPoint));
+
     /*--- Effective Intermittency ---*/
     if (config->GetKind_Trans_Model() == TURB_TRANS_MODEL::LM) {
       numerics->SetIntermittencyEff(solver_container[TRANS_SOL]->GetNodes()->GetIntermittencyEff(iPoint));
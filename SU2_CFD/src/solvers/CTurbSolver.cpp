@@ -29,6 +29,7 @@
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.inl"
+#include "../../include/numerics_simd/util.hpp"
 
 /*--- Explicit instantiation of the parent class of CTurbSolver. ---*/
 template class CScalarSolver<CTurbVariable>;
@@ -40,11 +41,434 @@ CTurbSolver::CTurbSolver(CGeometry* geometry, CConfig *config, bool conservative
 }
 
 CTurbSolver::~CTurbSolver() {
+  delete sourceNumerics;
+
   for (auto& mat : SlidingState) {
     for (auto ptr : mat) delete [] ptr;
   }
 }
 
+void CTurbSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, nVar, TURB_SOL, solvers);
+}
+
+bool CTurbSolver::VectorizedSourceResidual(const CGeometry* geometry, const CSolver* const* solvers,
+                                           const CConfig* config) {
+  if (!sourceNumericsCreated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      sourceNumerics = CSourceSIMD::CreateTurbSource(*config, nDim, solvers);
+      sourceNumericsCreated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  if (!sourceNumerics) return false;
+
+  AD::StartNoSharedReading();
+
+  /*--- Groups of Double::Size contiguous points, the lanes past the last domain point
+   *    repeat the first point of the group and are masked out of the update. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, Double::Size))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint += Double::Size) {
+    Int points;
+    Double mask;
+    for (auto k = 0ul; k < Double::Size; ++k) {
+      bool in = (iPoint + k < nPointDomain);
+      mask[k] = in;
+      points[k] = iPoint + k * in;
+    }
+    sourceNumerics->ComputeResidual(points, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+
+  return true;
+}
+
+void CTurbSolver::ComputeDES_LengthScale(const CGeometry* geometry, const CSolver* const* solvers,
+                                         const CConfig* config, su2double cd1) {
+
+  const auto kindHybridRANSLES = config->GetKind_HybridRANSLES();
+
+  const su2double constDES = config->GetConst_DES();
+  const su2double k2 = pow(0.41, 2);
+  const su2double f_max = 1.0, f_min = 0.1, a1 = 0.15, a2 = 0.3;
+
+  const CVariable* flowNodes = solvers[FLOW_SOL]->GetNodes();
+  const CPoint* points = geometry->nodes;
+
+  AD::StartNoSharedReading();
+
+  /*--- Groups of Double::Size contiguous points, the lanes past the last domain point
+   *    repeat the first point of the group and are not stored. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, Double::Size))
+  for (auto iPointGroup = 0ul; iPointGroup < nPointDomain; iPointGroup += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto k = 0ul; k < Double::Size; ++k) {
+      bool in = (iPointGroup + k < nPointDomain);
+      mask[k] = in;
+      iPoint[k] = iPointGroup + k * in;
+    }
+
+    Double wallDistance, maxLength, nuLam, nuTurb, uijuij, vorticity[3];
+    for (auto k = 0ul; k < Double::Size; ++k) {
+      const auto i = iPoint[k];
+      wallDistance[k] = points->GetWall_Distance(i);
+      maxLength[k] = points->GetMaxLength(i);
+      nuLam[k] = flowNodes->GetLaminarViscosity(i) / flowNodes->GetDensity(i);
+      nuTurb[k] = nodes->GetmuT(i) / flowNodes->GetDensity(i);
+
+      const auto velocityGrad = flowNodes->GetVelocityGradient(i);
+      uijuij[k] = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        for (auto jDim = 0u; jDim < nDim; jDim++) {
+          uijuij[k] += pow(velocityGrad[iDim][jDim], 2);
+        }
+      }
+      for (auto iDim = 0u; iDim < 3; iDim++) vorticity[iDim][k] = flowNodes->GetVorticity(i)[iDim];
+    }
+    uijuij = fmax(sqrt(uijuij), 1e-10);
+
+    /*--- Shielding function of the delayed variants. ---*/
+
+    const Double r_d = (nuLam + nuTurb) / (uijuij * k2 * pow(wallDistance, 2));
+    Double f_d = 1.0 - tanh(pow(cd1 * r_d, 3));
+
+    const Double ransLength = DES_RANSLengthScale(iPoint, wallDistance);
+    const Double cDES = DES_Constant(iPoint, constDES);
+
+    /*--- LES length scale. ---*/
+
+    Double delta = maxLength, lengthScale;
+
+    switch (kindHybridRANSLES) {
+      case SST_IDDES: {
+        /*--- A hybrid RANS-LES approach with delayed-DES and wall-modelled LES capabilities.
+         *    Shur et al., International Journal of Heat and Fluid Flow - 2008, with the SST constants of
+         *    Gritskevich et al., Flow Turbulence Combust - 2012. The wall normal step is approximated by the
+         *    shortest edge of the point. ---*/
+        const su2double cw = 0.15, cdt1 = 20.0, ct = 1.87, cl = 5.0;
+
+        Double hwn;
+        for (auto k = 0ul; k < Double::Size; ++k) hwn[k] = points->GetMinLength(iPoint[k]);
+        delta = fmin(fmax(fmax(cw * wallDistance, cw * maxLength), hwn), maxLength);
+
+        const Double den = uijuij * k2 * pow(wallDistance, 2);
+        const Double r_dt = nuTurb / den;
+        const Double r_dl = nuLam / den;
+
+        const Double alpha = 0.25 - wallDistance / maxLength;
+        const Double f_B = fmin(2.0 * exp(-9.0 * pow(alpha, 2)), 1.0);
+        const Double f_dt = 1.0 - tanh(pow(cdt1 * r_dt, 3));
+        const Double f_dTilde = fmax(1.0 - f_dt, f_B);
+
+        const Double f_e1 = blend(alpha >= 0.0, 2.0 * exp(-11.09 * pow(alpha, 2)), 2.0 * exp(-9.0 * pow(alpha, 2)));
+        const Double f_e2 = 1.0 - fmax(tanh(pow(ct * ct * r_dt, 3)), tanh(pow(cl * cl * r_dl, 10)));
+        const Double f_e = fmax(f_e1 - 1.0, 0.0) * f_e2;
+
+        lengthScale = f_dTilde * (1.0 + f_e) * ransLength + (1.0 - f_dTilde) * cDES * delta;
+        break;
+      }
+      case SA_DES:
+        /*--- Original Detached Eddy Simulation (DES97), Spalart 1997. ---*/
+        f_d = 1.0;
+        break;
+
+      case SA_ZDES: {
+        /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
+         *    Deck, Theoretical and Computational Fluid Dynamics - 2012 ---*/
+        const Double omega = sqrt(pow(vorticity[0], 2) + pow(vorticity[1], 2) + pow(vorticity[2], 2));
+
+        Double ratioOmega[3], maxDelta[3];
+        for (auto iDim = 0u; iDim < 3; iDim++) {
+          ratioOmega[iDim] = vorticity[iDim] / omega;
+          for (auto k = 0ul; k < Double::Size; ++k) {
+            maxDelta[iDim][k] = (iDim < nDim) ? points->GetMaxDelta(iPoint[k])[iDim] : 0.0;
+          }
+        }
+        const Double deltaOmega = sqrt(pow(ratioOmega[0], 2) * maxDelta[1] * maxDelta[2] +
+                                       pow(ratioOmega[1], 2) * maxDelta[0] * maxDelta[2] +
+                                       pow(ratioOmega[2], 2) * maxDelta[0] * maxDelta[1]);
+
+        delta = blend(f_d < 0.99, maxLength, deltaOmega);
+        break;
+      }
+      case SA_EDDES: {
+        /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
+         *    Shur et al., Flow Turbulence Combust - 2015 ---*/
+        Double lnMax, vortexTilting;
+
+        for (auto k = 0ul; k < Double::Size; ++k) {
+          const auto i = iPoint[k];
+          const su2double omega = GeometryToolbox::Norm(3, flowNodes->GetVorticity(i));
+
+          su2double ratioOmega[3] = {0.0};
+          for (auto iDim = 0u; iDim < 3; iDim++) ratioOmega[iDim] = vorticity[iDim][k] / omega;
+
+          su2double ln_max = 0.0, vortexTiltingMeasure = nodes->GetVortex_Tilting(i);
+          const auto nNeigh = points->GetnPoint(i);
+
+          for (auto iNeigh = 0u; iNeigh < nNeigh; iNeigh++) {
+            su2double deltaNeigh[3] = {0.0}, ln[3];
+            for (auto iDim = 0u; iDim < nDim; iDim++) deltaNeigh[iDim] = points->GetNeighborDelta(i, iNeigh)[iDim];
+            GeometryToolbox::CrossProduct(deltaNeigh, ratioOmega, ln);
+            ln_max = max(ln_max, GeometryToolbox::Norm(3, ln));
+            vortexTiltingMeasure += nodes->GetVortex_Tilting(points->GetPoint(i, iNeigh));
+          }
+          lnMax[k] = ln_max;
+          vortexTilting[k] = vortexTiltingMeasure / (nNeigh + 1);
+        }
+
+        const Double f_kh = fmax(f_min, fmin(f_max, f_min + ((f_max - f_min) / (a2 - a1)) * (vortexTilting - a1)));
+
+        delta = blend(f_d < 0.999, maxLength, lnMax / sqrt(3.0) * f_kh);
+        break;
+      }
+      default:
+        /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
+         *    Spalart et al., Theoretical and Computational Fluid Dynamics - 2006 ---*/
+        break;
+    }
+
+    if (kindHybridRANSLES != SST_IDDES) {
+      lengthScale = ransLength - f_d * fmax(0.0, ransLength - cDES * delta);
+    }
+
+    for (auto k = 0ul; k < Double::Size; ++k) {
+      if (mask[k] != 0) nodes->SetDES_LengthScale(iPoint[k], lengthScale[k]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+}
+
+void CTurbSolver::ComputePositivityPreservingUpdate(CSolver** solver_container, const CConfig* config) {
+
+  const bool compressible = (config->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    /*--- The increments are in terms of the conservative (transported) variables, the new conservative value is
+     *    Solution_Old * density_old + increment (see CompleteImplicitIteration). Its sign does not depend on the
+     *    new density, so the old one is also correct when the flow was updated first (COUPLED_TURB_SOLVE). ---*/
+
+    su2double density_old = 1.0;
+    if (Conservative) density_old = compressible ? flowNodes->GetSolution_Old(iPoint, 0) : flowNodes->GetDensity(iPoint);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double delta = LinSysSol(iPoint, iVar);
+      if (delta >= 0.0) continue;
+
+      /*--- U_new = U exp(dU/U) >= 0, i.e. the increment is relaxed by (exp(x)-1)/x, with x = dU/U. ---*/
+
+      const su2double U = max(nodes->GetSolution_Old(iPoint, iVar) * density_old, EPS);
+      LinSysSol(iPoint, iVar) = U * (exp(delta / U) - 1.0);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+void CTurbSolver::InitializeCoupledSystem(CGeometry* geometry, const CConfig* config) {
+
+  if (!config->GetCoupledTurbSolve()) return;
+
+  /*--- The compressible and incompressible flow solvers have nDim+2 variables. ---*/
+  nVarFlow = nDim + 2;
+  const auto nVarTot = nVarFlow + nVar;
+
+  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (coupled flow and turbulence)." << endl;
+  CoupledJacobian.Initialize(nPoint, nPointDomain, nVarTot, nVarTot, true, geometry, config);
+  CoupledLinSysSol.Initialize(nPoint, nPointDomain, nVarTot, 0.0);
+  CoupledLinSysRes.Initialize(nPoint, nPointDomain, nVarTot, 0.0);
+  CoupledSystem.SetxIsZero(true);
+}
+
+void CTurbSolver::CoupledImplicitIteration(CGeometry* geometry, CSolver** solver_container, CConfig* config) {
+
+  CSolver* flowSolver = solver_container[FLOW_SOL];
+  const CVariable* flowNodes = flowSolver->GetNodes();
+
+  const bool compressible = (config->GetKind_Regime() == ENUM_REGIME::COMPRESSIBLE);
+  const bool energy = compressible || config->GetEnergy_Equation();
+  const bool dynamic_grid = config->GetDynamic_Grid();
+  const su2double prandtlTurb = config->GetPrandtl_Turb();
+  const unsigned short nVarTot = nVarFlow + nVar;
+
+  /*--- Copy the blocks of the segregated systems to the diagonal sub-blocks of the coupled system. ---*/
+
+  auto copySegregatedBlocks = [&](unsigned long iPoint, unsigned long jPoint) {
+    auto* block = CoupledJacobian.GetBlock(iPoint, jPoint);
+    const auto* flowBlock = flowSolver->Jacobian.GetBlock(iPoint, jPoint);
+    const auto* turbBlock = Jacobian.GetBlock(iPoint, jPoint);
+    for (auto iVar = 0u; iVar < nVarFlow; ++iVar)
+      for (auto jVar = 0u; jVar < nVarFlow; ++jVar)
+        block[iVar*nVarTot + jVar] = flowBlock[iVar*nVarFlow + jVar];
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      for (auto jVar = 0u; jVar < nVar; ++jVar)
+        block[(nVarFlow+iVar)*nVarTot + nVarFlow+jVar] = turbBlock[iVar*nVar + jVar];
+  };
+
+  /*--- Chain rule from the velocity at kPoint to the flow unknowns (conservative or primitive),
+   *    "coeff" is the derivative of the residual at row "iRow" w.r.t. the velocity. ---*/
+
+  auto addVelocityDerivative = [&](unsigned long kPoint, unsigned short iRow, const su2double* coeff, su2double* block) {
+    su2double* row = &block[iRow*nVarTot];
+    if (compressible) {
+      const su2double rho = flowNodes->GetDensity(kPoint);
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        row[0] -= coeff[iDim] * flowNodes->GetVelocity(kPoint, iDim) / rho;
+        row[iDim+1] += coeff[iDim] / rho;
+      }
+    } else {
+      for (auto iDim = 0u; iDim < nDim; ++iDim) row[iDim+1] += coeff[iDim];
+    }
+  };
+
+  CoupledJacobian.SetValZero();
+
+  /*--- Assemble by rows, each thread only writes to the blocks of its points. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    su2double diagBlock[MAXNVARCOUPLED*MAXNVARCOUPLED] = {0.0}, offBlock[MAXNVARCOUPLED*MAXNVARCOUPLED];
+    su2double dmuT_i[MAXNVAR] = {0.0}, dmuT_j[MAXNVAR] = {0.0};
+
+    EddyViscosityDerivatives(iPoint, geometry, flowNodes, config, dmuT_i);
+
+    copySegregatedBlocks(iPoint, iPoint);
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh) {
+
+      const auto jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+      const auto iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
+
+      copySegregatedBlocks(iPoint, jPoint);
+      for (auto iVar = 0u; iVar < nVarTot*nVarTot; ++iVar) offBlock[iVar] = 0.0;
+
+      EddyViscosityDerivatives(jPoint, geometry, flowNodes, config, dmuT_j);
+
+      /*--- Normal pointing out of iPoint, and the distance vector i->j. ---*/
+
+      const su2double sign = (iPoint == geometry->edges->GetNode(iEdge, 0)) ? 1.0 : -1.0;
+      su2double normal[MAXNDIM] = {0.0}, dist[MAXNDIM] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        normal[iDim] = sign * geometry->edges->GetNormal(iEdge)[iDim];
+        dist[iDim] = geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim);
+      }
+      const su2double proj = GeometryToolbox::DotProduct(nDim, normal, dist) /
+                             GeometryToolbox::SquaredNorm(nDim, dist);
+
+      /*--- Turbulence rows, the upwind flux is q * psi_upwind, with q the face-normal velocity
+       *    (relative to the grid) and psi the transported quantity. ---*/
+
+      su2double q = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        su2double vel = 0.5 * (flowNodes->GetVelocity(iPoint, iDim) + flowNodes->GetVelocity(jPoint, iDim));
+        if (dynamic_grid) {
+          vel -= 0.5 * (geometry->nodes->GetGridVel(iPoint)[iDim] + geometry->nodes->GetGridVel(jPoint)[iDim]);
+        }
+        q += vel * normal[iDim];
+      }
+      const auto upPoint = (q > 0.0) ? iPoint : jPoint;
+      const su2double upDensity = Conservative ? flowNodes->GetDensity(upPoint) : 1.0;
+
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        su2double coeff[MAXNDIM] = {0.0};
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          coeff[iDim] = 0.5 * upDensity * nodes->GetSolution(upPoint, iVar) * normal[iDim];
+        }
+        addVelocityDerivative(iPoint, nVarFlow+iVar, coeff, diagBlock);
+        addVelocityDerivative(jPoint, nVarFlow+iVar, coeff, offBlock);
+      }
+
+      /*--- Flow rows, thin shear layer approximation of the viscous fluxes with the
+       *    arithmetic average of the eddy viscosity, the flux is subtracted from iPoint. ---*/
+
+      su2double coeff[MAXNVARCOUPLED] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        const su2double deltaVel = flowNodes->GetVelocity(jPoint, iDim) - flowNodes->GetVelocity(iPoint, iDim);
+        coeff[iDim+1] = -deltaVel * proj;
+        if (compressible) {
+          const su2double meanVel = 0.5 * (flowNodes->GetVelocity(iPoint, iDim) + flowNodes->GetVelocity(jPoint, iDim));
+          coeff[nVarFlow-1] -= deltaVel * meanVel * proj;
+        }
+      }
+      if (energy) {
+        const su2double meanCp = 0.5 * (flowNodes->GetSpecificHeatCp(iPoint) + flowNodes->GetSpecificHeatCp(jPoint));
+        const su2double deltaT = flowNodes->GetTemperature(jPoint) - flowNodes->GetTemperature(iPoint);
+        coeff[nVarFlow-1] -= meanCp / prandtlTurb * deltaT * proj;
+      }
+
+      for (auto iVar = 1u; iVar < nVarFlow; ++iVar) {
+        for (auto jVar = 0u; jVar < nVar; ++jVar) {
+          diagBlock[iVar*nVarTot + nVarFlow+jVar] += coeff[iVar] * 0.5 * dmuT_i[jVar];
+          offBlock[iVar*nVarTot + nVarFlow+jVar] += coeff[iVar] * 0.5 * dmuT_j[jVar];
+        }
+      }
+
+      CoupledJacobian.AddBlock(iPoint, jPoint, offBlock);
+    }
+
+    CoupledJacobian.AddBlock(iPoint, iPoint, diagBlock);
+
+    /*--- Right hand side (both were negated by PrepareImplicitIteration) and initial guess. ---*/
+
+    for (auto iVar = 0u; iVar < nVarFlow; ++iVar) {
+      CoupledLinSysRes(iPoint, iVar) = flowSolver->LinSysRes(iPoint, iVar);
+    }
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      CoupledLinSysRes(iPoint, nVarFlow+iVar) = LinSysRes(iPoint, iVar);
+    }
+    CoupledLinSysSol.SetBlock_Zero(iPoint);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_FOR_(schedule(static, OMP_MIN_SIZE) SU2_NOWAIT)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    CoupledLinSysRes.SetBlock_Zero(iPoint);
+    CoupledLinSysSol.SetBlock_Zero(iPoint);
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Solve the coupled system, the options are those of the flow linear solver. ---*/
+
+  auto iter = CoupledSystem.Solve(CoupledJacobian, CoupledLinSysRes, CoupledLinSysSol, geometry, config);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    flowSolver->SetIterLinSolver(iter);
+    flowSolver->SetResLinSolver(CoupledSystem.GetResidual());
+    SetIterLinSolver(iter);
+    SetResLinSolver(CoupledSystem.GetResidual());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (auto iVar = 0u; iVar < nVarFlow; ++iVar) {
+      flowSolver->LinSysSol(iPoint, iVar) = CoupledLinSysSol(iPoint, iVar);
+    }
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      LinSysSol(iPoint, iVar) = CoupledLinSysSol(iPoint, nVarFlow+iVar);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Update the flow and then the primitives, the conservative update of the
+   *    turbulence variables needs the new density. ---*/
+
+  flowSolver->CompleteImplicitIteration(geometry, solver_container, config);
+
+  flowSolver->Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
 void CTurbSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
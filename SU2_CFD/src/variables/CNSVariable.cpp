@@ -101,7 +101,7 @@ void CNSVariable::SetRoe_Dissipation_NTS(unsigned long iPoint,
 
 }
 
-void CNSVariable::SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall_dist){
+void CNSVariable::SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall_dist, su2double val_cd1){
 
   /*--- Constants for Roe Dissipation ---*/
 
@@ -127,7 +127,7 @@ void CNSVariable::SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall
   const su2double nu_t = GetEddyViscosity(iPoint)/GetDensity(iPoint);
   const su2double r_d = (nu + nu_t)/(uijuij*k2*pow(val_wall_dist,2));
 
-  Roe_Dissipation(iPoint) = 1.0-tanh(pow(8.0*r_d,3.0));
+  Roe_Dissipation(iPoint) = 1.0-tanh(pow(val_cd1*r_d,3.0));
 
   AD::SetPreaccOut(Roe_Dissipation(iPoint));
   AD::EndPreacc();
@@ -49,6 +49,7 @@ CTurbSSTVariable::CTurbSSTVariable(su2double kine, su2double omega, su2double mu
   F1.resize(nPoint) = su2double(1.0);
   F2.resize(nPoint) = su2double(0.0);
   CDkw.resize(nPoint) = su2double(0.0);
+  DES_LengthScale.resize(nPoint) = su2double(0.0);
 
   muT.resize(nPoint) = mut;
 }
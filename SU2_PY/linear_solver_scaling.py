@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+
+## \file linear_solver_scaling.py
+#  \brief Python script to measure the iteration time of the linear solvers versus the number of ranks.
+#  \version 7.5.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import os, sys, copy
+from optparse import OptionParser
+sys.path.append(os.environ['SU2_RUN'])
+import SU2
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+    # Command Line Options
+    parser=OptionParser()
+    parser.add_option("-f", "--file",       dest="filename",
+                      help="read config from FILE", metavar="FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default="1,2,4,8",
+                      help="comma separated list of PARTITIONS", metavar="PARTITIONS")
+    parser.add_option("-i", "--iterations", dest="iterations", default=50,
+                      help="number of ITERATIONS of each run", metavar="ITERATIONS")
+    parser.add_option("-s", "--solvers",    dest="solvers",    default="FGMRES,PIPELINED_FGMRES",
+                      help="comma separated list of linear SOLVERS", metavar="SOLVERS")
+    parser.add_option("-o", "--output",     dest="output",     default="linear_solver_scaling.csv",
+                      help="write the timings to OUTPUT", metavar="OUTPUT")
+
+    (options, args)=parser.parse_args()
+    options.partitions = [ int(n) for n in options.partitions.split(",") ]
+    options.iterations = int( options.iterations )
+    options.solvers    = [ s.strip().upper() for s in options.solvers.split(",") ]
+
+    if options.filename == None:
+        raise Exception("No config file provided. Use -f flag")
+
+    linear_solver_scaling( options.filename   ,
+                           options.partitions ,
+                           options.iterations ,
+                           options.solvers    ,
+                           options.output      )
+
+#: def main()
+
+
+# -------------------------------------------------------------------
+#  Scaling Study
+# -------------------------------------------------------------------
+
+def linear_solver_scaling( filename                                   ,
+                           partitions = [1, 2, 4, 8]                  ,
+                           iterations = 50                            ,
+                           solvers    = ["FGMRES", "PIPELINED_FGMRES"] ,
+                           output     = "linear_solver_scaling.csv"    ):
+    """ Runs the case of the config file for each linear solver and number of ranks, and
+        tabulates the average wall time per iteration, the linear iterations, and the speedup
+        relative to the first solver on the same number of ranks.
+        The runs should be long enough for the start-up to not dominate the average.
+    """
+
+    # Config
+    config = SU2.io.Config(filename)
+
+    if config.SOLVER == "MULTIPHYSICS":
+        print("Linear solver scaling script not compatible with MULTIPHYSICS solver.")
+        exit(1)
+
+    extension = ".dat" if config.get("TABULAR_FORMAT", "CSV") == "TECPLOT" else ".csv"
+
+    results = []
+
+    for solver in solvers:
+        for nRank in partitions:
+
+            konfig = copy.deepcopy(config)
+            konfig.LINEAR_SOLVER  = solver
+            konfig.NUMBER_PART    = nRank
+            konfig.ITER           = iterations
+            konfig.CONV_FILENAME  = "history_%s_%d" % (solver.lower(), nRank)
+            konfig.HISTORY_OUTPUT = ["ITER", "WALL_TIME", "LINSOL"]
+
+            print("\n-------------------------------------------------------------------------")
+            print("|  %s on %d rank(s)" % (solver, nRank))
+            print("-------------------------------------------------------------------------")
+
+            SU2.run.CFD(konfig)
+
+            history = SU2.io.read_plot(konfig.CONV_FILENAME + extension)
+
+            # the wall time field is already averaged over the inner iterations
+            wallTime = history["Time(sec)"][-1]
+            linIter  = sum(history["LinSolIter"]) / len(history["LinSolIter"])
+
+            results.append( [solver, nRank, wallTime, linIter] )
+
+    #: for each solver and rank count
+
+    # speedup relative to the first solver with the same number of ranks
+    reference = {}
+    for solver, nRank, wallTime, linIter in results:
+        if solver == solvers[0]: reference[nRank] = wallTime
+
+    header = "%-20s %8s %16s %14s %10s" % ("Solver", "Ranks", "Time/iter (s)", "Lin. iter", "Speedup")
+    print("\n" + header)
+    print("-" * len(header))
+
+    table = open(output, "w")
+    table.write('"Solver","Ranks","Time_per_iter","Linear_iter","Speedup"\n')
+
+    for solver, nRank, wallTime, linIter in results:
+        speedup = reference[nRank] / wallTime if wallTime > 0 else 0.0
+        print("%-20s %8d %16.6e %14.2f %10.3f" % (solver, nRank, wallTime, linIter, speedup))
+        table.write('"%s",%d,%.6e,%.2f,%.4f\n' % (solver, nRank, wallTime, linIter, speedup))
+
+    table.close()
+
+    return results
+
+#: def linear_solver_scaling()
+
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
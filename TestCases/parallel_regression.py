@@ -945,6 +945,13 @@ def main():
     ddes_flatplate.unsteady  = True
     test_list.append(ddes_flatplate)
 
+    # SST based Improved Delayed Detached Eddy Simulation, checks that the case runs until reference values are recorded
+    sst_iddes_flatplate          = TestCase('sst_iddes_flatplate')
+    sst_iddes_flatplate.cfg_dir  = "ddes/flatplate"
+    sst_iddes_flatplate.cfg_file = "sst_iddes_flatplate.cfg"
+    sst_iddes_flatplate.unsteady = True
+    test_list.append(sst_iddes_flatplate)
+
     # unsteady pitching NACA0015, SA
     unst_inc_turb_naca0015_sa           = TestCase('unst_inc_turb_naca0015_sa')
     unst_inc_turb_naca0015_sa.cfg_dir   = "unsteady/pitching_naca0015_rans_inc"
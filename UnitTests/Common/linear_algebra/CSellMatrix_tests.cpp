@@ -0,0 +1,90 @@
+/*!
+ * \file CSellMatrix_tests.cpp
+ * \brief Unit tests for the SELL-C-sigma matrix-vector product.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+void testSellProduct(unsigned short nVar) {
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER_SELL_FORMAT= YES");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  /*--- Blocks with distinct values, rows of different lengths exercise the padding. ---*/
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = 4.0 + 0.01*iPoint + 0.1*k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -0.5 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), csr, sell;
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = 1.0 + 0.1*(i % 7);
+  csr.Initialize(nPoint, nPointDomain, nVar);
+  sell.Initialize(nPoint, nPointDomain, nVar);
+
+  /*--- Until the values are copied the CSR product is used. ---*/
+
+  matrix.MatrixVectorProduct(x, csr, geometry, config);
+  matrix.UpdateSELLValues();
+  matrix.MatrixVectorProduct(x, sell, geometry, config);
+
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i) {
+    CHECK(SU2_TYPE::GetValue(sell[i]) == Approx(SU2_TYPE::GetValue(csr[i])));
+  }
+
+  /*--- Modifying the matrix as a whole invalidates the copy, the next update must copy the new values. ---*/
+
+  matrix.TransposeInPlace();
+  matrix.MatrixVectorProduct(x, csr, geometry, config);
+  matrix.UpdateSELLValues();
+  matrix.MatrixVectorProduct(x, sell, geometry, config);
+
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i) {
+    CHECK(SU2_TYPE::GetValue(sell[i]) == Approx(SU2_TYPE::GetValue(csr[i])));
+  }
+}
+
+TEST_CASE("SELL-C-sigma matrix-vector product", "[Linear Algebra]") {
+  testSellProduct(1);
+  testSellProduct(2);
+  testSellProduct(5);
+}
@@ -0,0 +1,435 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the preconditioners of CSysMatrix.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+TEST_CASE("Level scheduled ILU", "[Linear Algebra]") {
+
+  /*--- With a single partition the partitioned ILU is the global factorization, which is
+   *    what the level scheduled ILU computes regardless of the number of threads. ---*/
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER_ILU_FILL_IN= 1");
+  test.AddOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING= YES");
+  test.InitConfig();
+  test.InitGeometry();
+
+  UnitQuadTestCase reference;
+  reference.AddOption("LINEAR_SOLVER_ILU_FILL_IN= 1");
+  reference.AddOption("LINEAR_SOLVER_PREC_THREADS= 1");
+  reference.InitConfig();
+
+  auto* geometry = test.geometry.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> levels, partitions;
+  levels.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, test.config.get());
+  partitions.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, reference.config.get());
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 10.0 + 0.01*iPoint : 0.1*k;
+    levels.SetBlock(iPoint, iPoint, block.data());
+    partitions.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -1.0 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      levels.SetBlock(iPoint, jPoint, block.data());
+      partitions.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  levels.BuildILUPreconditioner();
+  partitions.BuildILUPreconditioner();
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), y1, y2;
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = 1.0 + 0.1*(i % 7);
+  y1.Initialize(nPoint, nPointDomain, nVar);
+  y2.Initialize(nPoint, nPointDomain, nVar);
+
+  levels.ComputeILUPreconditioner(x, y1, geometry, test.config.get());
+  partitions.ComputeILUPreconditioner(x, y2, geometry, reference.config.get());
+
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i) {
+    CHECK(SU2_TYPE::GetValue(y1[i]) == Approx(SU2_TYPE::GetValue(y2[i])));
+  }
+}
+
+void testCompressedPreconditioner(const std::string& prec, const std::string& format) {
+
+  /*--- The 16 bit off-diagonal blocks should only perturb the result of the preconditioner. ---*/
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER_PREC= " + prec);
+  test.AddOption("LINEAR_SOLVER_PREC_COMPRESSION= " + format);
+  test.InitConfig();
+  test.InitGeometry();
+
+  UnitQuadTestCase reference;
+  reference.AddOption("LINEAR_SOLVER_PREC= " + prec);
+  reference.InitConfig();
+
+  auto* geometry = test.geometry.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> compressed, full;
+  compressed.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, test.config.get());
+  full.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, reference.config.get());
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 10.0 + 0.01*iPoint : 0.1*k;
+    compressed.SetBlock(iPoint, iPoint, block.data());
+    full.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -1.0 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      compressed.SetBlock(iPoint, jPoint, block.data());
+      full.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), y1, y2;
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = 1.0 + 0.1*(i % 7);
+  y1.Initialize(nPoint, nPointDomain, nVar);
+  y2.Initialize(nPoint, nPointDomain, nVar);
+
+  if (prec == "ILU") {
+    compressed.BuildILUPreconditioner();
+    full.BuildILUPreconditioner();
+    compressed.ComputeILUPreconditioner(x, y1, geometry, test.config.get());
+    full.ComputeILUPreconditioner(x, y2, geometry, reference.config.get());
+  } else {
+    compressed.BuildLU_SGSPreconditioner();
+    full.BuildLU_SGSPreconditioner();
+    compressed.ComputeLU_SGSPreconditioner(x, y1, geometry, test.config.get());
+    full.ComputeLU_SGSPreconditioner(x, y2, geometry, reference.config.get());
+  }
+
+  const su2double tol = (format == "FLOAT16") ? 1e-3 : 1e-2;
+
+  for (auto i = 0ul; i < nPointDomain*nVar; ++i) {
+    CHECK(SU2_TYPE::GetValue(y1[i]) == Approx(SU2_TYPE::GetValue(y2[i])).epsilon(tol).margin(tol));
+  }
+}
+
+TEST_CASE("Compressed preconditioner blocks", "[Linear Algebra]") {
+  testCompressedPreconditioner("ILU", "FLOAT16");
+  testCompressedPreconditioner("ILU", "BFLOAT16");
+  testCompressedPreconditioner("LU_SGS", "FLOAT16");
+  testCompressedPreconditioner("LU_SGS", "BFLOAT16");
+}
+
+void testLineletPreconditioner(const std::string& prec) {
+
+  /*--- On a stretched box there are linelets from y_minus to y_plus. On the points of the linelets the
+   *    preconditioner must solve the block-tridiagonal system exactly, including for LINELET_ILU. ---*/
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER_PREC= " + prec);
+  const std::string box = "MESH_BOX_LENGTH=1,1,1";
+  test.config_options.replace(test.config_options.find(box), box.size(), "MESH_BOX_LENGTH=1,0.01,1");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 10.0 + 0.01*iPoint : 0.1*k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -1.0 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  matrix.BuildLineletPreconditioner(geometry, config);
+
+  const auto& li = geometry->GetLineletInfo(config);
+  REQUIRE(!li.linelets.empty());
+  REQUIRE(li.linelets[0].size() > 1);
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), y;
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = 1.0 + 0.1*(i % 7);
+  y.Initialize(nPoint, nPointDomain, nVar);
+
+  matrix.ComputeLineletPreconditioner(x, y, geometry, config);
+
+  /*--- Residual of the tridiagonal systems. ---*/
+  for (const auto& linelet : li.linelets) {
+    for (auto iElem = 0ul; iElem < linelet.size(); ++iElem) {
+      const auto iPoint = linelet[iElem];
+      su2double res[nVar] = {0.0};
+      auto addProduct = [&](unsigned long jPoint) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            res[iVar] += matrix.GetBlock(iPoint, jPoint, iVar, jVar) * y(jPoint, jVar);
+      };
+      addProduct(iPoint);
+      if (iElem > 0) addProduct(linelet[iElem-1]);
+      if (iElem+1 < linelet.size()) addProduct(linelet[iElem+1]);
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        CHECK(SU2_TYPE::GetValue(res[iVar]) == Approx(SU2_TYPE::GetValue(x(iPoint, iVar))));
+      }
+    }
+  }
+}
+
+TEST_CASE("Linelet preconditioner", "[Linear Algebra]") {
+  testLineletPreconditioner("LINELET");
+  testLineletPreconditioner("LINELET_ILU");
+}
+
+unsigned long solvePoisson(const std::string& prec, su2double& relResidual) {
+
+  /*--- Graph Laplacian with a small shift, the slowly converging smooth modes are what AMG should remove. ---*/
+
+  UnitQuadTestCase test;
+  const std::string box = "MESH_BOX_SIZE=5,5,5";
+  test.config_options.replace(test.config_options.find(box), box.size(), "MESH_BOX_SIZE=11,11,11");
+  test.AddOption("LINEAR_SOLVER= FGMRES");
+  test.AddOption("LINEAR_SOLVER_PREC= " + prec);
+  test.AddOption("LINEAR_SOLVER_ITER= 200");
+  test.AddOption("LINEAR_SOLVER_RESTART_FREQUENCY= 200");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-8");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 1;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const su2mixedfloat diag = geometry->nodes->GetnPoint(iPoint) + 0.01;
+    const su2mixedfloat offDiag = -1.0;
+    matrix.SetBlock(iPoint, iPoint, &diag);
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) matrix.SetBlock(iPoint, jPoint, &offDiag);
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> res(nPoint, nPointDomain, nVar, 0.0);
+
+  for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*(i % 7);
+
+  const auto iter = solver.Solve(matrix, rhs, sol, geometry, config);
+
+  matrix.ComputeResidual(sol, rhs, res);
+  relResidual = res.norm() / rhs.norm();
+  return iter;
+}
+
+TEST_CASE("AMG preconditioner", "[Linear Algebra]") {
+
+  su2double resJacobi = 0.0, resAMG = 0.0;
+  const auto iterJacobi = solvePoisson("JACOBI", resJacobi);
+  const auto iterAMG = solvePoisson("AMG", resAMG);
+
+  CHECK(SU2_TYPE::GetValue(resJacobi) < 1e-6);
+  CHECK(SU2_TYPE::GetValue(resAMG) < 1e-6);
+
+  /*--- The V-cycle must do much better than the one level smoother. ---*/
+  CHECK(2 * iterAMG < iterJacobi);
+}
+
+TEST_CASE("Matrix-vector product with halo exchange", "[Linear Algebra]") {
+
+  /*--- With more than one rank the rows sent to other ranks are computed first and the inner rows
+   *    overlap the halo exchange. Each row sums to one, so the product of a vector of constant blocks
+   *    is known everywhere, including on the halos, which must have been received from the owners. ---*/
+
+  UnitQuadTestCase test;
+  test.InitConfig();
+  test.InitGeometry(true);
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 2;
+
+  /*--- Every rank has halos when the mesh is partitioned. ---*/
+  if (SU2_MPI::GetSize() > 1) REQUIRE(nPoint > nPointDomain);
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 1.0 + nNeigh : 0.0;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? -1.0 : 0.0;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), y(nPoint, nPointDomain, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x(iPoint, iVar) = 1.0 + iVar;
+  y = su2mixedfloat(-1.0);
+
+  matrix.MatrixVectorProduct(x, y, geometry, config);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      CHECK(SU2_TYPE::GetValue(y(iPoint, iVar)) == Approx(1.0 + iVar));
+    }
+  }
+}
+
+TEST_CASE("Fixed size and generic block kernels", "[Linear Algebra]") {
+
+  /*--- Blocks up to 7x7 use kernels specialized for their size, larger ones the generic kernels.
+   *    The operations built on them are compared with naive products using the stored blocks.
+   *    LU-SGS with one partition is the exact sequential sweep, regardless of the number of threads. ---*/
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER_PREC_THREADS= 1");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  for (unsigned short nVar = 1; nVar <= 9; ++nVar) {
+    CAPTURE(nVar);
+
+    CSysMatrix<su2mixedfloat> matrix;
+    matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+    std::vector<su2mixedfloat> block(nVar*nVar);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const auto i = geometry->nodes->GetGlobalIndex(iPoint);
+      for (auto k = 0ul; k < block.size(); ++k)
+        block[k] = (k % (nVar+1) == 0)? 10.0 + nVar + 0.01*i : 0.3 + 0.01*((i+5*k) % 11);
+      matrix.SetBlock(iPoint, iPoint, block.data());
+
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        const auto j = geometry->nodes->GetGlobalIndex(jPoint);
+        for (auto k = 0ul; k < block.size(); ++k) block[k] = -0.2 + 0.01*((i+2*j+k) % 13);
+        matrix.SetBlock(iPoint, jPoint, block.data());
+      }
+    }
+
+    CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar), y(nPoint, nPointDomain, nVar);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto i = geometry->nodes->GetGlobalIndex(iPoint);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) x(iPoint, iVar) = 1.0 + 0.1*((i+iVar) % 7);
+    }
+
+    /*--- y = A(iPoint,jPoint) * v, accumulated. ---*/
+    auto blockProduct = [&](unsigned long iPoint, unsigned long jPoint, const CSysVector<su2mixedfloat>& v,
+                            std::vector<passivedouble>& res) {
+      const auto* blk = matrix.GetBlock(iPoint, jPoint);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          res[iVar] += SU2_TYPE::GetValue(blk[iVar*nVar+jVar] * v(jPoint, jVar));
+    };
+    std::vector<passivedouble> ref(nVar);
+
+    /*--- Matrix-vector product (GEMV kernels). ---*/
+
+    matrix.MatrixVectorProduct(x, y, geometry, config);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      std::fill(ref.begin(), ref.end(), 0.0);
+      blockProduct(iPoint, iPoint, x, ref);
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) blockProduct(iPoint, jPoint, x, ref);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) CHECK(SU2_TYPE::GetValue(y(iPoint, iVar)) == Approx(ref[iVar]));
+    }
+
+    /*--- Jacobi (inversion kernel), D * (D^-1 x) = x. ---*/
+
+    matrix.BuildJacobiPreconditioner();
+    matrix.ComputeJacobiPreconditioner(x, y, geometry, config);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      std::fill(ref.begin(), ref.end(), 0.0);
+      blockProduct(iPoint, iPoint, y, ref);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        CHECK(ref[iVar] == Approx(SU2_TYPE::GetValue(x(iPoint, iVar))).epsilon(1e-5));
+    }
+
+    /*--- LU-SGS (Gauss elimination and GEMV add/sub kernels), y = (D+U)^-1 D (D+L)^-1 x,
+     *    (D+L) D^-1 (D+U) y = x is checked with D^-1 applied by the Jacobi preconditioner. ---*/
+
+    if (SU2_MPI::GetSize() > 1) continue;
+
+    matrix.BuildLU_SGSPreconditioner();
+    matrix.ComputeLU_SGSPreconditioner(x, y, geometry, config);
+
+    CSysVector<su2mixedfloat> z(nPoint, nPointDomain, nVar), w(nPoint, nPointDomain, nVar);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      std::fill(ref.begin(), ref.end(), 0.0);
+      blockProduct(iPoint, iPoint, y, ref);
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        if (jPoint > iPoint) blockProduct(iPoint, jPoint, y, ref);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) z(iPoint, iVar) = ref[iVar];
+    }
+    matrix.ComputeJacobiPreconditioner(z, w, geometry, config);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      std::fill(ref.begin(), ref.end(), 0.0);
+      blockProduct(iPoint, iPoint, w, ref);
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        if (jPoint < iPoint) blockProduct(iPoint, jPoint, w, ref);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        CHECK(ref[iVar] == Approx(SU2_TYPE::GetValue(x(iPoint, iVar))).epsilon(1e-5));
+    }
+  }
+}
@@ -0,0 +1,350 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests for the linear solvers.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+TEST_CASE("GCRO-DR subspace recycling", "[Linear Algebra]") {
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER= GCRODR");
+  test.AddOption("LINEAR_SOLVER_PREC= JACOBI");
+  test.AddOption("LINEAR_SOLVER_ITER= 200");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-8");
+  test.AddOption("LINEAR_SOLVER_RECYCLE_SIZE= 10");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  /*--- Non-symmetric and weakly diagonally dominant, Jacobi leaves slowly converging modes. ---*/
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 1.05 * nNeigh : 0.1*k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? -1.0 + 0.1*(jPoint > iPoint) : 0.0;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> res(nPoint, nPointDomain, nVar, 0.0);
+
+  /*--- Sequence of right hand sides with the same matrix, after the first solve the
+   *    recycled subspace should reduce the number of iterations. ---*/
+
+  unsigned long iters[3] = {0};
+
+  for (int iSolve = 0; iSolve < 3; ++iSolve) {
+    for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*((i + 3*iSolve) % 7);
+    sol = su2double(0.0);
+
+    iters[iSolve] = solver.Solve(matrix, rhs, sol, geometry, config);
+
+    matrix.ComputeResidual(sol, rhs, res);
+    CHECK(SU2_TYPE::GetValue(res.norm()) < 1e-6 * SU2_TYPE::GetValue(rhs.norm()));
+  }
+
+  CHECK(iters[1] < iters[0]);
+  CHECK(iters[2] < iters[0]);
+
+  /*--- Sequence of slightly different matrices, as in a nonlinear iteration. The recycled subspace is mapped
+   *    to the new preconditioner and matrix, the solves must still converge and benefit from it. ---*/
+
+  CSysSolve<su2mixedfloat> solver2;
+
+  for (int iSolve = 0; iSolve < 3; ++iSolve) {
+    if (iSolve > 0) {
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        const su2mixedfloat shift = 0.02 * geometry->nodes->GetnPoint(iPoint);
+        matrix.AddVal2Diag(iPoint, shift);
+      }
+    }
+    for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*((i + 3*iSolve) % 7);
+    sol = su2double(0.0);
+
+    iters[iSolve] = solver2.Solve(matrix, rhs, sol, geometry, config);
+
+    matrix.ComputeResidual(sol, rhs, res);
+    CHECK(SU2_TYPE::GetValue(res.norm()) < 1e-6 * SU2_TYPE::GetValue(rhs.norm()));
+  }
+
+  CHECK(iters[1] < iters[0]);
+  CHECK(iters[2] < iters[0]);
+}
+
+TEST_CASE("Asynchronous smoother", "[Linear Algebra]") {
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER= SMOOTHER");
+  test.AddOption("LINEAR_SOLVER_PREC= JACOBI");
+  test.AddOption("LINEAR_SOLVER_ITER= 100");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-8");
+  test.AddOption("LINEAR_SOLVER_SMOOTHER_ASYNC_SWEEPS= 2");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 2;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  /*--- Block diagonally dominant, for which the chaotic relaxation converges. ---*/
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 1.2 * nNeigh : 0.1;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? -1.0 : 0.0;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> res(nPoint, nPointDomain, nVar, 0.0);
+
+  for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*(i % 5);
+
+  /*--- With OpenMP each thread sweeps its partition of the matrix concurrently with the others, the
+   *    shared solution is accessed atomically, i.e. this should be clean under ThreadSanitizer. ---*/
+
+  unsigned long iter = 0;
+  SU2_OMP_PARALLEL
+  {
+    const auto it = solver.Solve(matrix, rhs, sol, geometry, config);
+    SU2_OMP_MASTER
+    iter = it;
+    END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+
+  matrix.ComputeResidual(sol, rhs, res);
+  CHECK(iter < 100);
+  CHECK(SU2_TYPE::GetValue(res.norm()) < 1e-6 * SU2_TYPE::GetValue(rhs.norm()));
+}
+
+void testSparseDirectSolver(const std::string& kind) {
+
+  /*--- On one rank the factorization is exact, FGMRES should converge in one iteration. The box is
+   *    large enough for the nested dissection to split it several times. ---*/
+
+  UnitQuadTestCase test;
+  const std::string box = "MESH_BOX_SIZE=5,5,5";
+  test.config_options.replace(test.config_options.find(box), box.size(), "MESH_BOX_SIZE=9,9,9");
+  test.AddOption("LINEAR_SOLVER= " + kind);
+  test.AddOption("LINEAR_SOLVER_ITER= 20");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-10");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+  const bool symmetric = (kind == "SPARSE_LDLT");
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 1.1 * nNeigh : 0.1;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) {
+        if (symmetric) block[k] = (k % (nVar+1) == 0)? -1.0 : 0.05*(k/nVar + k%nVar);
+        else block[k] = -1.0 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      }
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> res(nPoint, nPointDomain, nVar, 0.0);
+
+  for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*(i % 7);
+
+  const auto iter = solver.Solve(matrix, rhs, sol, geometry, config);
+
+  matrix.ComputeResidual(sol, rhs, res);
+  CHECK(iter <= 2);
+  CHECK(SU2_TYPE::GetValue(res.norm()) < 1e-8 * SU2_TYPE::GetValue(rhs.norm()));
+}
+
+TEST_CASE("Sparse direct solver", "[Linear Algebra]") {
+  testSparseDirectSolver("SPARSE_LU");
+  testSparseDirectSolver("SPARSE_LDLT");
+}
+
+su2double mixedPrecisionResidual(unsigned short refineIter) {
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER= FGMRES");
+  test.AddOption("LINEAR_SOLVER_PREC= ILU");
+  test.AddOption("LINEAR_SOLVER_ITER= 100");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-12");
+  test.AddOption("LINEAR_SOLVER_REFINEMENT_ITER= " + std::to_string(refineIter));
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto nNeigh = geometry->nodes->GetnPoint(iPoint);
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 1.01 * nNeigh : 0.1*k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? -1.0 + 0.1*(jPoint > iPoint) : 0.0;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), sol(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector<su2double> res(nPoint, nPointDomain, nVar, 0.0);
+
+  for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*(i % 7);
+
+  solver.Solve(matrix, rhs, sol, geometry, config);
+
+  matrix.ComputeResidual(sol, rhs, res);
+  return res.norm() / rhs.norm();
+}
+
+TEST_CASE("Mixed precision iterative refinement", "[Linear Algebra]") {
+
+  const auto resPlain = SU2_TYPE::GetValue(mixedPrecisionResidual(0));
+  const auto resRefined = SU2_TYPE::GetValue(mixedPrecisionResidual(5));
+
+  /*--- The corrections of the refinement are computed from the full precision residual, which is not limited
+   *    by the precision of the matrix. Without mixed precision the refinement is not used. ---*/
+
+  if (sizeof(su2mixedfloat) < sizeof(passivedouble)) {
+    CHECK(resPlain > 1e-9);
+    CHECK(resRefined < 1e-10);
+  } else {
+    CHECK(resRefined == Approx(resPlain));
+  }
+}
+
+void solveNonSymmetric(const std::string& kind, CSysVector<su2double>& sol, unsigned long& iter) {
+
+  UnitQuadTestCase test;
+  test.AddOption("LINEAR_SOLVER= " + kind);
+  test.AddOption("LINEAR_SOLVER_PREC= JACOBI");
+  test.AddOption("LINEAR_SOLVER_ITER= 100");
+  test.AddOption("LINEAR_SOLVER_ERROR= 1e-10");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto* geometry = test.geometry.get();
+  const auto* config = test.config.get();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const unsigned short nVar = 3;
+
+  CSysMatrix<su2mixedfloat> matrix;
+  matrix.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+  std::vector<su2mixedfloat> block(nVar*nVar);
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto k = 0ul; k < block.size(); ++k) block[k] = (k % (nVar+1) == 0)? 10.0 + 0.01*iPoint : 0.1*k;
+    matrix.SetBlock(iPoint, iPoint, block.data());
+
+    for (auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+      for (auto k = 0ul; k < block.size(); ++k) block[k] = -1.0 + 0.001*(iPoint+2*jPoint) - 0.01*k;
+      matrix.SetBlock(iPoint, jPoint, block.data());
+    }
+  }
+
+  CSysSolve<su2mixedfloat> solver;
+  CSysVector<su2double> rhs(nPoint, nPointDomain, nVar, 0.0), res(nPoint, nPointDomain, nVar, 0.0);
+  sol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+  for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = 1.0 + 0.1*(i % 7);
+
+  iter = solver.Solve(matrix, rhs, sol, geometry, config);
+
+  matrix.ComputeResidual(sol, rhs, res);
+  CHECK(SU2_TYPE::GetValue(res.norm()) < 1e-8 * SU2_TYPE::GetValue(rhs.norm()));
+}
+
+TEST_CASE("Pipelined FGMRES", "[Linear Algebra]") {
+
+  /*--- In exact arithmetic the pipelined variant builds the same Krylov basis as FGMRES. ---*/
+
+  CSysVector<su2double> solRef, solPipe;
+  unsigned long iterRef = 0, iterPipe = 0;
+
+  solveNonSymmetric("FGMRES", solRef, iterRef);
+  solveNonSymmetric("PIPELINED_FGMRES", solPipe, iterPipe);
+
+  CHECK(iterPipe <= iterRef + 1);
+
+  for (auto i = 0ul; i < solRef.GetNElmDomain(); ++i) {
+    CHECK(SU2_TYPE::GetValue(solPipe[i]) == Approx(SU2_TYPE::GetValue(solRef[i])).epsilon(1e-6));
+  }
+}
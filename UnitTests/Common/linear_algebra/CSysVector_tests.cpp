@@ -0,0 +1,78 @@
+/*!
+ * \file CSysVector_tests.cpp
+ * \brief Unit tests for the fused multi-vector operations of CSysVector.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../../Common/include/linear_algebra/CSysVector.hpp"
+
+TEST_CASE("Fused CSysVector operations", "[Linear Algebra]") {
+
+  /*--- The fused operations should match the equivalent sequence of simple operations. ---*/
+
+  const unsigned long nBlk = 101, nBlkDomain = 97, nVar = 3, n = 4;
+
+  std::vector<CSysVector<su2double>> basis(n);
+  for (auto k = 0ul; k < n; ++k) {
+    basis[k].Initialize(nBlk, nBlkDomain, nVar, 0.0);
+    for (auto i = 0ul; i < basis[k].GetLocSize(); ++i) basis[k][i] = 1.0 / (1 + i + 3*k) - 0.1*k;
+  }
+  CSysVector<su2double> x(nBlk, nBlkDomain, nVar, 0.0);
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = 0.5 + 0.1*(i % 7);
+
+  const su2double alpha[n] = {0.3, -1.2, 0.7, 2.0};
+
+  SECTION("Multiple dot products") {
+    su2double dots[n + 1];
+    const su2double sqNorm = x.multiDot(basis, n, dots);
+    for (auto k = 0ul; k < n; ++k) CHECK(dots[k] == Approx(x.dot(basis[k])));
+    CHECK(sqNorm == Approx(x.squaredNorm()));
+    CHECK(dots[n] == sqNorm);
+  }
+
+  SECTION("Multiple axpy") {
+    CSysVector<su2double> y(x), z(x);
+    y.multiAxpy(alpha, basis, n);
+    const su2double sqNorm = z.multiAxpySquaredNorm(alpha, basis, n);
+    for (auto k = 0ul; k < n; ++k) x += alpha[k] * basis[k];
+
+    for (auto i = 0ul; i < x.GetLocSize(); ++i) {
+      CHECK(y[i] == Approx(x[i]));
+      CHECK(z[i] == Approx(x[i]));
+    }
+    CHECK(sqNorm == Approx(x.squaredNorm()));
+  }
+
+  SECTION("Axpy and dot") {
+    CSysVector<su2double> y(x);
+    const su2double dot = y.axpyDot(alpha[0], basis[0], basis[1]);
+    const su2double sqNorm = y.axpyDot(alpha[1], basis[1], y);
+    x += alpha[0] * basis[0];
+    CHECK(dot == Approx(x.dot(basis[1])));
+    x += alpha[1] * basis[1];
+    CHECK(sqNorm == Approx(x.squaredNorm()));
+    for (auto i = 0ul; i < x.GetLocSize(); ++i) CHECK(y[i] == Approx(x[i]));
+  }
+}
@@ -86,3 +86,43 @@ TEST_CASE("SIMD DOUBLE", "[Vectorization]") {
   }
 }
 
+
+TEST_CASE("SIMD MASKED", "[Vectorization]") {
+  /*--- Masked operations must not touch the memory of inactive lanes. ---*/
+  using Double = simd::Array<double>;
+  using Int = simd::Array<unsigned long, Double::Size>;
+  constexpr size_t N = Double::Size;
+
+  Double mask;
+  Int offsets;
+  for (size_t k=0; k<N; ++k) {
+    mask[k] = (k % 2 == 0);
+    offsets[k] = 2*(N-1-k);
+  }
+
+  vector<double> data(2*N);
+  for (size_t i=0; i<data.size(); ++i) data[i] = i + 1.0;
+
+  Double x;
+  x.load(data.data(), mask);
+  for (size_t k=0; k<N; ++k) CHECK(x[k] == mask[k] * data[k]);
+
+  x.gather(data.data(), offsets, mask);
+  for (size_t k=0; k<N; ++k) CHECK(x[k] == mask[k] * data[offsets[k]]);
+
+  vector<double> out(2*N, -1.0);
+  Double y(0.0, 1.0);
+  y.store(out.data(), mask);
+  for (size_t k=0; k<N; ++k) CHECK(out[k] == (mask[k] != 0 ? y[k] : -1.0));
+
+  out.assign(2*N, -1.0);
+  y.scatter(out.data(), offsets, mask);
+  for (size_t k=0; k<N; ++k) CHECK(out[offsets[k]] == (mask[k] != 0 ? y[k] : -1.0));
+
+  /*--- The generic implementation is used for integers. ---*/
+  vector<unsigned long> idx(N);
+  for (size_t k=0; k<N; ++k) idx[k] = k + 1;
+  Int i;
+  i.load(idx.data(), mask);
+  for (size_t k=0; k<N; ++k) CHECK(i[k] == (mask[k] != 0 ? idx[k] : 0ul));
+}
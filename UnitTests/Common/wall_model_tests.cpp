@@ -0,0 +1,169 @@
+/*!
+ * \file wall_model_tests.cpp
+ * \brief Unit tests for the wall models used by the finite volume solvers.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <sstream>
+#include "../../Common/include/wall_model.hpp"
+#include "../../SU2_CFD/include/fluid/CIdealGas.hpp"
+
+namespace {
+
+/*--- Air at standard conditions, the equilibrium model hard-codes the same properties (SI units). ---*/
+constexpr passivedouble pressure = 101325.0, temperature = 288.15, muLam = 1.716e-5, gasConstant = 287.058;
+
+/*!
+ * \brief Config with one heat flux wall that uses the given wall model, e.g. "LOGARITHMIC_WALL_MODEL, 0.01, 1.1, 60".
+ */
+std::unique_ptr<CConfig> WallModelConfig(const std::string& wallModel) {
+  std::stringstream config_options;
+  config_options << "SOLVER= NAVIER_STOKES\n"
+                 << "REF_DIMENSIONALIZATION= DIMENSIONAL\n"
+                 << "REYNOLDS_NUMBER= 1e6\n"
+                 << "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+                 << "MU_CONSTANT= " << muLam << "\n"
+                 << "MARKER_HEATFLUX= (wall, 0.0)\n"
+                 << "MARKER_WALL_FUNCTIONS= (wall, " << wallModel << ")\n";
+
+  auto config = std::unique_ptr<CConfig>(new CConfig(config_options, SU2_COMPONENT::SU2_CFD, false));
+
+  /*--- Dimensional run, the reference values are only set by the solvers. ---*/
+  config->SetViscosity_Ref(1.0);
+  return config;
+}
+
+/*!
+ * \brief Reichardt boundary layer profile, u+ as a function of y+, with the constants of CWallModelLogLaw.
+ */
+passivedouble Reichardt(passivedouble yPlus, passivedouble kappa) {
+  const passivedouble C = 5.25;
+  return log(1.0 + kappa * yPlus) / kappa +
+         (C - log(kappa) / kappa) * (1.0 - exp(-yPlus / 11.0) - yPlus / 11.0 * exp(-0.33 * yPlus));
+}
+
+}  // namespace
+
+TEST_CASE("Log law wall model", "[Wall models]") {
+
+  /*--- The friction velocity solves the Reichardt law at the exchange height, which blends into the log law
+   * u+ = ln(y+) / kappa + C away from the wall. ---*/
+
+  auto config = WallModelConfig("LOGARITHMIC_WALL_MODEL, 0.01, 1.1, 60");
+  CWallModelLogLaw model(config.get(), "wall");
+  REQUIRE(model.GetExchangeHeight() == 0.01);
+
+  CIdealGas fluidModel(1.4, gasConstant);
+  fluidModel.SetLaminarViscosityModel(config.get());
+  fluidModel.SetThermalConductivityModel(config.get());
+
+  const passivedouble kappa = SU2_TYPE::GetValue(config->GetwallModel_Kappa());
+  const passivedouble rho = pressure / (gasConstant * temperature);
+
+  /*--- From the viscous sublayer to the log region. ---*/
+  unsigned short nLinear = 0, nLog = 0;
+  for (const passivedouble hExchange : {5e-7, 2e-5, 2e-4, 2e-3, 2e-2, 1e-1}) {
+    const passivedouble velExchange = 20.0;
+    su2double tauWall = 0.0, qWall, muWall, kOverCvWall;
+
+    model.WallShearStressAndHeatFlux_FVM(hExchange, temperature, velExchange, muLam, pressure, 0.0, true, 0.0, false,
+                                         &fluidModel, tauWall, qWall, muWall, kOverCvWall);
+
+    const passivedouble uTau = sqrt(SU2_TYPE::GetValue(tauWall) / rho);
+    const passivedouble yPlus = hExchange * uTau * rho / muLam;
+    const passivedouble uPlus = velExchange / uTau;
+
+    INFO("y+ = " << yPlus);
+    CHECK(muWall == Approx(muLam));
+    CHECK(uPlus == Approx(Reichardt(yPlus, kappa)).epsilon(1e-3));
+    if (yPlus > 1000) {
+      CHECK(uPlus == Approx(log(yPlus) / kappa + 5.25).epsilon(1e-3));
+      ++nLog;
+    }
+    if (yPlus < 1) {
+      CHECK(uPlus == Approx(yPlus).epsilon(1e-2));
+      ++nLinear;
+    }
+
+    /*--- Warm start from the solution. ---*/
+    su2double tauWallWarm = tauWall;
+    model.WallShearStressAndHeatFlux_FVM(hExchange, temperature, velExchange, muLam, pressure, 0.0, true, 0.0, false,
+                                         &fluidModel, tauWallWarm, qWall, muWall, kOverCvWall);
+    CHECK(SU2_TYPE::GetValue(tauWallWarm) == Approx(SU2_TYPE::GetValue(tauWall)).epsilon(1e-3));
+  }
+  CHECK(nLinear > 0);
+  CHECK(nLog > 0);
+
+  /*--- At the exchange height of the marker, the FVM entry point matches the LES one. ---*/
+  su2double tauWall = 0.0, tauWallRef, qWall, muWall, kOverCvWall;
+  model.WallShearStressAndHeatFlux_FVM(0.01, temperature, 20.0, muLam, pressure, 0.0, true, 0.0, false, &fluidModel,
+                                       tauWall, qWall, muWall, kOverCvWall);
+  model.WallShearStressAndHeatFlux(temperature, 20.0, muLam, pressure, 0.0, true, 0.0, false, &fluidModel, tauWallRef,
+                                   qWall, muWall, kOverCvWall);
+  CHECK(SU2_TYPE::GetValue(tauWall) == Approx(SU2_TYPE::GetValue(tauWallRef)));
+}
+
+TEST_CASE("Equilibrium wall model grid", "[Wall models]") {
+
+  /*--- The FVM solvers use one model per marker and scale its ODE grid to the exchange height of each vertex.
+   * The result must be the same as with a model whose exchange height is that of the vertex. ---*/
+
+  auto config = WallModelConfig("EQUILIBRIUM_WALL_MODEL, 0.01, 1.1, 60");
+  const CWallModel1DEQ model(config.get(), "wall");
+  passivedouble tauWallPrev = 1e10;
+
+  for (const passivedouble hExchange : {0.001, 0.005, 0.01, 0.03}) {
+    std::stringstream wallModel;
+    wallModel << "EQUILIBRIUM_WALL_MODEL, " << hExchange << ", 1.1, 60";
+    auto localConfig = WallModelConfig(wallModel.str());
+    CWallModel1DEQ localModel(localConfig.get(), "wall");
+
+    for (const bool heatFluxPrescribed : {true, false}) {
+      const passivedouble velExchange = 20.0, wallTemperature = 300.0;
+
+      su2double tauWall = 0.0, qWall, muWall, kOverCvWall;
+      model.WallShearStressAndHeatFlux_FVM(hExchange, temperature, velExchange, muLam, pressure, 0.0,
+                                           heatFluxPrescribed, wallTemperature, !heatFluxPrescribed, nullptr, tauWall,
+                                           qWall, muWall, kOverCvWall);
+
+      su2double tauWallRef, qWallRef, muWallRef, kOverCvWallRef;
+      localModel.WallShearStressAndHeatFlux(temperature, velExchange, muLam, pressure, 0.0, heatFluxPrescribed,
+                                            wallTemperature, !heatFluxPrescribed, nullptr, tauWallRef, qWallRef,
+                                            muWallRef, kOverCvWallRef);
+
+      INFO("h = " << hExchange << ", heat flux prescribed: " << heatFluxPrescribed);
+      CHECK(SU2_TYPE::GetValue(tauWall) == Approx(SU2_TYPE::GetValue(tauWallRef)).epsilon(1e-8));
+      CHECK(SU2_TYPE::GetValue(qWall) == Approx(SU2_TYPE::GetValue(qWallRef)).epsilon(1e-8).margin(1e-8));
+      CHECK(SU2_TYPE::GetValue(muWall) == Approx(SU2_TYPE::GetValue(muWallRef)).epsilon(1e-8));
+
+      /*--- For a fixed velocity, the wall shear stress decreases with the exchange height. ---*/
+      if (heatFluxPrescribed) {
+        CHECK(tauWall > 0.0);
+        CHECK(tauWall < tauWallPrev);
+        tauWallPrev = SU2_TYPE::GetValue(tauWall);
+      }
+    }
+  }
+}
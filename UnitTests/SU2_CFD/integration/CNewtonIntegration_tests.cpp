@@ -0,0 +1,81 @@
+/*!
+ * \file CNewtonIntegration_tests.cpp
+ * \brief Unit tests for the Newton-Krylov integration.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/integration/CNewtonIntegration.hpp"
+
+TEST_CASE("Newton-Krylov preconditioner lagging", "[Newton-Krylov]") {
+
+  SECTION("Age and startup period") {
+    CPreconditionerLagging lag;
+    lag.Setup(ILU, 3, 0, 0.0);
+
+    /*--- Never built. ---*/
+    CHECK(lag.IsStale());
+
+    /*--- Startup solves do not count, the first Krylov solve needs a rebuild. ---*/
+    lag.Update(true, false, 5, 1e-2);
+    CHECK(lag.IsStale());
+
+    lag.Update(true, true, 10, 1e-3);
+    CHECK_FALSE(lag.IsStale());
+    lag.Update(false, true, 10, 1e-3);
+    CHECK_FALSE(lag.IsStale());
+    lag.Update(false, true, 10, 1e-3);
+    CHECK(lag.IsStale());
+  }
+
+  SECTION("Linear iterations") {
+    CPreconditionerLagging lag;
+    lag.Setup(ILU, 10, 20, 0.0);
+
+    lag.Update(true, true, 15, 1e-3);
+    CHECK_FALSE(lag.IsStale());
+    lag.Update(false, true, 25, 1e-3);
+    CHECK(lag.IsStale());
+  }
+
+  SECTION("Convergence rate") {
+    CPreconditionerLagging lag;
+    lag.Setup(ILU, 10, 0, 0.5);
+
+    /*--- Reference rate of -0.3 per iteration. ---*/
+    lag.Update(true, true, 10, 1e-3);
+    lag.Update(false, true, 15, 1e-3);
+    CHECK_FALSE(lag.IsStale());
+    lag.Update(false, true, 30, 1e-3);
+    CHECK(lag.IsStale());
+  }
+
+  SECTION("Preconditioners that cannot be lagged") {
+    for (auto kind : {LU_SGS, LINELET, LINELET_ILU, AMG}) {
+      CPreconditionerLagging lag;
+      lag.Setup(kind, 10, 0, 0.0);
+      lag.Update(true, true, 10, 1e-3);
+      CHECK(lag.IsStale());
+    }
+  }
+}
@@ -0,0 +1,537 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Equivalence tests of the vectorized and scalar numerics.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/fds.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/variables/CIncEulerVariable.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/species/species_diffusion.hpp"
+
+namespace {
+
+/*--- Box mesh without verification solution, the tests append the solver and scheme options. ---*/
+const std::string boxOptions =
+    "MESH_FORMAT= BOX\n"
+    "MESH_BOX_SIZE= 5,5,5\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "MARKER_CUSTOM= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+    "INIT_OPTION= TD_CONDITIONS\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "MUSCL_FLOW= NO\n";
+
+using NumericsFactory = std::function<CNumerics*(unsigned short nDim, unsigned short nVar, const CConfig* config)>;
+using StateFunction = std::function<void(const CConfig& config, CGeometry& geometry, CVariable& nodes)>;
+
+/*!
+ * \brief Edge flux residual and Jacobian of a flow solver.
+ */
+struct FluxSystem {
+  std::vector<passivedouble> residual, jacobian;
+};
+
+/*!
+ * \brief Residual and Jacobian blocks (diagonal and neighbors of the domain points) of a solver.
+ */
+FluxSystem GetSystem(CGeometry& geometry, CSolver& solver) {
+  const auto nVar = solver.GetnVar();
+
+  FluxSystem system;
+  for (auto i = 0ul; i < solver.LinSysRes.GetLocSize(); ++i) {
+    system.residual.push_back(SU2_TYPE::GetValue(solver.LinSysRes[i]));
+  }
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    std::vector<unsigned long> points(1, iPoint);
+    for (const auto jPoint : geometry.nodes->GetPoints(iPoint)) points.push_back(jPoint);
+    for (const auto jPoint : points) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          system.jacobian.push_back(SU2_TYPE::GetValue(solver.Jacobian.GetBlock(iPoint, jPoint, iVar, jVar)));
+    }
+  }
+  return system;
+}
+
+/*!
+ * \brief Assemble the edge fluxes of the flow solver defined by "options", either with the
+ * vectorized edge loop, or with the scalar numerics created by "conv" and "visc".
+ */
+FluxSystem AssembleFluxes(const std::string& options, bool vectorized, const StateFunction& setState,
+                          const NumericsFactory& conv, const NumericsFactory& visc = nullptr) {
+  UnitQuadTestCase test;
+  test.config_options = boxOptions + options + (vectorized ? "USE_VECTORIZATION= YES\n" : "USE_VECTORIZATION= NO\n");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* solver = test.solver[FLOW_SOL];
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = solver->GetnVar();
+
+  setState(*config, *geometry, *solver->GetNodes());
+  solver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+
+  /*--- The vectorized path ignores the numerics container. ---*/
+  std::vector<CNumerics*> numerics(MAX_TERMS * omp_get_max_threads(), nullptr);
+  std::vector<std::unique_ptr<CNumerics> > owner;
+  for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread) {
+    owner.emplace_back(conv(nDim, nVar, config));
+    numerics[CONV_TERM + iThread * MAX_TERMS] = owner.back().get();
+    if (visc) {
+      owner.emplace_back(visc(nDim, nVar, config));
+      numerics[VISC_TERM + iThread * MAX_TERMS] = owner.back().get();
+    }
+  }
+  solver->Upwind_Residual(geometry, test.solver, numerics.data(), config, MESH_0);
+
+  return GetSystem(*geometry, *solver);
+}
+
+/*!
+ * \brief Compare two sets of values with a tolerance relative to their largest magnitude.
+ */
+void CheckEqual(const std::vector<passivedouble>& ref, const std::vector<passivedouble>& val, passivedouble tol) {
+  REQUIRE(ref.size() == val.size());
+  passivedouble scale = 0;
+  for (const auto x : ref) scale = std::max(scale, std::abs(x));
+  REQUIRE(scale > 0);
+  for (auto i = 0ul; i < ref.size(); ++i) {
+    CHECK(val[i] == Approx(ref[i]).margin(tol * scale));
+  }
+}
+
+/*!
+ * \brief Smooth compressible state with Mach numbers between 0.2 and 1.6 and varying flow
+ * direction, such that subsonic and supersonic edges in both directions are present.
+ */
+void SetCompressibleState(const CConfig& config, CGeometry& geometry, CVariable& nodes) {
+  const su2double gamma = config.GetGamma();
+  const su2double rho0 = config.GetDensity_FreeStreamND();
+  const su2double p0 = config.GetPressure_FreeStreamND();
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const su2double* x = geometry.nodes->GetCoord(iPoint);
+    const su2double rho = rho0 * (1 + 0.2 * sin(3 * x[0] + x[1]));
+    const su2double p = p0 * (1 + 0.3 * cos(2 * x[1] - x[2]));
+    const su2double mach = 0.2 + 1.4 * x[0] * (0.8 + 0.2 * sin(5 * x[2]));
+    const su2double theta = 2.5 * sin(4 * x[1]), phi = 2 * x[2];
+    const su2double dir[] = {cos(theta), sin(theta) * cos(phi), sin(theta) * sin(phi)};
+    const su2double speed = mach * sqrt(gamma * p / rho);
+
+    nodes.SetSolution(iPoint, 0, rho);
+    for (auto iDim = 0u; iDim < 3; ++iDim) nodes.SetSolution(iPoint, iDim + 1, rho * speed * dir[iDim]);
+    nodes.SetSolution(iPoint, 4, p / (gamma - 1) + 0.5 * rho * pow(speed, 2));
+  }
+}
+
+/*!
+ * \brief Incompressible state (p, v, T) with varying flow direction and temperature, perturbed
+ * from the initial (uniform) solution.
+ */
+void SetIncompressibleState(const CConfig&, CGeometry& geometry, CVariable& nodes) {
+  const su2double p0 = nodes.GetSolution(0, 0);
+  const su2double v0 = nodes.GetSolution(0, 1);
+  const su2double T0 = nodes.GetSolution(0, 4);
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const su2double* x = geometry.nodes->GetCoord(iPoint);
+    const su2double speed = v0 * (1 + 0.5 * sin(3 * x[0] + x[1]));
+    const su2double theta = 2.5 * sin(4 * x[1]), phi = 2 * x[2];
+    const su2double dir[] = {cos(theta), sin(theta) * cos(phi), sin(theta) * sin(phi)};
+
+    nodes.SetSolution(iPoint, 0, p0 + 0.3 * pow(v0, 2) * cos(2 * x[1] - x[2]));
+    for (auto iDim = 0u; iDim < 3; ++iDim) nodes.SetSolution(iPoint, iDim + 1, speed * dir[iDim]);
+    nodes.SetSolution(iPoint, 4, T0 * (1 + 0.1 * sin(5 * x[2] - 2 * x[0])));
+  }
+}
+
+/*!
+ * \brief Scalar numerics of a turbulence or species solver (convection, diffusion, sources).
+ */
+using ScalarNumericsFactory = std::function<CNumerics*(unsigned short nDim, unsigned short nVar,
+                                                       const CSolver& solver, const CConfig* config)>;
+struct ScalarNumerics {
+  ScalarNumericsFactory conv, visc, source;
+};
+
+/*!
+ * \brief Assemble the edge fluxes, and optionally the sources, of the scalar solver "iSol" of the
+ * problem defined by "options", either vectorized or with the scalar numerics. The scalar variables
+ * are scaled from their initial values by "shift + sin(...)", the wall distance is a linear function.
+ */
+FluxSystem AssembleScalarSystem(const std::string& options, bool vectorized, unsigned short iSol,
+                                const StateFunction& setFlowState, su2double shift,
+                                const ScalarNumerics& terms, bool sources = false) {
+  UnitQuadTestCase test;
+  test.config_options = boxOptions + options + (vectorized ? "USE_VECTORIZATION= YES\n" : "USE_VECTORIZATION= NO\n");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* flowSolver = test.solver[FLOW_SOL];
+  auto* solver = test.solver[iSol];
+  REQUIRE(solver != nullptr);
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = solver->GetnVar();
+
+  setFlowState(*config, *geometry, *flowSolver->GetNodes());
+
+  auto* nodes = solver->GetNodes();
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    const su2double* x = geometry->nodes->GetCoord(iPoint);
+    geometry->nodes->SetWall_Distance(iPoint, 0.01 + 0.2 * x[1] + 0.1 * x[2]);
+
+    const su2double factor = shift + sin(3 * x[0] + x[1] - 2 * x[2]);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      nodes->SetSolution(iPoint, iVar, nodes->GetSolution(iPoint, iVar) * factor);
+    }
+  }
+
+  /*--- Same sequence as the fluid iteration, eddy viscosity, flow primitives, then scalar gradients. ---*/
+  flowSolver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+  if (iSol == TURB_SOL) solver->Postprocessing(geometry, test.solver, config, MESH_0);
+  flowSolver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+  const auto runtime = (iSol == TURB_SOL) ? RUNTIME_TURB_SYS : RUNTIME_SPECIES_SYS;
+  solver->Preprocessing(geometry, test.solver, config, MESH_0, 0, runtime, false);
+
+  /*--- The vectorized edge loop only uses the convective numerics for the bounded scalar flag. ---*/
+  std::vector<CNumerics*> numerics(MAX_TERMS * omp_get_max_threads(), nullptr);
+  std::vector<std::unique_ptr<CNumerics> > owner;
+  for (auto iThread = 0; iThread < omp_get_max_threads(); ++iThread) {
+    owner.emplace_back(terms.conv(nDim, nVar, *solver, config));
+    numerics[CONV_TERM + iThread * MAX_TERMS] = owner.back().get();
+    owner.emplace_back(terms.visc(nDim, nVar, *solver, config));
+    numerics[VISC_TERM + iThread * MAX_TERMS] = owner.back().get();
+    if (terms.source) {
+      owner.emplace_back(terms.source(nDim, nVar, *solver, config));
+      numerics[SOURCE_FIRST_TERM + iThread * MAX_TERMS] = owner.back().get();
+    }
+  }
+  solver->Upwind_Residual(geometry, test.solver, numerics.data(), config, MESH_0);
+  if (sources) solver->Source_Residual(geometry, test.solver, numerics.data(), config, MESH_0);
+
+  const auto system = GetSystem(*geometry, *solver);
+
+  /*--- The test case only owns the flow solver. ---*/
+  delete solver;
+  test.solver[iSol] = nullptr;
+  return system;
+}
+
+}  // namespace
+
+TEST_CASE("Vectorized compressible upwind schemes", "[Numerics SIMD]") {
+
+  /*--- The residual and Jacobians (Roe-approximate for the AUSM family) of the vectorized
+   * schemes must match those of the scalar implementations. ---*/
+
+  struct Scheme {
+    std::string name;
+    NumericsFactory factory;
+  };
+  const std::vector<Scheme> schemes = {
+      {"HLLC", [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+         return new CUpwHLLC_Flow(nDim, nVar, config);
+       }},
+      {"AUSMPLUSUP", [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+         return new CUpwAUSMPLUSUP_Flow(nDim, nVar, config);
+       }},
+      {"AUSMPLUSUP2", [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+         return new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config);
+       }},
+      {"SLAU", [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+         return new CUpwSLAU_Flow(nDim, nVar, config, false);
+       }},
+      {"SLAU2", [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+         return new CUpwSLAU2_Flow(nDim, nVar, config, false);
+       }},
+  };
+
+  for (const auto& scheme : schemes) {
+    SECTION(scheme.name) {
+      const std::string options =
+          "SOLVER= EULER\n"
+          "MACH_NUMBER= 0.8\n"
+          "CONV_NUM_METHOD_FLOW= " + scheme.name + "\n";
+
+      const auto scalar = AssembleFluxes(options, false, SetCompressibleState, scheme.factory);
+      const auto simd = AssembleFluxes(options, true, SetCompressibleState, scheme.factory);
+
+      CheckEqual(scalar.residual, simd.residual, 1e-10);
+      CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+    }
+  }
+}
+
+TEST_CASE("Vectorized incompressible FDS scheme", "[Numerics SIMD]") {
+
+  /*--- Convective (FDS) and viscous (average of gradients) fluxes and their Jacobians, with
+   * constant and variable density, must match those of the scalar implementations. ---*/
+
+  const NumericsFactory conv = [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+    return new CUpwFDSInc_Flow(nDim, nVar, config);
+  };
+  const NumericsFactory visc = [](unsigned short nDim, unsigned short nVar, const CConfig* config) -> CNumerics* {
+    return new CAvgGradInc_Flow(nDim, nVar, true, config);
+  };
+
+  const std::string common =
+      "SOLVER= INC_NAVIER_STOKES\n"
+      "CONV_NUM_METHOD_FLOW= FDS\n"
+      "INC_DENSITY_INIT= 1.2\n"
+      "INC_VELOCITY_INIT= (2.0, 0.0, 0.0)\n"
+      "INC_TEMPERATURE_INIT= 300.0\n"
+      "INC_ENERGY_EQUATION= YES\n"
+      "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+      "MU_CONSTANT= 0.01\n";
+
+  SECTION("Constant density") {
+    const auto scalar = AssembleFluxes(common, false, SetIncompressibleState, conv, visc);
+    const auto simd = AssembleFluxes(common, true, SetIncompressibleState, conv, visc);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+
+  SECTION("Variable density") {
+    const std::string options = common +
+        "FLUID_MODEL= INC_IDEAL_GAS\n"
+        "INC_DENSITY_MODEL= VARIABLE\n";
+
+    const auto scalar = AssembleFluxes(options, false, SetIncompressibleState, conv, visc);
+    const auto simd = AssembleFluxes(options, true, SetIncompressibleState, conv, visc);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+}
+
+TEST_CASE("Vectorized scalar edge loop", "[Numerics SIMD]") {
+
+  /*--- The convective (upwind) and viscous (average of gradients) fluxes of the turbulence and
+   * species solvers, and their Jacobians, must match those of the scalar implementations. ---*/
+
+  using Indices = CEulerVariable::CIndices<unsigned short>;
+  using IncIndices = CIncEulerVariable::CIndices<unsigned short>;
+
+  const std::string rans =
+      "SOLVER= RANS\n"
+      "MACH_NUMBER= 0.8\n"
+      "REYNOLDS_NUMBER= 1e4\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n";
+
+  SECTION("SA") {
+    const ScalarNumerics terms = {
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CUpwSca_TurbSA<Indices>(nDim, nVar, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config);
+        },
+        nullptr};
+    const std::string options = rans + "KIND_TURB_MODEL= SA\n";
+
+    const auto scalar = AssembleScalarSystem(options, false, TURB_SOL, SetCompressibleState, 1.5, terms);
+    const auto simd = AssembleScalarSystem(options, true, TURB_SOL, SetCompressibleState, 1.5, terms);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+
+  SECTION("SA-neg") {
+    const ScalarNumerics terms = {
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CUpwSca_TurbSA<Indices>(nDim, nVar, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSA_Neg<Indices>(nDim, nVar, true, config);
+        },
+        nullptr};
+    const std::string options = rans + "KIND_TURB_MODEL= SA\nSA_OPTIONS= NEGATIVE, WITHFT2\n";
+
+    /*--- Negative values of nu_tilde in part of the domain. ---*/
+    const auto scalar = AssembleScalarSystem(options, false, TURB_SOL, SetCompressibleState, 0.5, terms);
+    const auto simd = AssembleScalarSystem(options, true, TURB_SOL, SetCompressibleState, 0.5, terms);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+
+  SECTION("SST") {
+    const ScalarNumerics terms = {
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CUpwSca_TurbSST<Indices>(nDim, nVar, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver& solver, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSST<Indices>(nDim, nVar, solver.GetConstants(), true, config);
+        },
+        nullptr};
+    const std::string options = rans + "KIND_TURB_MODEL= SST\n";
+
+    const auto scalar = AssembleScalarSystem(options, false, TURB_SOL, SetCompressibleState, 1.5, terms);
+    const auto simd = AssembleScalarSystem(options, true, TURB_SOL, SetCompressibleState, 1.5, terms);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+
+  SECTION("Species transport") {
+    const ScalarNumerics terms = {
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CUpwSca_Species<IncIndices>(nDim, nVar, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_Species<IncIndices>(nDim, nVar, true, config);
+        },
+        nullptr};
+    const std::string options =
+        "SOLVER= INC_NAVIER_STOKES\n"
+        "CONV_NUM_METHOD_FLOW= FDS\n"
+        "INC_VELOCITY_INIT= (2.0, 0.0, 0.0)\n"
+        "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+        "MU_CONSTANT= 0.01\n"
+        "KIND_SCALAR_MODEL= SPECIES_TRANSPORT\n"
+        "DIFFUSIVITY_MODEL= CONSTANT_DIFFUSIVITY\n"
+        "DIFFUSIVITY_CONSTANT= 0.002\n"
+        "CONV_NUM_METHOD_SPECIES= SCALAR_UPWIND\n"
+        "SPECIES_INIT= 0.4\n";
+
+    const auto scalar = AssembleScalarSystem(options, false, SPECIES_SOL, SetIncompressibleState, 1.5, terms);
+    const auto simd = AssembleScalarSystem(options, true, SPECIES_SOL, SetIncompressibleState, 1.5, terms);
+
+    CheckEqual(scalar.residual, simd.residual, 1e-10);
+    CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+  }
+}
+
+TEST_CASE("Vectorized turbulence source terms", "[Numerics SIMD]") {
+
+  /*--- Production, destruction, and cross-diffusion of the turbulence models, and their
+   * Jacobians, must match those of the scalar implementations (on top of the edge fluxes). ---*/
+
+  using Indices = CEulerVariable::CIndices<unsigned short>;
+
+  const std::string rans =
+      "SOLVER= RANS\n"
+      "MACH_NUMBER= 0.8\n"
+      "REYNOLDS_NUMBER= 1e4\n"
+      "CONV_NUM_METHOD_FLOW= ROE\n"
+      "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n";
+
+  struct Model {
+    std::string name, options;
+    su2double shift;
+    ScalarNumerics terms;
+  };
+
+  const ScalarNumericsFactory saConv = [](unsigned short nDim, unsigned short nVar, const CSolver&,
+                                          const CConfig* config) -> CNumerics* {
+    return new CUpwSca_TurbSA<Indices>(nDim, nVar, config);
+  };
+  const ScalarNumericsFactory saSource = [](unsigned short nDim, unsigned short, const CSolver&,
+                                            const CConfig* config) -> CNumerics* {
+    return SAFactory<Indices>(nDim, config);
+  };
+  const ScalarNumericsFactory sstConv = [](unsigned short nDim, unsigned short nVar, const CSolver&,
+                                           const CConfig* config) -> CNumerics* {
+    return new CUpwSca_TurbSST<Indices>(nDim, nVar, config);
+  };
+  const ScalarNumericsFactory sstVisc = [](unsigned short nDim, unsigned short nVar, const CSolver& solver,
+                                           const CConfig* config) -> CNumerics* {
+    return new CAvgGrad_TurbSST<Indices>(nDim, nVar, solver.GetConstants(), true, config);
+  };
+  const ScalarNumericsFactory sstSource = [](unsigned short nDim, unsigned short nVar, const CSolver& solver,
+                                             const CConfig* config) -> CNumerics* {
+    return new CSourcePieceWise_TurbSST<Indices>(nDim, nVar, solver.GetConstants(), solver.GetTke_Inf(),
+                                                 solver.GetOmega_Inf(), config);
+  };
+
+  const std::vector<Model> models = {
+      {"SA", "KIND_TURB_MODEL= SA\n", 1.5,
+       {saConv,
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config);
+        },
+        saSource}},
+      {"SA-neg", "KIND_TURB_MODEL= SA\nSA_OPTIONS= NEGATIVE, WITHFT2\n", 0.5,
+       {saConv,
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSA_Neg<Indices>(nDim, nVar, true, config);
+        },
+        saSource}},
+      {"SA-noft2-Edwards", "KIND_TURB_MODEL= SA\nSA_OPTIONS= EDWARDS\n", 1.5,
+       {saConv,
+        [](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config);
+        },
+        saSource}},
+      {"SST", "KIND_TURB_MODEL= SST\n", 1.5, {sstConv, sstVisc, sstSource}},
+      {"SST-V2003m-KL-sust", "KIND_TURB_MODEL= SST\nSST_OPTIONS= V2003m, KATO-LAUNDER, SUSTAINING\n", 1.5,
+       {sstConv, sstVisc, sstSource}},
+      {"SST-V1994m-V", "KIND_TURB_MODEL= SST\nSST_OPTIONS= V1994m, VORTICITY\n", 1.5,
+       {sstConv, sstVisc, sstSource}},
+      {"KW", "KIND_TURB_MODEL= KW\n", 1.5,
+       {[](unsigned short nDim, unsigned short nVar, const CSolver&, const CConfig* config) -> CNumerics* {
+          return new CUpwSca_TurbKW<Indices>(nDim, nVar, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver& solver, const CConfig* config) -> CNumerics* {
+          return new CAvgGrad_TurbKW<Indices>(nDim, nVar, solver.GetConstants(), true, config);
+        },
+        [](unsigned short nDim, unsigned short nVar, const CSolver& solver, const CConfig* config) -> CNumerics* {
+          return new CSourcePieceWise_TurbKW<Indices>(nDim, nVar, solver.GetConstants(), solver.GetTke_Inf(),
+                                                      solver.GetOmega_Inf(), config);
+        }}},
+  };
+
+  for (const auto& model : models) {
+    SECTION(model.name) {
+      const auto options = rans + model.options;
+
+      const auto scalar = AssembleScalarSystem(options, false, TURB_SOL, SetCompressibleState, model.shift,
+                                               model.terms, true);
+      const auto simd = AssembleScalarSystem(options, true, TURB_SOL, SetCompressibleState, model.shift,
+                                             model.terms, true);
+
+      CheckEqual(scalar.residual, simd.residual, 1e-10);
+      CheckEqual(scalar.jacobian, simd.jacobian, 1e-10);
+    }
+  }
+}
@@ -0,0 +1,91 @@
+/*!
+ * \file CEulerSolver_tests.cpp
+ * \brief Unit tests for the compressible flow solver.
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/variables/CFlowVariable.hpp"
+
+TEST_CASE("Frozen preprocessing reproduces the residual", "[Newton-Krylov]") {
+
+  UnitQuadTestCase test;
+  test.AddOption("CONV_NUM_METHOD_FLOW= ROE");
+  test.AddOption("MUSCL_FLOW= YES");
+  test.AddOption("SLOPE_LIMITER_FLOW= VENKATAKRISHNAN");
+  test.AddOption("TIME_DISCRE_FLOW= EULER_IMPLICIT");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* solver = test.solver[FLOW_SOL];
+  auto* nodes = dynamic_cast<CFlowVariable*>(solver->GetNodes());
+  REQUIRE(nodes != nullptr);
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nEdge = geometry->GetnEdge();
+  const auto nVar = solver->GetnVar();
+
+  /*--- Non-uniform state such that the reconstruction and the limiters are active. ---*/
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const su2double* coord = geometry->nodes->GetCoord(iPoint);
+    const su2double factor = 1.0 + 0.05 * sin(6.0 * coord[0]) * cos(5.0 * coord[1]) + 0.02 * coord[2];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      nodes->SetSolution(iPoint, iVar, nodes->GetSolution(iPoint, iVar) * factor);
+    }
+  }
+
+  /*--- Some edges are still first order from previous non-physical reconstructions. ---*/
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge += 3) nodes->NonPhysicalEdgeCounter[iEdge] = 3;
+
+  /*--- Regular residual evaluation, updates the gradients, limiters, and counters. ---*/
+  solver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+  solver->Upwind_Residual(geometry, test.solver, nullptr, config, MESH_0);
+  CHECK_FALSE(nodes->GetFrozenNonPhysicalEdgeCounter());
+
+  const auto counters = nodes->NonPhysicalEdgeCounter;
+  CSysVector<su2double> residual(solver->LinSysRes);
+
+  su2double norm = 0;
+  for (auto i = 0ul; i < residual.GetLocSize(); ++i) norm += pow(residual[i], 2);
+  REQUIRE(norm > 0);
+
+  /*--- Frozen evaluation at the same state, gradients and limiters are not recomputed. ---*/
+  solver->FrozenPreprocessing(geometry, test.solver, config, MESH_0, RUNTIME_FLOW_SYS);
+  solver->Upwind_Residual(geometry, test.solver, nullptr, config, MESH_0);
+  CHECK(nodes->GetFrozenNonPhysicalEdgeCounter());
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    CHECK(nodes->NonPhysicalEdgeCounter[iEdge] == counters[iEdge]);
+  }
+  for (auto i = 0ul; i < residual.GetLocSize(); ++i) {
+    CHECK(SU2_TYPE::GetValue(solver->LinSysRes[i]) == Approx(SU2_TYPE::GetValue(residual[i])).margin(1e-12));
+  }
+
+  /*--- The next regular evaluation unfreezes the counters. ---*/
+  solver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+  CHECK_FALSE(nodes->GetFrozenNonPhysicalEdgeCounter());
+}
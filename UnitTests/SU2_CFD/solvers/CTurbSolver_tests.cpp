@@ -0,0 +1,648 @@
+/*!
+ * \file CTurbSolver_tests.cpp
+ * \brief Unit tests of the turbulence solvers (coupling with the mean flow, updates, and hybrid RANS/LES).
+ * \version 7.5.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <vector>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/integration/CSingleGridIntegration.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_convection.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSolver.hpp"
+
+namespace {
+
+using Indices = CEulerVariable::CIndices<unsigned short>;
+
+/*--- Box with a wall on y_minus, wall distance and free-stream conditions are set by the tests. ---*/
+const std::string ransOptions =
+    "SOLVER= RANS\n"
+    "MESH_FORMAT= BOX\n"
+    "MESH_BOX_SIZE= 5,5,5\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "MARKER_HEATFLUX= (y_minus, 0.0)\n"
+    "MARKER_FAR= (x_minus, x_plus, y_plus, z_minus, z_plus)\n"
+    "INIT_OPTION= TD_CONDITIONS\n"
+    "CONV_NUM_METHOD_FLOW= ROE\n"
+    "MUSCL_FLOW= NO\n"
+    "CONV_NUM_METHOD_TURB= SCALAR_UPWIND\n"
+    "MUSCL_TURB= NO\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "TIME_DISCRE_TURB= EULER_IMPLICIT\n"
+    "LINEAR_SOLVER= FGMRES\n"
+    "LINEAR_SOLVER_PREC= ILU\n"
+    "LINEAR_SOLVER_ERROR= 1e-12\n"
+    "LINEAR_SOLVER_ITER= 50\n";
+
+/*!
+ * \brief Numerics of the flow and turbulence solvers, indexed like the numerics container of the driver.
+ */
+struct NumericsContainer {
+  std::vector<std::unique_ptr<CNumerics> > owner;
+  std::vector<CNumerics*> flow, turb;
+
+  NumericsContainer(const CConfig* config, const CSolver& turbSolver) {
+    const unsigned short nDim = 3, nVarFlow = 5, nVar = turbSolver.GetnVar();
+    const bool sa = config->GetKind_Turb_Model() == TURB_MODEL::SA;
+    const auto nThread = omp_get_max_threads();
+    flow.resize(MAX_TERMS * nThread, nullptr);
+    turb.resize(MAX_TERMS * nThread, nullptr);
+
+    auto add = [&](std::vector<CNumerics*>& container, int iTerm, CNumerics* numerics) {
+      owner.emplace_back(numerics);
+      container[iTerm] = numerics;
+    };
+    for (auto iThread = 0; iThread < nThread; ++iThread) {
+      const auto offset = iThread * MAX_TERMS;
+      add(flow, CONV_TERM + offset, new CUpwRoe_Flow(nDim, nVarFlow, config, false));
+      add(flow, VISC_TERM + offset, new CAvgGrad_Flow(nDim, nVarFlow, true, config));
+      add(flow, CONV_BOUND_TERM + offset, new CUpwRoe_Flow(nDim, nVarFlow, config, false));
+      add(flow, VISC_BOUND_TERM + offset, new CAvgGrad_Flow(nDim, nVarFlow, false, config));
+
+      if (sa) {
+        add(turb, CONV_TERM + offset, new CUpwSca_TurbSA<Indices>(nDim, nVar, config));
+        add(turb, VISC_TERM + offset, new CAvgGrad_TurbSA<Indices>(nDim, nVar, true, config));
+        add(turb, SOURCE_FIRST_TERM + offset, SAFactory<Indices>(nDim, config));
+        add(turb, CONV_BOUND_TERM + offset, new CUpwSca_TurbSA<Indices>(nDim, nVar, config));
+        add(turb, VISC_BOUND_TERM + offset, new CAvgGrad_TurbSA<Indices>(nDim, nVar, false, config));
+      } else {
+        const auto* constants = turbSolver.GetConstants();
+        add(turb, CONV_TERM + offset, new CUpwSca_TurbSST<Indices>(nDim, nVar, config));
+        add(turb, VISC_TERM + offset, new CAvgGrad_TurbSST<Indices>(nDim, nVar, constants, true, config));
+        add(turb, SOURCE_FIRST_TERM + offset,
+            new CSourcePieceWise_TurbSST<Indices>(nDim, nVar, constants, turbSolver.GetTke_Inf(),
+                                                  turbSolver.GetOmega_Inf(), config));
+        add(turb, CONV_BOUND_TERM + offset, new CUpwSca_TurbSST<Indices>(nDim, nVar, config));
+        add(turb, VISC_BOUND_TERM + offset, new CAvgGrad_TurbSST<Indices>(nDim, nVar, constants, false, config));
+      }
+    }
+  }
+};
+
+/*!
+ * \brief Converged flow and turbulence solutions, and the residual reduction that was reached.
+ */
+struct SteadyResult {
+  std::vector<passivedouble> flow, turb;
+  passivedouble flowReduction = 0, turbReduction = 0;
+  unsigned long iterations = 0;
+};
+
+/*!
+ * \brief Run the fluid iteration (flow, then turbulence) to convergence, with segregated or coupled implicit systems.
+ */
+SteadyResult RunSteady(const std::string& options, bool coupled, unsigned long maxIter) {
+  UnitQuadTestCase test;
+  test.config_options = ransOptions + options + (coupled ? "COUPLED_TURB_SOLVE= YES\n" : "COUPLED_TURB_SOLVE= NO\n");
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto** solvers = test.solver;
+  REQUIRE(solvers[TURB_SOL] != nullptr);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    geometry->nodes->SetWall_Distance(iPoint, geometry->nodes->GetCoord(iPoint, 1));
+  }
+
+  NumericsContainer numerics(config, *solvers[TURB_SOL]);
+
+  /*--- Containers with the layout of the driver, one zone, instance, and mesh level. ---*/
+  CConfig* configs[] = {config};
+  CGeometry* geoMesh[] = {geometry};
+  CGeometry** geoInst[] = {geoMesh};
+  CGeometry*** geoZone[] = {geoInst};
+  CSolver** solMesh[] = {solvers};
+  CSolver*** solInst[] = {solMesh};
+  CSolver**** solZone[] = {solInst};
+  CNumerics** numSol[MAX_SOLS] = {nullptr};
+  numSol[FLOW_SOL] = numerics.flow.data();
+  numSol[TURB_SOL] = numerics.turb.data();
+  CNumerics*** numMesh[] = {numSol};
+  CNumerics**** numInst[] = {numMesh};
+  CNumerics***** numZone[] = {numInst};
+
+  CSingleGridIntegration integration;
+  SteadyResult result;
+  su2double flowResMax = 0, turbResMax = 0;
+
+  /*--- Same sequence as CFluidIteration::Iterate without multigrid. ---*/
+  for (unsigned long iIter = 0; iIter < maxIter; ++iIter) {
+    config->SetGlobalParam(MAIN_SOLVER::RANS, RUNTIME_FLOW_SYS);
+    integration.SingleGrid_Iteration(geoZone, solZone, numZone, configs, RUNTIME_FLOW_SYS, 0, 0);
+
+    config->SetGlobalParam(MAIN_SOLVER::RANS, RUNTIME_TURB_SYS);
+    integration.SingleGrid_Iteration(geoZone, solZone, numZone, configs, RUNTIME_TURB_SYS, 0, 0);
+
+    if (coupled) {
+      solvers[TURB_SOL]->CoupledImplicitIteration(geometry, solvers, config);
+      solvers[TURB_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
+    }
+
+    const su2double flowRes = solvers[FLOW_SOL]->GetRes_RMS(0);
+    const su2double turbRes = solvers[TURB_SOL]->GetRes_RMS(0);
+    /*--- The initial residuals are small (uniform free-stream), reductions are w.r.t. the peak. ---*/
+    flowResMax = max(flowResMax, flowRes);
+    turbResMax = max(turbResMax, turbRes);
+    result.iterations = iIter + 1;
+    result.flowReduction = SU2_TYPE::GetValue(flowRes / flowResMax);
+    result.turbReduction = SU2_TYPE::GetValue(turbRes / turbResMax);
+    if (result.flowReduction < 1e-10 && result.turbReduction < 1e-10) break;
+  }
+
+  for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+    auto& values = (iSol == FLOW_SOL) ? result.flow : result.turb;
+    const auto* nodes = solvers[iSol]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      for (auto iVar = 0u; iVar < solvers[iSol]->GetnVar(); ++iVar) {
+        values.push_back(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)));
+      }
+    }
+  }
+
+  /*--- The test case only owns the flow solver. ---*/
+  delete solvers[TURB_SOL];
+  solvers[TURB_SOL] = nullptr;
+  return result;
+}
+
+/*!
+ * \brief Check that two sets of values of nVar interleaved variables match, relative to the range of each variable.
+ */
+void CheckEqual(const std::vector<passivedouble>& ref, const std::vector<passivedouble>& val, unsigned short nVar,
+                passivedouble tol) {
+  REQUIRE(ref.size() == val.size());
+  for (auto iVar = 0u; iVar < nVar; ++iVar) {
+    passivedouble scale = 0;
+    for (auto i = iVar; i < ref.size(); i += nVar) scale = std::max(scale, std::abs(ref[i]));
+    for (auto i = iVar; i < ref.size(); i += nVar) CHECK(val[i] == Approx(ref[i]).margin(tol * scale));
+  }
+}
+
+/*!
+ * \brief RANS case with a hybrid RANS/LES mode, where the turbulence solver computes the DES length scale of a
+ *        uniform shear flow du/dy, with the wall distance and turbulence variables set by the tests.
+ */
+struct HybridRANSLESCase : UnitQuadTestCase {
+  explicit HybridRANSLESCase(const std::string& options) {
+    config_options = ransOptions + "MACH_NUMBER= 0.2\nREYNOLDS_NUMBER= 1e4\n" + options;
+    InitConfig();
+    InitGeometry();
+    InitSolver();
+    REQUIRE(solver[TURB_SOL] != nullptr);
+    geometry->SetMaxLength(config.get());
+  }
+
+  ~HybridRANSLESCase() {
+    delete solver[TURB_SOL];
+    solver[TURB_SOL] = nullptr;
+  }
+
+  /*!
+   * \brief Set the state and compute the length scale, the flow is preprocessed before the velocity gradient,
+   *        du_i/dx_j = velocityGradient(iPoint, i, j), and the corresponding vorticity are imposed.
+   */
+  template <class WallDistance, class VelocityGradient>
+  void ComputeLengthScale(WallDistance wallDistance, const std::vector<passivedouble>& turbVars,
+                          VelocityGradient velocityGradient) {
+    auto* flowNodes = solver[FLOW_SOL]->GetNodes();
+    auto* nodes = solver[TURB_SOL]->GetNodes();
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      geometry->nodes->SetWall_Distance(iPoint, wallDistance(iPoint));
+      for (auto iVar = 0u; iVar < turbVars.size(); ++iVar) nodes->SetSolution(iPoint, iVar, turbVars[iVar]);
+    }
+    solver[FLOW_SOL]->Preprocessing(geometry.get(), solver, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+
+    const auto iVel = Indices(3, 0).Velocity();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      auto gradient = flowNodes->GetGradient_Primitive(iPoint);
+      for (auto iDim = 0u; iDim < 3; ++iDim)
+        for (auto jDim = 0u; jDim < 3; ++jDim) gradient(iVel + iDim, jDim) = velocityGradient(iPoint, iDim, jDim);
+
+      auto* vorticity = flowNodes->GetVorticity(iPoint);
+      vorticity[0] = gradient(iVel + 2, 1) - gradient(iVel + 1, 2);
+      vorticity[1] = gradient(iVel, 2) - gradient(iVel + 2, 0);
+      vorticity[2] = gradient(iVel + 1, 0) - gradient(iVel, 1);
+    }
+
+    solver[TURB_SOL]->Postprocessing(geometry.get(), solver, config.get(), MESH_0);
+    solver[TURB_SOL]->Preprocessing(geometry.get(), solver, config.get(), MESH_0, 0, RUNTIME_TURB_SYS, false);
+  }
+};
+
+/*!
+ * \brief Length scale of the SA hybrid RANS/LES modes evaluated point by point from the coordinates, as done
+ *        before the geometric quantities were cached by SetMaxLength.
+ * \param[out] f_d - Shielding function of the delayed variants.
+ */
+passivedouble ReferenceLengthScale(const CGeometry& geometry, const CConfig& config, const CVariable& flowNodes,
+                                   const CVariable& nodes, unsigned long iPoint, passivedouble& f_d) {
+  const auto nDim = geometry.GetnDim();
+  const auto* points = geometry.nodes;
+  const passivedouble constDES = SU2_TYPE::GetValue(config.GetConst_DES()), k2 = pow(0.41, 2);
+  const passivedouble f_max = 1.0, f_min = 0.1, a1 = 0.15, a2 = 0.3;
+
+  const passivedouble wallDistance = SU2_TYPE::GetValue(points->GetWall_Distance(iPoint));
+  const passivedouble density = SU2_TYPE::GetValue(flowNodes.GetDensity(iPoint));
+  const passivedouble nu = SU2_TYPE::GetValue(flowNodes.GetLaminarViscosity(iPoint)) / density;
+  const passivedouble nuTurb = SU2_TYPE::GetValue(nodes.GetmuT(iPoint)) / density;
+
+  passivedouble uijuij = 0.0;
+  for (auto iDim = 0u; iDim < nDim; iDim++)
+    for (auto jDim = 0u; jDim < nDim; jDim++)
+      uijuij += pow(SU2_TYPE::GetValue(flowNodes.GetVelocityGradient(iPoint)[iDim][jDim]), 2);
+  uijuij = max(sqrt(uijuij), 1e-10);
+
+  passivedouble ratioOmega[3], omega = 0.0;
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    ratioOmega[iDim] = SU2_TYPE::GetValue(flowNodes.GetVorticity(iPoint)[iDim]);
+    omega += pow(ratioOmega[iDim], 2);
+  }
+  for (auto& r : ratioOmega) r /= sqrt(omega);
+
+  /*--- Distances to the neighbors. ---*/
+  passivedouble maxLength = 0.0, maxDelta[3] = {0.0}, lnMax = 0.0;
+  passivedouble vortexTilting = SU2_TYPE::GetValue(nodes.GetVortex_Tilting(iPoint));
+
+  for (const auto jPoint : points->GetPoints(iPoint)) {
+    passivedouble delta[3] = {0.0}, distance = 0.0;
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      delta[iDim] = fabs(SU2_TYPE::GetValue(points->GetCoord(jPoint, iDim) - points->GetCoord(iPoint, iDim)));
+      maxDelta[iDim] = max(maxDelta[iDim], delta[iDim]);
+      distance += pow(delta[iDim], 2);
+    }
+    maxLength = max(maxLength, sqrt(distance));
+
+    const passivedouble ln[] = {delta[1] * ratioOmega[2] - delta[2] * ratioOmega[1],
+                                delta[2] * ratioOmega[0] - delta[0] * ratioOmega[2],
+                                delta[0] * ratioOmega[1] - delta[1] * ratioOmega[0]};
+    lnMax = max(lnMax, sqrt(pow(ln[0], 2) + pow(ln[1], 2) + pow(ln[2], 2)));
+    vortexTilting += SU2_TYPE::GetValue(nodes.GetVortex_Tilting(jPoint));
+  }
+  vortexTilting /= points->GetnPoint(iPoint) + 1;
+
+  const passivedouble r_d = (nuTurb + nu) / (uijuij * k2 * pow(wallDistance, 2));
+  f_d = 1.0 - tanh(pow(8.0 * r_d, 3));
+
+  passivedouble delta = maxLength;
+
+  switch (config.GetKind_HybridRANSLES()) {
+    case SA_DES:
+      f_d = 1.0;
+      break;
+    case SA_ZDES:
+      if (f_d >= 0.99) {
+        delta = sqrt(pow(ratioOmega[0], 2) * maxDelta[1] * maxDelta[2] +
+                     pow(ratioOmega[1], 2) * maxDelta[0] * maxDelta[2] +
+                     pow(ratioOmega[2], 2) * maxDelta[0] * maxDelta[1]);
+      }
+      break;
+    case SA_EDDES:
+      if (f_d >= 0.999) {
+        const passivedouble f_kh = max(f_min, min(f_max, f_min + (f_max - f_min) / (a2 - a1) * (vortexTilting - a1)));
+        delta = lnMax / sqrt(3.0) * f_kh;
+      }
+      break;
+    default:
+      break;
+  }
+  return wallDistance - f_d * max(0.0, wallDistance - constDES * delta);
+}
+
+}  // namespace
+
+TEST_CASE("Eddy viscosity derivatives", "[Coupled turbulence]") {
+
+  /*--- The derivatives of muT used by the coupled solve must match finite differences of the
+   * eddy viscosity computed by the solvers (Postprocessing), w.r.t. the transported variables. ---*/
+
+  auto checkDerivatives = [](const std::string& options, bool conservative) {
+    UnitQuadTestCase test;
+    test.config_options = ransOptions + "MACH_NUMBER= 0.2\nREYNOLDS_NUMBER= 1e4\n" + options;
+    test.InitConfig();
+    test.InitGeometry();
+    test.InitSolver();
+
+    auto* config = test.config.get();
+    auto* geometry = test.geometry.get();
+    auto* flowSolver = test.solver[FLOW_SOL];
+    auto* solver = dynamic_cast<CTurbSolver*>(test.solver[TURB_SOL]);
+    REQUIRE(solver != nullptr);
+    const auto nVar = solver->GetnVar();
+    auto* flowNodes = flowSolver->GetNodes();
+    auto* nodes = solver->GetNodes();
+
+    /*--- Sheared flow, and turbulence variables that vary by orders of magnitude such that
+     * the SST limiter is active in part of the domain. ---*/
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const su2double* x = geometry->nodes->GetCoord(iPoint);
+      geometry->nodes->SetWall_Distance(iPoint, 0.01 + x[1]);
+
+      const su2double factor = 0.3 + x[1] + 0.2 * sin(3 * x[0] + 2 * x[2]);
+      for (auto iDim = 0u; iDim < 3; ++iDim) {
+        flowNodes->SetSolution(iPoint, iDim + 1, flowNodes->GetSolution(iPoint, iDim + 1) * factor);
+      }
+      nodes->SetSolution(iPoint, 0, nodes->GetSolution(iPoint, 0) * (1.5 + sin(3 * x[0] + x[1] - 2 * x[2])));
+      if (nVar > 1) nodes->SetSolution(iPoint, 1, nodes->GetSolution(iPoint, 1) * pow(10.0, -3 * x[0]));
+    }
+
+    flowSolver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    solver->Postprocessing(geometry, test.solver, config, MESH_0);
+    flowSolver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+    solver->Postprocessing(geometry, test.solver, config, MESH_0);
+
+    unsigned long nLimited = 0;
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+      std::vector<su2double> dmuT(nVar);
+      solver->EddyViscosityDerivatives(iPoint, geometry, flowNodes, config, dmuT.data());
+
+      const su2double rho = flowNodes->GetDensity(iPoint);
+      const su2double muT = nodes->GetmuT(iPoint);
+      if (nVar > 1 && muT < 0.999 * rho * nodes->GetSolution(iPoint, 0) / nodes->GetSolution(iPoint, 1)) ++nLimited;
+
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        const su2double value = nodes->GetSolution(iPoint, iVar);
+        const su2double delta = 1e-6 * fabs(value);
+
+        nodes->SetSolution(iPoint, iVar, value + delta);
+        solver->Postprocessing(geometry, test.solver, config, MESH_0);
+        const su2double muT_p = nodes->GetmuT(iPoint);
+
+        nodes->SetSolution(iPoint, iVar, value - delta);
+        solver->Postprocessing(geometry, test.solver, config, MESH_0);
+        const su2double muT_m = nodes->GetmuT(iPoint);
+
+        nodes->SetSolution(iPoint, iVar, value);
+
+        /*--- The increments of the conservative variables are rho times those of the solution. ---*/
+        const su2double fd = (muT_p - muT_m) / (2 * delta * (conservative ? rho : 1.0));
+        const su2double scale = muT / fabs(value * (conservative ? rho : 1.0));
+        CHECK(SU2_TYPE::GetValue(dmuT[iVar]) == Approx(SU2_TYPE::GetValue(fd)).margin(1e-6 * SU2_TYPE::GetValue(scale)));
+      }
+    }
+    solver->Postprocessing(geometry, test.solver, config, MESH_0);
+    if (nVar > 1) CHECK(nLimited > 0);
+
+    delete test.solver[TURB_SOL];
+    test.solver[TURB_SOL] = nullptr;
+  };
+
+  SECTION("SA") { checkDerivatives("KIND_TURB_MODEL= SA\n", false); }
+
+  SECTION("SST-V1994m") { checkDerivatives("KIND_TURB_MODEL= SST\nSST_OPTIONS= V1994m\n", true); }
+}
+
+TEST_CASE("Coupled mean flow and turbulence solve", "[Coupled turbulence]") {
+
+  /*--- The coupled and segregated implicit systems only differ in the Jacobian, both runs must
+   * converge to the same steady solution. ---*/
+
+  /*--- Low Reynolds number such that both runs converge in a few hundred iterations. ---*/
+  const std::string flowOptions = "MACH_NUMBER= 0.5\nREYNOLDS_NUMBER= 1e3\nCFL_NUMBER= 50\n";
+
+  auto compare = [&](const std::string& options, unsigned short nVar) {
+    const auto segregated = RunSteady(flowOptions + options, false, 2000);
+    const auto coupled = RunSteady(flowOptions + options, true, 2000);
+
+    INFO("Iterations, segregated: " << segregated.iterations << ", coupled: " << coupled.iterations);
+    REQUIRE(segregated.flowReduction < 1e-10);
+    REQUIRE(segregated.turbReduction < 1e-10);
+    REQUIRE(coupled.flowReduction < 1e-10);
+    REQUIRE(coupled.turbReduction < 1e-10);
+
+    CheckEqual(segregated.flow, coupled.flow, 5, 1e-7);
+    CheckEqual(segregated.turb, coupled.turb, nVar, 1e-7);
+  };
+
+  SECTION("SA") { compare("KIND_TURB_MODEL= SA\n", 1); }
+
+  SECTION("SST") { compare("KIND_TURB_MODEL= SST\n", 2); }
+}
+
+TEST_CASE("Positivity preserving update of k and omega", "[Turbulence positivity]") {
+
+  /*--- Decreasing increments of the conservative variables are mapped to rho_old U_old exp(dU / (rho_old U_old)),
+   * increasing ones are not modified. The same must hold when the flow was updated before the turbulence
+   * variables (coupled solve), i.e. when the new density differs from the old one. ---*/
+
+  auto checkUpdate = [](passivedouble densityFactor) {
+    UnitQuadTestCase test;
+    test.config_options = ransOptions + "MACH_NUMBER= 0.2\nREYNOLDS_NUMBER= 1e4\n"
+                                        "KIND_TURB_MODEL= SST\nTURB_POSITIVITY_UPDATE= YES\n";
+    test.InitConfig();
+    test.InitGeometry();
+    test.InitSolver();
+
+    auto* config = test.config.get();
+    auto* geometry = test.geometry.get();
+    auto* flowSolver = test.solver[FLOW_SOL];
+    auto* solver = test.solver[TURB_SOL];
+    auto* flowNodes = flowSolver->GetNodes();
+    auto* nodes = solver->GetNodes();
+    const auto nPoint = geometry->GetnPointDomain();
+
+    flowNodes->Set_OldSolution();
+    nodes->Set_OldSolution();
+
+    /*--- Change of density (the velocity and temperature are unchanged) by the update of the flow. ---*/
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      for (auto iVar = 0u; iVar < flowSolver->GetnVar(); ++iVar) {
+        flowNodes->SetSolution(iPoint, iVar, flowNodes->GetSolution(iPoint, iVar) * densityFactor);
+      }
+    }
+    flowSolver->Preprocessing(geometry, test.solver, config, MESH_0, 0, RUNTIME_FLOW_SYS, false);
+
+    /*--- Increments that would make the linear update negative, small decrements, and increments. ---*/
+    const passivedouble fraction[] = {-3.0, -0.1, 0.5};
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const su2double densityOld = flowNodes->GetSolution_Old(iPoint, 0);
+      for (auto iVar = 0u; iVar < 2; ++iVar) {
+        const su2double U = densityOld * nodes->GetSolution_Old(iPoint, iVar);
+        solver->LinSysSol(iPoint, iVar) = fraction[(iPoint + iVar) % 3] * U;
+      }
+    }
+
+    solver->CompleteImplicitIteration(geometry, test.solver, config);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const su2double densityOld = flowNodes->GetSolution_Old(iPoint, 0);
+      const su2double density = flowNodes->GetDensity(iPoint);
+      REQUIRE(SU2_TYPE::GetValue(density) == Approx(SU2_TYPE::GetValue(densityOld) * densityFactor));
+
+      for (auto iVar = 0u; iVar < 2; ++iVar) {
+        const passivedouble x = fraction[(iPoint + iVar) % 3];
+        const su2double U = densityOld * nodes->GetSolution_Old(iPoint, iVar);
+        const su2double expected = U * (x < 0 ? exp(x) : 1 + x) / density;
+
+        CHECK(nodes->GetSolution(iPoint, iVar) > 0.0);
+        CHECK(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar)) == Approx(SU2_TYPE::GetValue(expected)));
+      }
+    }
+
+    delete test.solver[TURB_SOL];
+    test.solver[TURB_SOL] = nullptr;
+  };
+
+  SECTION("Segregated") { checkUpdate(1.0); }
+
+  SECTION("Coupled") { checkUpdate(1.1); }
+}
+
+TEST_CASE("Length scale of the SST hybrid RANS/LES modes", "[Hybrid RANS/LES]") {
+
+  /*--- Near walls the shielding functions keep the RANS length scale of the k-omega models, k^(1/2) / (beta* omega).
+   * Away from walls, in a resolved shear flow where the RANS length scale is larger, the length scale is C_DES Delta,
+   * with C_DES blended by F1 (SST) or 0.78 (k-omega). ---*/
+
+  const passivedouble kine = 1.0, omega = 1.0, shear = 1e3, betaStar = 0.09;
+
+  for (const std::string model : {"SST", "KW"}) {
+    for (const std::string mode : {"SST_DDES", "SST_IDDES"}) {
+      HybridRANSLESCase test("KIND_TURB_MODEL= " + model + "\nHYBRID_RANSLES= " + mode + "\n");
+      const auto* points = test.geometry->nodes;
+      const auto* nodes = test.solver[TURB_SOL]->GetNodes();
+
+      for (const bool nearWall : {true, false}) {
+        INFO(model << " " << mode << (nearWall ? " near walls" : " away from walls"));
+
+        test.ComputeLengthScale([&](unsigned long) { return nearWall ? 1e-8 : 1e3; }, {kine, omega},
+                                [&](unsigned long, unsigned short iDim, unsigned short jDim) {
+                                  return (iDim == 0 && jDim == 1) ? shear : 0.0;
+                                });
+
+        for (auto iPoint = 0ul; iPoint < test.geometry->GetnPointDomain(); ++iPoint) {
+          const passivedouble lengthScale = SU2_TYPE::GetValue(nodes->GetDES_LengthScale(iPoint));
+          const passivedouble delta = SU2_TYPE::GetValue(points->GetMaxLength(iPoint));
+          const passivedouble F1 = SU2_TYPE::GetValue(nodes->GetF1blending(iPoint));
+          const passivedouble constDES = (model == "KW") ? 0.78 : 0.78 * F1 + 0.61 * (1.0 - F1);
+
+          REQUIRE(sqrt(kine) / (betaStar * omega) > constDES * delta);
+          if (nearWall) {
+            CHECK(lengthScale == Approx(sqrt(kine) / (betaStar * omega)));
+          } else {
+            CHECK(lengthScale == Approx(constDES * delta));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Length scale of the SA hybrid RANS/LES modes", "[Hybrid RANS/LES]") {
+
+  /*--- The vectorized length scale, which uses the distances to the neighbors cached by SetMaxLength, must match a
+   * point by point evaluation from the coordinates. The 125 points of the box leave a partially masked group of
+   * points for any SIMD length. After the grid moves, SetMaxLength must refresh the cached distances. ---*/
+
+  for (const std::string mode : {"SA_DES", "SA_DDES", "SA_ZDES", "SA_EDDES"}) {
+    HybridRANSLESCase test("KIND_TURB_MODEL= SA\nHYBRID_RANSLES= " + mode + "\n");
+    auto* geometry = test.geometry.get();
+    auto* points = geometry->nodes;
+    const auto* flowNodes = test.solver[FLOW_SOL]->GetNodes();
+    const auto* nodes = test.solver[TURB_SOL]->GetNodes();
+    const auto nDim = geometry->GetnDim();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    REQUIRE(nPointDomain % 2 == 1);
+
+    const passivedouble nuTilde = SU2_TYPE::GetValue(nodes->GetSolution(0, 0)), shear = 3.0;
+
+    /*--- Wall distance from the current coordinates, and a velocity gradient that rotates the vorticity. ---*/
+    auto wallDistance = [&](unsigned long iPoint) { return 0.02 + SU2_TYPE::GetValue(points->GetCoord(iPoint, 1)); };
+    auto velocityGradient = [&](unsigned long iPoint, unsigned short iDim, unsigned short jDim) {
+      const su2double* x = points->GetCoord(iPoint);
+      if (iDim == 0 && jDim == 1) return shear;
+      return shear * 0.5 * sin(1.0 + 3 * iDim + jDim + 2 * SU2_TYPE::GetValue(x[0] - x[2]));
+    };
+
+    std::vector<passivedouble> lengthScales(nPointDomain);
+
+    for (const bool moved : {false, true}) {
+      INFO(mode << (moved ? " after the grid moves" : ""));
+
+      if (moved) {
+        /*--- Stretch and skew the grid, as a deformation would. ---*/
+        for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+          const su2double* x = points->GetCoord(iPoint);
+          const su2double coord[] = {1.5 * x[0] + 0.2 * x[1], 0.8 * x[1], x[2] + 0.3 * x[0] * x[1]};
+          points->SetCoord(iPoint, coord);
+        }
+        geometry->SetMaxLength(test.config.get());
+      }
+
+      /*--- Cached distances to the neighbors, the shortest one is the wall normal step of IDDES. ---*/
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        passivedouble maxDelta[3] = {0.0}, minLength = SU2_TYPE::GetValue(points->GetMaxLength(iPoint));
+        for (auto iNeigh = 0u; iNeigh < points->GetnPoint(iPoint); ++iNeigh) {
+          const auto jPoint = points->GetPoint(iPoint, iNeigh);
+          passivedouble distance = 0.0;
+          for (auto iDim = 0u; iDim < nDim; ++iDim) {
+            const passivedouble delta = fabs(SU2_TYPE::GetValue(points->GetCoord(jPoint, iDim) - points->GetCoord(iPoint, iDim)));
+            CHECK(SU2_TYPE::GetValue(points->GetNeighborDelta(iPoint, iNeigh)[iDim]) == Approx(delta));
+            maxDelta[iDim] = max(maxDelta[iDim], delta);
+            distance += pow(delta, 2);
+          }
+          minLength = min(minLength, sqrt(distance));
+        }
+        for (auto iDim = 0u; iDim < nDim; ++iDim) {
+          CHECK(SU2_TYPE::GetValue(points->GetMaxDelta(iPoint)[iDim]) == Approx(maxDelta[iDim]));
+        }
+        CHECK(SU2_TYPE::GetValue(points->GetMinLength(iPoint)) == Approx(minLength));
+      }
+
+      test.ComputeLengthScale(wallDistance, {nuTilde}, velocityGradient);
+
+      unsigned long nShielded = 0, nUnshielded = 0, nChanged = 0;
+
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        passivedouble f_d;
+        const passivedouble reference = ReferenceLengthScale(*geometry, *test.config, *flowNodes, *nodes, iPoint, f_d);
+        const passivedouble lengthScale = SU2_TYPE::GetValue(nodes->GetDES_LengthScale(iPoint));
+        CHECK(lengthScale == Approx(reference));
+
+        nShielded += (f_d < 0.99);
+        nUnshielded += (f_d >= 0.999);
+        if (moved) nChanged += (lengthScale != Approx(lengthScales[iPoint]));
+        lengthScales[iPoint] = lengthScale;
+      }
+
+      /*--- Both branches of the ZDES and EDDES length scales are tested, and the grid motion matters. ---*/
+      if (mode != "SA_DES") {
+        CHECK(nShielded > 0);
+        CHECK(nUnshielded > 0);
+      }
+      if (moved) CHECK(nChanged > nPointDomain / 2);
+    }
+  }
+}
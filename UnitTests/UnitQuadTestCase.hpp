@@ -83,11 +83,13 @@ struct UnitQuadTestCase {
 
   /*!
    * \brief Initialize the geometry
+   * \param[in] partition - Partition the mesh between the ranks (graph coloring), as the driver does.
    */
-  void InitGeometry() {
+  void InitGeometry(bool partition = false) {
     cout.rdbuf(nullptr);
     {
       auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      if (partition) aux_geometry->SetColorGrid_Parallel(config.get());
       geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
     }
     geometry->SetSendReceive(config.get());